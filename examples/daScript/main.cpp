@@ -1,11 +1,13 @@
 #include "daScript/daScript.h"
 #include "daScript/simulate/fs_file_info.h"
+#include "daScript/simulate/runtime_profile.h"
+#include "daScript/ast/ast_jit_x64.h"
 
 using namespace das;
 
 TextPrinter tout;
 
-void compile_and_run ( const string & fn, const string & mainFnName, bool outputProgramCode ) {
+void compile_and_run ( const string & fn, const string & mainFnName, bool outputProgramCode, AotLibrary * aotLib, vector<FunctionProfile> * profile, bool useJit ) {
     auto access = make_shared<FsFileAccess>();
     ModuleGroup dummyGroup;
     if ( auto program = compileDaScript(fn,access,tout,dummyGroup) ) {
@@ -18,9 +20,24 @@ void compile_and_run ( const string & fn, const string & mainFnName, bool output
                 tout << *program << "\n";
             Context ctx;
             program->simulate(ctx, tout);
+            if ( aotLib ) {
+                program->linkCppAot(ctx, *aotLib, tout);
+            }
+            unique_ptr<JitX64> jit;
+            if ( useJit && JitX64::supported() ) {
+                jit.reset(new JitX64(program, ctx));
+                jit->compile(tout, outputProgramCode);
+            }
             if ( auto fnTest = ctx.findFunction(mainFnName.c_str()) ) {
+                if ( profile ) {
+                    ctx.profileFunctions(true);
+                }
                 ctx.restart();
                 ctx.eval(fnTest, nullptr);
+                if ( profile ) {
+                    ctx.getFunctionProfile(*profile);
+                    ctx.profileFunctions(false);
+                }
             } else {
                 tout << "function '"  << mainFnName << " ' not found\n";
             }
@@ -29,7 +46,7 @@ void compile_and_run ( const string & fn, const string & mainFnName, bool output
 }
 
 void print_help() {
-    tout << "daScript scriptName1 {scriptName2} .. {-main mainFnName} {-log}\n";
+    tout << "daScript scriptName1 {scriptName2} .. {-main mainFnName} {-log} {-aot sharedLibrary} {-profile profileFile} {-jit}\n";
 }
 
 void require_project_specific_modules();//link time resolved dependencies
@@ -42,6 +59,9 @@ int main(int argc, const char * argv[]) {
     vector<string> files;
     string mainName = "main";
     bool outputProgramCode = false;
+    vector<string> aotLibraries;
+    string profileName;
+    bool useJit = false;
     for ( int i=1; i < argc;  ) {
         if ( argv[i][0]=='-' ) {
             string cmd(argv[i]+1);
@@ -53,6 +73,23 @@ int main(int argc, const char * argv[]) {
                 }
                 mainName = argv[i+1];
                 i += 2;
+            } else if ( cmd=="aot" ) {
+                if ( i+1 >= argc ) {
+                    print_help();
+                    return -1;
+                }
+                aotLibraries.push_back(argv[i+1]);
+                i += 2;
+            } else if ( cmd=="profile" ) {
+                if ( i+1 >= argc ) {
+                    print_help();
+                    return -1;
+                }
+                profileName = argv[i+1];
+                i += 2;
+            } else if ( cmd=="jit" ) {
+                useJit = true;
+                i ++;
             } else if ( cmd=="log" ) {
                 outputProgramCode = true;
                 i ++;
@@ -76,9 +113,32 @@ int main(int argc, const char * argv[]) {
     NEED_MODULE(Module_Random);
     NEED_MODULE(Module_Rtti);
     require_project_specific_modules();
+    // AOT, precompiled into shared objects
+    vector<unique_ptr<AotSharedLibrary>> sharedLibs;    // outlives the factories in the aotLib
+    AotLibrary aotLib;
+    for ( const auto & libName : aotLibraries ) {
+        sharedLibs.emplace_back(new AotSharedLibrary());
+        if ( !sharedLibs.back()->load(libName, aotLib, tout) ) {
+            Module::Shutdown();
+            return -1;
+        }
+    }
     // compile and run
+    vector<FunctionProfile> profile;
     for ( const auto & fn : files ) {
-        compile_and_run(fn, mainName, outputProgramCode);
+        compile_and_run(fn, mainName, outputProgramCode, aotLibraries.empty() ? nullptr : &aotLib,
+            profileName.empty() ? nullptr : &profile, useJit);
+    }
+    // function profile, for the profile guided AOT
+    if ( !profileName.empty() ) {
+        TextWriter tw;
+        writeFunctionProfile(tw, profile);
+        if ( FILE * f = fopen(profileName.c_str(), "w") ) {
+            fwrite(tw.str().c_str(), tw.str().length(), 1, f);
+            fclose(f);
+        } else {
+            tout << "can't write profile " << profileName << "\n";
+        }
     }
     // and done
     Module::Shutdown();
@@ -4,6 +4,8 @@
 
 #include "daScript/daScript.h"
 
+#include <stdexcept>
+
 #define FAST_PATH_ANNOTATION    1
 #define FUNC_TO_QUERY           1
 
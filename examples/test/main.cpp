@@ -1,5 +1,7 @@
 #include "daScript/daScript.h"
 #include "daScript/simulate/fs_file_info.h"
+#include "daScript/ast/ast_jit_x64.h"
+#include "daScript/ast/ast_tiering.h"
 
 #ifdef _MSC_VER
 #include <io.h>
@@ -13,6 +15,9 @@ bool g_reportCompilationFailErrors = false;
 
 TextPrinter tout;
 
+// each test is compiled once, and then simulated for the interpreter and for AOT
+ProgramCache g_programCache;
+
 bool compilation_fail_test ( const string & fn, bool ) {
     tout << fn << " ";
     auto fAccess = make_shared<FsFileAccess>();
@@ -62,11 +67,40 @@ bool compilation_fail_test ( const string & fn, bool ) {
     }
 }
 
+// runs function 'test' of the context, reports the failure
+bool run_unit_test_function ( Context & ctx, ModuleGroup & libGroup ) {
+    if ( auto fnTest = ctx.findFunction("test") ) {
+        if ( !verifyCall<bool>(fnTest->debugInfo, libGroup) ) {
+            tout << "function 'test', call arguments do not match\n";
+            return false;
+        }
+        ctx.restart();
+        ctx.runInitScript();    // this is here for testing purposes only
+        bool result = cast<bool>::to(ctx.eval(fnTest, nullptr));
+        if ( auto ex = ctx.getException() ) {
+            tout << "exception: " << ex << "\n";
+            return false;
+        }
+        if ( !result ) {
+            tout << "failed\n";
+            return false;
+        }
+        return true;
+    } else {
+        tout << "function 'test' not found\n";
+        return false;
+    }
+}
+
+// interpreted tests also run from the context image, when the program can be imaged
+int g_imageTests = 0;
+int g_imageFallbacks = 0;
+
 bool unit_test ( const string & fn, bool useAot ) {
     tout << fn << " ";
     auto fAccess = make_shared<FsFileAccess>();
     ModuleGroup dummyLibGroup;
-    if ( auto program = compileDaScript(fn, fAccess, tout, dummyLibGroup) ) {
+    if ( auto program = compileDaScript(fn, fAccess, tout, dummyLibGroup, false, &g_programCache) ) {
         if ( program->failed() ) {
             tout << "failed to compile\n";
             for ( auto & err : program->errors ) {
@@ -82,35 +116,104 @@ bool unit_test ( const string & fn, bool useAot ) {
                 }
                 return false;
             }
+            ContextImage image;
             if ( useAot ) {
                 // now, what we get to do is to link AOT
                 AotLibrary aotLib;
                 AotListBase::registerAot(aotLib);
                 program->linkCppAot(ctx, aotLib, tout);
-            }
-            if ( auto fnTest = ctx.findFunction("test") ) {
-                if ( !verifyCall<bool>(fnTest->debugInfo, dummyLibGroup) ) {
-                    tout << "function 'test', call arguments do not match\n";
-                    return false;
+            } else {
+                TextWriter imageLogs;
+                if ( !program->makeImage(ctx, image, imageLogs) ) {
+                    g_imageFallbacks ++;
                 }
-                ctx.restart();
-                ctx.runInitScript();    // this is here for testing purposes only
-                bool result = cast<bool>::to(ctx.eval(fnTest, nullptr));
-                if ( auto ex = ctx.getException() ) {
-                    tout << "exception: " << ex << "\n";
+            }
+            if ( !run_unit_test_function(ctx, dummyLibGroup) ) {
+                return false;
+            }
+            if ( !image.empty() ) {
+                Context imageCtx;
+                if ( !image.instantiate(imageCtx, tout) ) {
                     return false;
                 }
-                if ( !result ) {
-                    tout << "failed\n";
+                if ( !run_unit_test_function(imageCtx, dummyLibGroup) ) {
+                    tout << "from the context image\n";
                     return false;
                 }
-                tout << (useAot ? "ok AOT\n" : "ok\n");
+                g_imageTests ++;
+                tout << "ok, image\n";
                 return true;
-            } else {
-                tout << "function 'test' not found\n";
+            }
+            tout << (useAot ? "ok AOT\n" : "ok\n");
+            return true;
+        }
+    } else {
+        return false;
+    }
+}
+
+// same as the interpreted test, only functions which native JIT can compile are compiled
+int g_jitFunctions = 0;
+
+bool jit_unit_test ( const string & fn, bool ) {
+    tout << fn << " ";
+    auto fAccess = make_shared<FsFileAccess>();
+    ModuleGroup dummyLibGroup;
+    if ( auto program = compileDaScript(fn, fAccess, tout, dummyLibGroup, false, &g_programCache) ) {
+        if ( program->failed() ) {
+            tout << "failed to compile\n";
+            return false;
+        }
+        Context ctx;
+        if ( !program->simulate(ctx, tout) ) {
+            tout << "failed to simulate\n";
+            return false;
+        }
+        JitX64 jit(program, ctx);
+        g_jitFunctions += jit.compile(tout);
+        if ( !run_unit_test_function(ctx, dummyLibGroup) ) {
+            return false;
+        }
+        tout << "ok JIT\n";
+        return true;
+    } else {
+        return false;
+    }
+}
+
+// test runs several times, and functions are promoted between the runs. every tier is used on the second call
+int g_tierPromotions = 0;
+
+bool tiered_unit_test ( const string & fn, bool ) {
+    tout << fn << " ";
+    auto fAccess = make_shared<FsFileAccess>();
+    ModuleGroup dummyLibGroup;
+    if ( auto program = compileDaScript(fn, fAccess, tout, dummyLibGroup, false, &g_programCache) ) {
+        if ( program->failed() ) {
+            tout << "failed to compile\n";
+            return false;
+        }
+        Context ctx;
+        if ( !program->simulate(ctx, tout) ) {
+            tout << "failed to simulate\n";
+            return false;
+        }
+        AotLibrary aotLib;
+        AotListBase::registerAot(aotLib);
+        TieringOptions options;
+        options.fuseAt = 1;
+        options.nativeAt = 2;
+        options.aotLib = &aotLib;
+        TieredExecution tiers(program, ctx, options);
+        for ( int pass=0; pass!=3; ++pass ) {
+            if ( !run_unit_test_function(ctx, dummyLibGroup) ) {
                 return false;
             }
+            tiers.update(tout);
         }
+        g_tierPromotions += tiers.promotions();
+        tout << "ok tiered\n";
+        return true;
     } else {
         return false;
     }
@@ -120,7 +223,7 @@ bool exception_test ( const string & fn, bool useAot ) {
     tout << fn << " ";
     auto fAccess = make_shared<FsFileAccess>();
     ModuleGroup dummyLibGroup;
-    if ( auto program = compileDaScript(fn, fAccess, tout, dummyLibGroup) ) {
+    if ( auto program = compileDaScript(fn, fAccess, tout, dummyLibGroup, false, &g_programCache) ) {
         if ( program->failed() ) {
             tout << "failed to compile\n";
             for ( auto & err : program->errors ) {
@@ -165,6 +268,21 @@ bool exception_test ( const string & fn, bool useAot ) {
     }
 }
 
+extern "C" int64_t ref_time_ticks ();
+extern "C" int get_time_usec (int64_t reft);
+
+int g_compileTimeUsec = 0;
+ProgramCache * g_compileTimeCache = nullptr;
+
+bool compile_time_test ( const string & fn, bool ) {
+    auto fAccess = make_shared<FsFileAccess>();
+    ModuleGroup dummyLibGroup;
+    auto time0 = ref_time_ticks();
+    auto program = compileDaScript(fn, fAccess, tout, dummyLibGroup, false, g_compileTimeCache);
+    g_compileTimeUsec += get_time_usec(time0);
+    return program && !program->failed();
+}
+
 bool run_tests( const string & path, bool (*test_fn)(const string &, bool useAot), bool useAot ) {
 #ifdef _MSC_VER
     bool ok = true;
@@ -199,7 +317,12 @@ bool run_tests( const string & path, bool (*test_fn)(const string &, bool useAot
 }
 
 bool run_unit_tests( const string & path ) {
-    return run_tests(path, unit_test, false) && run_tests(path, unit_test, true);
+    bool ok = run_tests(path, unit_test, false) && run_tests(path, unit_test, true);
+    if ( JitX64::supported() ) {
+        ok = run_tests(path, jit_unit_test, false) && ok;
+    }
+    ok = run_tests(path, tiered_unit_test, false) && ok;
+    return ok;
 }
 
 bool run_compilation_fail_tests( const string & path ) {
@@ -210,7 +333,29 @@ bool run_exception_tests( const string & path ) {
     return run_tests(path, exception_test, false) && run_tests(path, exception_test, true);
 }
 
-int main() {
+// compiles the tests several times, reports the best time. nothing is simulated or run
+//  cold is compiling from the scratch, warm is getting the same programs from the program cache
+bool run_compile_time_benchmark( const string & path, int passes ) {
+    bool ok = true;
+    ProgramCache cache;
+    int minT[2] = { 0x7fffffff, 0x7fffffff };
+    for ( int warm=0; warm!=2; ++warm ) {
+        g_compileTimeCache = warm ? &cache : nullptr;
+        if ( warm ) {
+            run_tests(path, compile_time_test, false);
+        }
+        for ( int i=0; i!=passes; ++i ) {
+            g_compileTimeUsec = 0;
+            ok = run_tests(path, compile_time_test, false) && ok;
+            minT[warm] = das::min(minT[warm], g_compileTimeUsec);
+        }
+    }
+    g_compileTimeCache = nullptr;
+    tout << "compiling " << path << " took " << (minT[0] / 1000000.) << ", from the cache " << (minT[1] / 1000000.) << "\n";
+    return ok;
+}
+
+int main( int argc, const char * argv[] ) {
   _mm_setcsr((_mm_getcsr()&~_MM_ROUND_MASK) | _MM_FLUSH_ZERO_MASK | _MM_ROUND_NEAREST | 0x40);//0x40
 #ifdef _MSC_VER
     #define    TEST_PATH "../"
@@ -236,13 +381,23 @@ int main() {
     Module::Shutdown();
     return 0;
 #endif
+    if ( argc>1 && strcmp(argv[1],"-compile-time")==0 ) {
+        bool ok = true;
+        ok = run_compile_time_benchmark(TEST_PATH "examples/test/unit_tests", 10) && ok;
+        ok = run_compile_time_benchmark(TEST_PATH "examples/test/optimizations", 10) && ok;
+        Module::Shutdown();
+        return ok ? 0 : -1;
+    }
     bool ok = true;
     ok = run_compilation_fail_tests(TEST_PATH "examples/test/compilation_fail_tests") && ok;
     ok = run_unit_tests(TEST_PATH "examples/test/unit_tests") && ok;
     ok = run_unit_tests(TEST_PATH "examples/test/optimizations") && ok;
     ok = run_exception_tests(TEST_PATH "examples/test/runtime_errors") && ok;
+    tout << "context images " << g_imageTests << ", not supported " << g_imageFallbacks << "\n";
+    tout << "native JIT functions " << g_jitFunctions << ", tier promotions " << g_tierPromotions << "\n";
     tout << "TESTS " << (ok ? "PASSED" : "FAILED!!!") << "\n";
     // shutdown
+    g_programCache.clear();
     Module::Shutdown();
     return ok ? 0 : -1;
 }
@@ -1,8 +1,9 @@
-/* A Bison parser, made by GNU Bison 3.2.2.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison implementation for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2015, 2018 Free Software Foundation, Inc.
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
@@ -15,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -33,6 +34,10 @@
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -40,14 +45,11 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Undocumented macros, especially those whose name start with YY_,
-   are private implementation details.  Do not rely on them.  */
-
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "3.2.2"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
@@ -70,13 +72,12 @@
 #define yyerror         das_yyerror
 #define yydebug         das_yydebug
 #define yynerrs         das_yynerrs
-
 #define yylval          das_yylval
 #define yychar          das_yychar
 #define yylloc          das_yylloc
 
 /* First part of user prologue.  */
-#line 43 "src/parser/ds_parser.ypp" /* yacc.c:338  */
+#line 43 "src/parser/ds_parser.ypp"
 
 	#include "daScript/misc/platform.h"
 	#include "daScript/simulate/debug_info.h"
@@ -96,7 +97,17 @@
     int yylex();
     void yybegin(const char * str);
 
-#line 100 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:338  */
+#line 101 "generated/ds_parser.cpp"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
 # ifndef YY_NULLPTR
 #  if defined __cplusplus
 #   if 201103L <= __cplusplus
@@ -109,293 +120,335 @@
 #  endif
 # endif
 
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 0
-#endif
-
-/* In a future release of Bison, this section will be replaced
-   by #include "ds_parser.hpp".  */
-#ifndef YY_DAS_YY_C_USERS_BORIS_WORK_YZG_GENERATED_DS_PARSER_HPP_INCLUDED
-# define YY_DAS_YY_C_USERS_BORIS_WORK_YZG_GENERATED_DS_PARSER_HPP_INCLUDED
-/* Debug traces.  */
-#ifndef DAS_YYDEBUG
-# if defined YYDEBUG
-#if YYDEBUG
-#   define DAS_YYDEBUG 1
-#  else
-#   define DAS_YYDEBUG 0
-#  endif
-# else /* ! defined YYDEBUG */
-#  define DAS_YYDEBUG 1
-# endif /* ! defined YYDEBUG */
-#endif  /* ! defined DAS_YYDEBUG */
-#if DAS_YYDEBUG
-extern int das_yydebug;
-#endif
-/* "%code requires" blocks.  */
-#line 2 "src/parser/ds_parser.ypp" /* yacc.c:353  */
-
-	#include "daScript/misc/platform.h"
-	#include "daScript/ast/ast.h"
-    #include "daScript/ast/ast_generate.h"
-    #include "daScript/ast/ast_expressions.h"
-    
-    namespace das {
-        extern ProgramPtr			g_Program;
-        extern FileAccessPtr        g_Access;
-        extern vector<FileInfo *>	g_FileAccessStack;
-    }
-    using namespace das;
-    
-    struct VariableDeclaration {
-        VariableDeclaration ( const LineInfo & a, vector<string> * n, TypeDecl * t, Expression * i )
-            : at(a), pNameList(n), pTypeDecl(t), pInit(i) {}
-        virtual ~VariableDeclaration () {
-            if ( pNameList ) delete pNameList;
-            delete pTypeDecl;
-            if ( pInit ) delete pInit;
-            if ( annotation ) delete annotation;
-        }
-        LineInfo                at;
-        vector<string>          *pNameList;
-        TypeDecl                *pTypeDecl;
-        Expression              *pInit;
-        bool                    move_to_init = false;
-        bool                    override = false;
-        AnnotationArgumentList  *annotation = nullptr;
-    };
-    
-    ExprLooksLikeCall * parseFunctionArguments ( ExprLooksLikeCall * pCall, Expression * arguments );
-    vector<ExpressionPtr> sequenceToList ( Expression * arguments );
-    void deleteVariableDeclarationList ( vector<VariableDeclaration *> * list );
-    void varDeclToTypeDecl ( TypeDecl * pType, vector<VariableDeclaration*> * list );
-    
-    LineInfo tokAt ( const struct YYLTYPE & li );
-    
-    Annotation * findAnnotation ( const string & name, const LineInfo & at );
-
-#line 182 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:353  */
-
-/* Token type.  */
-#ifndef DAS_YYTOKENTYPE
-# define DAS_YYTOKENTYPE
-  enum das_yytokentype
-  {
-    LEXER_ERROR = 258,
-    DAS_STRUCT = 259,
-    DAS_LET = 260,
-    DAS_DEF = 261,
-    DAS_WHILE = 262,
-    DAS_IF = 263,
-    DAS_ELSE = 264,
-    DAS_FOR = 265,
-    DAS_CATCH = 266,
-    DAS_TRUE = 267,
-    DAS_FALSE = 268,
-    DAS_NEWT = 269,
-    DAS_TYPEINFO = 270,
-    DAS_TYPE = 271,
-    DAS_IN = 272,
-    DAS_ELIF = 273,
-    DAS_ARRAY = 274,
-    DAS_RETURN = 275,
-    DAS_NULL = 276,
-    DAS_BREAK = 277,
-    DAS_TRY = 278,
-    DAS_OPTIONS = 279,
-    DAS_TABLE = 280,
-    DAS_EXPECT = 281,
-    DAS_CONST = 282,
-    DAS_REQUIRE = 283,
-    DAS_OPERATOR = 284,
-    DAS_ENUM = 285,
-    DAS_FINALLY = 286,
-    DAS_DELETE = 287,
-    DAS_DEREF = 288,
-    DAS_SCOPE = 289,
-    DAS_TYPEDEF = 290,
-    DAS_WITH = 291,
-    DAS_CAST = 292,
-    DAS_OVERRIDE = 293,
-    DAS_UPCAST = 294,
-    DAS_ITERATOR = 295,
-    DAS_VAR = 296,
-    DAS_ADDR = 297,
-    DAS_CONTINUE = 298,
-    DAS_WHERE = 299,
-    DAS_REINTERPRET = 300,
-    DAS_TBOOL = 301,
-    DAS_TVOID = 302,
-    DAS_TSTRING = 303,
-    DAS_TAUTO = 304,
-    DAS_TINT = 305,
-    DAS_TINT2 = 306,
-    DAS_TINT3 = 307,
-    DAS_TINT4 = 308,
-    DAS_TUINT = 309,
-    DAS_TUINT2 = 310,
-    DAS_TUINT3 = 311,
-    DAS_TUINT4 = 312,
-    DAS_TFLOAT = 313,
-    DAS_TFLOAT2 = 314,
-    DAS_TFLOAT3 = 315,
-    DAS_TFLOAT4 = 316,
-    DAS_TRANGE = 317,
-    DAS_TURANGE = 318,
-    DAS_TBLOCK = 319,
-    DAS_TINT64 = 320,
-    DAS_TUINT64 = 321,
-    DAS_TDOUBLE = 322,
-    DAS_TFUNCTION = 323,
-    DAS_TLAMBDA = 324,
-    DAS_TINT8 = 325,
-    DAS_TUINT8 = 326,
-    DAS_TINT16 = 327,
-    DAS_TUINT16 = 328,
-    DAS_TTUPLE = 329,
-    ADDEQU = 330,
-    SUBEQU = 331,
-    DIVEQU = 332,
-    MULEQU = 333,
-    MODEQU = 334,
-    ANDEQU = 335,
-    OREQU = 336,
-    XOREQU = 337,
-    SHL = 338,
-    SHR = 339,
-    ADDADD = 340,
-    SUBSUB = 341,
-    LEEQU = 342,
-    SHLEQU = 343,
-    SHREQU = 344,
-    GREQU = 345,
-    EQUEQU = 346,
-    NOTEQU = 347,
-    RARROW = 348,
-    LARROW = 349,
-    QQ = 350,
-    QDOT = 351,
-    LPIPE = 352,
-    LBPIPE = 353,
-    RPIPE = 354,
-    CLONEEQU = 355,
-    ROTL = 356,
-    ROTR = 357,
-    ROTLEQU = 358,
-    ROTREQU = 359,
-    INTEGER = 360,
-    LONG_INTEGER = 361,
-    UNSIGNED_INTEGER = 362,
-    UNSIGNED_LONG_INTEGER = 363,
-    FLOAT = 364,
-    DOUBLE = 365,
-    NAME = 366,
-    BEGIN_STRING = 367,
-    STRING_CHARACTER = 368,
-    END_STRING = 369,
-    BEGIN_STRING_EXPR = 370,
-    END_STRING_EXPR = 371,
-    UNARY_MINUS = 372,
-    UNARY_PLUS = 373,
-    PRE_INC = 374,
-    PRE_DEC = 375,
-    POST_INC = 376,
-    POST_DEC = 377,
-    COLCOL = 378
-  };
-#endif
-
-/* Value type.  */
-#if ! defined DAS_YYSTYPE && ! defined DAS_YYSTYPE_IS_DECLARED
-
-union DAS_YYSTYPE
+#include "ds_parser.hpp"
+/* Symbol kind.  */
+enum yysymbol_kind_t
 {
-#line 67 "src/parser/ds_parser.ypp" /* yacc.c:353  */
-
-    char                            ch;
-    bool                            b;
-    int32_t                         i;
-    uint32_t                        ui;
-    int64_t                         i64;
-    uint64_t                        ui64;
-    double                          d;
-	double                          fd;
-    string *                        s;
-    vector<string> *                pNameList;
-    VariableDeclaration *           pVarDecl;
-    vector<VariableDeclaration*> *  pVarDeclList;
-    TypeDecl *                      pTypeDecl;
-    Expression *                    pExpression;
-    Type                            type;
-    AnnotationArgument *            aa;
-    AnnotationArgumentList *        aaList;
-    AnnotationDeclaration *         fa;
-    AnnotationList *                faList;
-    MakeStruct *                    pMakeStruct;
-    Enumeration *                   pEnum;
-    Structure *                     pStructure;
-
-#line 343 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:353  */
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_LEXER_ERROR = 3,                /* LEXER_ERROR  */
+  YYSYMBOL_DAS_STRUCT = 4,                 /* DAS_STRUCT  */
+  YYSYMBOL_DAS_LET = 5,                    /* DAS_LET  */
+  YYSYMBOL_DAS_DEF = 6,                    /* DAS_DEF  */
+  YYSYMBOL_DAS_WHILE = 7,                  /* DAS_WHILE  */
+  YYSYMBOL_DAS_IF = 8,                     /* DAS_IF  */
+  YYSYMBOL_DAS_ELSE = 9,                   /* DAS_ELSE  */
+  YYSYMBOL_DAS_FOR = 10,                   /* DAS_FOR  */
+  YYSYMBOL_DAS_CATCH = 11,                 /* DAS_CATCH  */
+  YYSYMBOL_DAS_TRUE = 12,                  /* DAS_TRUE  */
+  YYSYMBOL_DAS_FALSE = 13,                 /* DAS_FALSE  */
+  YYSYMBOL_DAS_NEWT = 14,                  /* DAS_NEWT  */
+  YYSYMBOL_DAS_TYPEINFO = 15,              /* DAS_TYPEINFO  */
+  YYSYMBOL_DAS_TYPE = 16,                  /* DAS_TYPE  */
+  YYSYMBOL_DAS_IN = 17,                    /* DAS_IN  */
+  YYSYMBOL_DAS_ELIF = 18,                  /* DAS_ELIF  */
+  YYSYMBOL_DAS_ARRAY = 19,                 /* DAS_ARRAY  */
+  YYSYMBOL_DAS_RETURN = 20,                /* DAS_RETURN  */
+  YYSYMBOL_DAS_NULL = 21,                  /* DAS_NULL  */
+  YYSYMBOL_DAS_BREAK = 22,                 /* DAS_BREAK  */
+  YYSYMBOL_DAS_TRY = 23,                   /* DAS_TRY  */
+  YYSYMBOL_DAS_OPTIONS = 24,               /* DAS_OPTIONS  */
+  YYSYMBOL_DAS_TABLE = 25,                 /* DAS_TABLE  */
+  YYSYMBOL_DAS_EXPECT = 26,                /* DAS_EXPECT  */
+  YYSYMBOL_DAS_CONST = 27,                 /* DAS_CONST  */
+  YYSYMBOL_DAS_REQUIRE = 28,               /* DAS_REQUIRE  */
+  YYSYMBOL_DAS_OPERATOR = 29,              /* DAS_OPERATOR  */
+  YYSYMBOL_DAS_ENUM = 30,                  /* DAS_ENUM  */
+  YYSYMBOL_DAS_FINALLY = 31,               /* DAS_FINALLY  */
+  YYSYMBOL_DAS_DELETE = 32,                /* DAS_DELETE  */
+  YYSYMBOL_DAS_DEREF = 33,                 /* DAS_DEREF  */
+  YYSYMBOL_DAS_SCOPE = 34,                 /* DAS_SCOPE  */
+  YYSYMBOL_DAS_TYPEDEF = 35,               /* DAS_TYPEDEF  */
+  YYSYMBOL_DAS_WITH = 36,                  /* DAS_WITH  */
+  YYSYMBOL_DAS_CAST = 37,                  /* DAS_CAST  */
+  YYSYMBOL_DAS_OVERRIDE = 38,              /* DAS_OVERRIDE  */
+  YYSYMBOL_DAS_UPCAST = 39,                /* DAS_UPCAST  */
+  YYSYMBOL_DAS_ITERATOR = 40,              /* DAS_ITERATOR  */
+  YYSYMBOL_DAS_VAR = 41,                   /* DAS_VAR  */
+  YYSYMBOL_DAS_ADDR = 42,                  /* DAS_ADDR  */
+  YYSYMBOL_DAS_CONTINUE = 43,              /* DAS_CONTINUE  */
+  YYSYMBOL_DAS_WHERE = 44,                 /* DAS_WHERE  */
+  YYSYMBOL_DAS_REINTERPRET = 45,           /* DAS_REINTERPRET  */
+  YYSYMBOL_DAS_TBOOL = 46,                 /* DAS_TBOOL  */
+  YYSYMBOL_DAS_TVOID = 47,                 /* DAS_TVOID  */
+  YYSYMBOL_DAS_TSTRING = 48,               /* DAS_TSTRING  */
+  YYSYMBOL_DAS_TAUTO = 49,                 /* DAS_TAUTO  */
+  YYSYMBOL_DAS_TINT = 50,                  /* DAS_TINT  */
+  YYSYMBOL_DAS_TINT2 = 51,                 /* DAS_TINT2  */
+  YYSYMBOL_DAS_TINT3 = 52,                 /* DAS_TINT3  */
+  YYSYMBOL_DAS_TINT4 = 53,                 /* DAS_TINT4  */
+  YYSYMBOL_DAS_TUINT = 54,                 /* DAS_TUINT  */
+  YYSYMBOL_DAS_TUINT2 = 55,                /* DAS_TUINT2  */
+  YYSYMBOL_DAS_TUINT3 = 56,                /* DAS_TUINT3  */
+  YYSYMBOL_DAS_TUINT4 = 57,                /* DAS_TUINT4  */
+  YYSYMBOL_DAS_TFLOAT = 58,                /* DAS_TFLOAT  */
+  YYSYMBOL_DAS_TFLOAT2 = 59,               /* DAS_TFLOAT2  */
+  YYSYMBOL_DAS_TFLOAT3 = 60,               /* DAS_TFLOAT3  */
+  YYSYMBOL_DAS_TFLOAT4 = 61,               /* DAS_TFLOAT4  */
+  YYSYMBOL_DAS_TRANGE = 62,                /* DAS_TRANGE  */
+  YYSYMBOL_DAS_TURANGE = 63,               /* DAS_TURANGE  */
+  YYSYMBOL_DAS_TBLOCK = 64,                /* DAS_TBLOCK  */
+  YYSYMBOL_DAS_TINT64 = 65,                /* DAS_TINT64  */
+  YYSYMBOL_DAS_TUINT64 = 66,               /* DAS_TUINT64  */
+  YYSYMBOL_DAS_TDOUBLE = 67,               /* DAS_TDOUBLE  */
+  YYSYMBOL_DAS_TFUNCTION = 68,             /* DAS_TFUNCTION  */
+  YYSYMBOL_DAS_TLAMBDA = 69,               /* DAS_TLAMBDA  */
+  YYSYMBOL_DAS_TINT8 = 70,                 /* DAS_TINT8  */
+  YYSYMBOL_DAS_TUINT8 = 71,                /* DAS_TUINT8  */
+  YYSYMBOL_DAS_TINT16 = 72,                /* DAS_TINT16  */
+  YYSYMBOL_DAS_TUINT16 = 73,               /* DAS_TUINT16  */
+  YYSYMBOL_DAS_TTUPLE = 74,                /* DAS_TTUPLE  */
+  YYSYMBOL_ADDEQU = 75,                    /* ADDEQU  */
+  YYSYMBOL_SUBEQU = 76,                    /* SUBEQU  */
+  YYSYMBOL_DIVEQU = 77,                    /* DIVEQU  */
+  YYSYMBOL_MULEQU = 78,                    /* MULEQU  */
+  YYSYMBOL_MODEQU = 79,                    /* MODEQU  */
+  YYSYMBOL_ANDEQU = 80,                    /* ANDEQU  */
+  YYSYMBOL_OREQU = 81,                     /* OREQU  */
+  YYSYMBOL_XOREQU = 82,                    /* XOREQU  */
+  YYSYMBOL_SHL = 83,                       /* SHL  */
+  YYSYMBOL_SHR = 84,                       /* SHR  */
+  YYSYMBOL_ADDADD = 85,                    /* ADDADD  */
+  YYSYMBOL_SUBSUB = 86,                    /* SUBSUB  */
+  YYSYMBOL_LEEQU = 87,                     /* LEEQU  */
+  YYSYMBOL_SHLEQU = 88,                    /* SHLEQU  */
+  YYSYMBOL_SHREQU = 89,                    /* SHREQU  */
+  YYSYMBOL_GREQU = 90,                     /* GREQU  */
+  YYSYMBOL_EQUEQU = 91,                    /* EQUEQU  */
+  YYSYMBOL_NOTEQU = 92,                    /* NOTEQU  */
+  YYSYMBOL_RARROW = 93,                    /* RARROW  */
+  YYSYMBOL_LARROW = 94,                    /* LARROW  */
+  YYSYMBOL_QQ = 95,                        /* QQ  */
+  YYSYMBOL_QDOT = 96,                      /* QDOT  */
+  YYSYMBOL_LPIPE = 97,                     /* LPIPE  */
+  YYSYMBOL_LBPIPE = 98,                    /* LBPIPE  */
+  YYSYMBOL_RPIPE = 99,                     /* RPIPE  */
+  YYSYMBOL_CLONEEQU = 100,                 /* CLONEEQU  */
+  YYSYMBOL_ROTL = 101,                     /* ROTL  */
+  YYSYMBOL_ROTR = 102,                     /* ROTR  */
+  YYSYMBOL_ROTLEQU = 103,                  /* ROTLEQU  */
+  YYSYMBOL_ROTREQU = 104,                  /* ROTREQU  */
+  YYSYMBOL_INTEGER = 105,                  /* INTEGER  */
+  YYSYMBOL_LONG_INTEGER = 106,             /* LONG_INTEGER  */
+  YYSYMBOL_UNSIGNED_INTEGER = 107,         /* UNSIGNED_INTEGER  */
+  YYSYMBOL_UNSIGNED_LONG_INTEGER = 108,    /* UNSIGNED_LONG_INTEGER  */
+  YYSYMBOL_FLOAT = 109,                    /* FLOAT  */
+  YYSYMBOL_DOUBLE = 110,                   /* DOUBLE  */
+  YYSYMBOL_NAME = 111,                     /* NAME  */
+  YYSYMBOL_BEGIN_STRING = 112,             /* BEGIN_STRING  */
+  YYSYMBOL_STRING_CHARACTER = 113,         /* STRING_CHARACTER  */
+  YYSYMBOL_END_STRING = 114,               /* END_STRING  */
+  YYSYMBOL_BEGIN_STRING_EXPR = 115,        /* BEGIN_STRING_EXPR  */
+  YYSYMBOL_END_STRING_EXPR = 116,          /* END_STRING_EXPR  */
+  YYSYMBOL_117_ = 117,                     /* ','  */
+  YYSYMBOL_118_ = 118,                     /* '='  */
+  YYSYMBOL_119_ = 119,                     /* '?'  */
+  YYSYMBOL_120_ = 120,                     /* ':'  */
+  YYSYMBOL_121_ = 121,                     /* '|'  */
+  YYSYMBOL_122_ = 122,                     /* '^'  */
+  YYSYMBOL_123_ = 123,                     /* '&'  */
+  YYSYMBOL_124_ = 124,                     /* '<'  */
+  YYSYMBOL_125_ = 125,                     /* '>'  */
+  YYSYMBOL_126_ = 126,                     /* '-'  */
+  YYSYMBOL_127_ = 127,                     /* '+'  */
+  YYSYMBOL_128_ = 128,                     /* '*'  */
+  YYSYMBOL_129_ = 129,                     /* '/'  */
+  YYSYMBOL_130_ = 130,                     /* '%'  */
+  YYSYMBOL_131_ = 131,                     /* '@'  */
+  YYSYMBOL_UNARY_MINUS = 132,              /* UNARY_MINUS  */
+  YYSYMBOL_UNARY_PLUS = 133,               /* UNARY_PLUS  */
+  YYSYMBOL_134_ = 134,                     /* '~'  */
+  YYSYMBOL_135_ = 135,                     /* '!'  */
+  YYSYMBOL_PRE_INC = 136,                  /* PRE_INC  */
+  YYSYMBOL_PRE_DEC = 137,                  /* PRE_DEC  */
+  YYSYMBOL_POST_INC = 138,                 /* POST_INC  */
+  YYSYMBOL_POST_DEC = 139,                 /* POST_DEC  */
+  YYSYMBOL_140_ = 140,                     /* '.'  */
+  YYSYMBOL_141_ = 141,                     /* '['  */
+  YYSYMBOL_142_ = 142,                     /* ']'  */
+  YYSYMBOL_143_ = 143,                     /* '('  */
+  YYSYMBOL_144_ = 144,                     /* ')'  */
+  YYSYMBOL_COLCOL = 145,                   /* COLCOL  */
+  YYSYMBOL_146_ = 146,                     /* ';'  */
+  YYSYMBOL_147_ = 147,                     /* '{'  */
+  YYSYMBOL_148_ = 148,                     /* '}'  */
+  YYSYMBOL_149_ = 149,                     /* '$'  */
+  YYSYMBOL_YYACCEPT = 150,                 /* $accept  */
+  YYSYMBOL_program = 151,                  /* program  */
+  YYSYMBOL_character_sequence = 152,       /* character_sequence  */
+  YYSYMBOL_string_constant = 153,          /* string_constant  */
+  YYSYMBOL_string_builder_body = 154,      /* string_builder_body  */
+  YYSYMBOL_string_builder = 155,           /* string_builder  */
+  YYSYMBOL_options_declaration = 156,      /* options_declaration  */
+  YYSYMBOL_require_declaration = 157,      /* require_declaration  */
+  YYSYMBOL_require_list = 158,             /* require_list  */
+  YYSYMBOL_require_module = 159,           /* require_module  */
+  YYSYMBOL_expect_declaration = 160,       /* expect_declaration  */
+  YYSYMBOL_expect_list = 161,              /* expect_list  */
+  YYSYMBOL_expect_error = 162,             /* expect_error  */
+  YYSYMBOL_expression_else = 163,          /* expression_else  */
+  YYSYMBOL_expression_if_then_else = 164,  /* expression_if_then_else  */
+  YYSYMBOL_expression_for_loop = 165,      /* expression_for_loop  */
+  YYSYMBOL_expression_while_loop = 166,    /* expression_while_loop  */
+  YYSYMBOL_expression_with = 167,          /* expression_with  */
+  YYSYMBOL_annotation_argument = 168,      /* annotation_argument  */
+  YYSYMBOL_annotation_argument_list = 169, /* annotation_argument_list  */
+  YYSYMBOL_annotation_declaration_name = 170, /* annotation_declaration_name  */
+  YYSYMBOL_annotation_declaration = 171,   /* annotation_declaration  */
+  YYSYMBOL_annotation_list = 172,          /* annotation_list  */
+  YYSYMBOL_optional_annotation_list = 173, /* optional_annotation_list  */
+  YYSYMBOL_optional_function_argument_list = 174, /* optional_function_argument_list  */
+  YYSYMBOL_optional_function_type = 175,   /* optional_function_type  */
+  YYSYMBOL_function_name = 176,            /* function_name  */
+  YYSYMBOL_function_declaration = 177,     /* function_declaration  */
+  YYSYMBOL_expression_block = 178,         /* expression_block  */
+  YYSYMBOL_expression_any = 179,           /* expression_any  */
+  YYSYMBOL_expressions = 180,              /* expressions  */
+  YYSYMBOL_expr_pipe = 181,                /* expr_pipe  */
+  YYSYMBOL_name_in_namespace = 182,        /* name_in_namespace  */
+  YYSYMBOL_expression_delete = 183,        /* expression_delete  */
+  YYSYMBOL_expr_new = 184,                 /* expr_new  */
+  YYSYMBOL_expression_break = 185,         /* expression_break  */
+  YYSYMBOL_expression_continue = 186,      /* expression_continue  */
+  YYSYMBOL_expression_return = 187,        /* expression_return  */
+  YYSYMBOL_expression_try_catch = 188,     /* expression_try_catch  */
+  YYSYMBOL_let_scope = 189,                /* let_scope  */
+  YYSYMBOL_kwd_let = 190,                  /* kwd_let  */
+  YYSYMBOL_expression_let = 191,           /* expression_let  */
+  YYSYMBOL_expr_cast = 192,                /* expr_cast  */
+  YYSYMBOL_expr_type_info = 193,           /* expr_type_info  */
+  YYSYMBOL_expr_list = 194,                /* expr_list  */
+  YYSYMBOL_expr_block = 195,               /* expr_block  */
+  YYSYMBOL_expr_numeric_const = 196,       /* expr_numeric_const  */
+  YYSYMBOL_expr_assign = 197,              /* expr_assign  */
+  YYSYMBOL_expr_named_call = 198,          /* expr_named_call  */
+  YYSYMBOL_expr_method_call = 199,         /* expr_method_call  */
+  YYSYMBOL_expr = 200,                     /* expr  */
+  YYSYMBOL_optional_field_annotation = 201, /* optional_field_annotation  */
+  YYSYMBOL_optional_override = 202,        /* optional_override  */
+  YYSYMBOL_structure_variable_declaration = 203, /* structure_variable_declaration  */
+  YYSYMBOL_struct_variable_declaration_list = 204, /* struct_variable_declaration_list  */
+  YYSYMBOL_function_argument_declaration = 205, /* function_argument_declaration  */
+  YYSYMBOL_function_argument_list = 206,   /* function_argument_list  */
+  YYSYMBOL_tuple_type = 207,               /* tuple_type  */
+  YYSYMBOL_tuple_type_list = 208,          /* tuple_type_list  */
+  YYSYMBOL_copy_or_move = 209,             /* copy_or_move  */
+  YYSYMBOL_variable_declaration = 210,     /* variable_declaration  */
+  YYSYMBOL_let_variable_declaration = 211, /* let_variable_declaration  */
+  YYSYMBOL_global_let = 212,               /* global_let  */
+  YYSYMBOL_enum_list = 213,                /* enum_list  */
+  YYSYMBOL_alias_declaration = 214,        /* alias_declaration  */
+  YYSYMBOL_enum_declaration = 215,         /* enum_declaration  */
+  YYSYMBOL_optional_structure_parent = 216, /* optional_structure_parent  */
+  YYSYMBOL_structure_name = 217,           /* structure_name  */
+  YYSYMBOL_structure_declaration = 218,    /* structure_declaration  */
+  YYSYMBOL_variable_name_list = 219,       /* variable_name_list  */
+  YYSYMBOL_basic_type_declaration = 220,   /* basic_type_declaration  */
+  YYSYMBOL_structure_type_declaration = 221, /* structure_type_declaration  */
+  YYSYMBOL_auto_type_declaration = 222,    /* auto_type_declaration  */
+  YYSYMBOL_type_declaration = 223,         /* type_declaration  */
+  YYSYMBOL_make_decl = 224,                /* make_decl  */
+  YYSYMBOL_make_struct_fields = 225,       /* make_struct_fields  */
+  YYSYMBOL_make_struct_dim = 226,          /* make_struct_dim  */
+  YYSYMBOL_make_struct_decl = 227,         /* make_struct_decl  */
+  YYSYMBOL_make_tuple = 228,               /* make_tuple  */
+  YYSYMBOL_make_dim = 229,                 /* make_dim  */
+  YYSYMBOL_make_dim_decl = 230,            /* make_dim_decl  */
+  YYSYMBOL_array_comprehension_where = 231, /* array_comprehension_where  */
+  YYSYMBOL_array_comprehension = 232       /* array_comprehension  */
 };
+typedef enum yysymbol_kind_t yysymbol_kind_t;
 
-typedef union DAS_YYSTYPE DAS_YYSTYPE;
-# define DAS_YYSTYPE_IS_TRIVIAL 1
-# define DAS_YYSTYPE_IS_DECLARED 1
-#endif
 
-/* Location type.  */
-#if ! defined DAS_YYLTYPE && ! defined DAS_YYLTYPE_IS_DECLARED
-typedef struct DAS_YYLTYPE DAS_YYLTYPE;
-struct DAS_YYLTYPE
-{
-  int first_line;
-  int first_column;
-  int last_line;
-  int last_column;
-};
-# define DAS_YYLTYPE_IS_DECLARED 1
-# define DAS_YYLTYPE_IS_TRIVIAL 1
-#endif
 
 
-extern DAS_YYSTYPE das_yylval;
-extern DAS_YYLTYPE das_yylloc;
-int das_yyparse (void);
+#ifdef short
+# undef short
+#endif
 
-#endif /* !YY_DAS_YY_C_USERS_BORIS_WORK_YZG_GENERATED_DS_PARSER_HPP_INCLUDED  */
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
 
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
 
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
 
-#ifdef short
-# undef short
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
 #endif
 
-#ifdef YYTYPE_UINT8
-typedef YYTYPE_UINT8 yytype_uint8;
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
 #else
-typedef unsigned char yytype_uint8;
+typedef short yytype_int16;
 #endif
 
-#ifdef YYTYPE_INT8
-typedef YYTYPE_INT8 yytype_int8;
-#else
-typedef signed char yytype_int8;
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
 #endif
 
-#ifdef YYTYPE_UINT16
-typedef YYTYPE_UINT16 yytype_uint16;
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
 #else
-typedef unsigned short yytype_uint16;
+typedef short yytype_uint8;
 #endif
 
-#ifdef YYTYPE_INT16
-typedef YYTYPE_INT16 yytype_int16;
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
 #else
-typedef short yytype_int16;
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
 #endif
 
 #ifndef YYSIZE_T
@@ -403,7 +456,7 @@ typedef short yytype_int16;
 #  define YYSIZE_T __SIZE_TYPE__
 # elif defined size_t
 #  define YYSIZE_T size_t
-# elif ! defined YYSIZE_T
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
 #  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
 #  define YYSIZE_T size_t
 # else
@@ -411,7 +464,20 @@ typedef short yytype_int16;
 # endif
 #endif
 
-#define YYSIZE_MAXIMUM ((YYSIZE_T) -1)
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
 
 #ifndef YY_
 # if defined YYENABLE_NLS && YYENABLE_NLS
@@ -425,38 +491,43 @@ typedef short yytype_int16;
 # endif
 #endif
 
-#ifndef YY_ATTRIBUTE
-# if (defined __GNUC__                                               \
-      && (2 < __GNUC__ || (__GNUC__ == 2 && 96 <= __GNUC_MINOR__)))  \
-     || defined __SUNPRO_C && 0x5110 <= __SUNPRO_C
-#  define YY_ATTRIBUTE(Spec) __attribute__(Spec)
-# else
-#  define YY_ATTRIBUTE(Spec) /* empty */
-# endif
-#endif
 
 #ifndef YY_ATTRIBUTE_PURE
-# define YY_ATTRIBUTE_PURE   YY_ATTRIBUTE ((__pure__))
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
 #endif
 
 #ifndef YY_ATTRIBUTE_UNUSED
-# define YY_ATTRIBUTE_UNUSED YY_ATTRIBUTE ((__unused__))
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(E) ((void) (E))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(E) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-#if defined __GNUC__ && ! defined __ICC && 407 <= __GNUC__ * 100 + __GNUC_MINOR__
 /* Suppress an incorrect diagnostic about yylval being uninitialized.  */
-# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN \
-    _Pragma ("GCC diagnostic push") \
-    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")\
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
     _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
-# define YY_IGNORE_MAYBE_UNINITIALIZED_END \
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
     _Pragma ("GCC diagnostic pop")
 #else
 # define YY_INITIAL_VALUE(Value) Value
@@ -469,8 +540,22 @@ typedef short yytype_int16;
 # define YY_INITIAL_VALUE(Value) /* Nothing. */
 #endif
 
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
 
 /* The parser invokes alloca or malloc; define the necessary symbols.  */
 
@@ -535,8 +620,7 @@ void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* !defined yyoverflow */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
@@ -546,18 +630,19 @@ void free (void *); /* INFRINGES ON USER NAME SPACE */
 /* A type that is properly aligned for any stack member.  */
 union yyalloc
 {
-  yytype_int16 yyss_alloc;
+  yy_state_t yyss_alloc;
   YYSTYPE yyvs_alloc;
   YYLTYPE yyls_alloc;
 };
 
 /* The size of the maximum gap between one aligned stack and the next.  */
-# define YYSTACK_GAP_MAXIMUM (sizeof (union yyalloc) - 1)
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
 
 /* The size of an array large to enough to hold all stacks, each with
    N elements.  */
 # define YYSTACK_BYTES(N) \
-     ((N) * (sizeof (yytype_int16) + sizeof (YYSTYPE) + sizeof (YYLTYPE)) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE) \
+             + YYSIZEOF (YYLTYPE)) \
       + 2 * YYSTACK_GAP_MAXIMUM)
 
 # define YYCOPY_NEEDED 1
@@ -570,11 +655,11 @@ union yyalloc
 # define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
     do                                                                  \
       {                                                                 \
-        YYSIZE_T yynewbytes;                                            \
+        YYPTRDIFF_T yynewbytes;                                         \
         YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
         Stack = &yyptr->Stack_alloc;                                    \
-        yynewbytes = yystacksize * sizeof (*Stack) + YYSTACK_GAP_MAXIMUM; \
-        yyptr += yynewbytes / sizeof (*yyptr);                          \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
       }                                                                 \
     while (0)
 
@@ -586,12 +671,12 @@ union yyalloc
 # ifndef YYCOPY
 #  if defined __GNUC__ && 1 < __GNUC__
 #   define YYCOPY(Dst, Src, Count) \
-      __builtin_memcpy (Dst, Src, (Count) * sizeof (*(Src)))
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
 #  else
 #   define YYCOPY(Dst, Src, Count)              \
       do                                        \
         {                                       \
-          YYSIZE_T yyi;                         \
+          YYPTRDIFF_T yyi;                      \
           for (yyi = 0; yyi < (Count); yyi++)   \
             (Dst)[yyi] = (Src)[yyi];            \
         }                                       \
@@ -603,27 +688,30 @@ union yyalloc
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  2
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   3988
+#define YYLAST   3995
 
 /* YYNTOKENS -- Number of terminals.  */
 #define YYNTOKENS  150
 /* YYNNTS -- Number of nonterminals.  */
 #define YYNNTS  83
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  330
+#define YYNRULES  331
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  593
+#define YYNSTATES  597
 
-/* YYTRANSLATE[YYX] -- Symbol number corresponding to YYX as returned
-   by yylex, with out-of-bounds checking.  */
-#define YYUNDEFTOK  2
+/* YYMAXUTOK -- Last valid token kind.  */
 #define YYMAXUTOK   378
 
-#define YYTRANSLATE(YYX)                                                \
-  ((unsigned) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
 
 /* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
-   as returned by yylex, without out-of-bounds checking.  */
+   as returned by yylex.  */
 static const yytype_uint8 yytranslate[] =
 {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -667,10 +755,10 @@ static const yytype_uint8 yytranslate[] =
 };
 
 #if DAS_YYDEBUG
-  /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
-static const yytype_uint16 yyrline[] =
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
 {
-       0,   246,   246,   248,   249,   250,   251,   252,   253,   254,
+       0,   247,   247,   248,   249,   250,   251,   252,   253,   254,
      255,   259,   260,   264,   268,   271,   280,   288,   304,   325,
      329,   330,   334,   344,   348,   349,   353,   356,   362,   363,
      364,   371,   378,   390,   400,   409,   410,   411,   412,   413,
@@ -700,51 +788,59 @@ static const yytype_uint16 yyrline[] =
     1351,  1352,  1353,  1354,  1355,  1356,  1357,  1358,  1359,  1360,
     1361,  1362,  1363,  1364,  1365,  1366,  1367,  1371,  1381,  1385,
     1395,  1396,  1397,  1398,  1411,  1416,  1421,  1426,  1431,  1436,
-    1443,  1447,  1452,  1458,  1463,  1467,  1472,  1481,  1485,  1490,
-    1499,  1503,  1508,  1517,  1526,  1527,  1528,  1532,  1539,  1548,
-    1553,  1560,  1565,  1574,  1577,  1591,  1596,  1603,  1611,  1612,
-    1616
+    1443,  1447,  1452,  1462,  1468,  1473,  1477,  1482,  1491,  1495,
+    1500,  1509,  1513,  1518,  1527,  1536,  1537,  1538,  1542,  1549,
+    1558,  1563,  1570,  1575,  1584,  1587,  1601,  1606,  1613,  1621,
+    1622,  1626
 };
 #endif
 
-#if DAS_YYDEBUG || YYERROR_VERBOSE || 0
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if DAS_YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "$end", "error", "$undefined", "LEXER_ERROR", "DAS_STRUCT", "DAS_LET",
-  "DAS_DEF", "DAS_WHILE", "DAS_IF", "DAS_ELSE", "DAS_FOR", "DAS_CATCH",
-  "DAS_TRUE", "DAS_FALSE", "DAS_NEWT", "DAS_TYPEINFO", "DAS_TYPE",
-  "DAS_IN", "DAS_ELIF", "DAS_ARRAY", "DAS_RETURN", "DAS_NULL", "DAS_BREAK",
-  "DAS_TRY", "DAS_OPTIONS", "DAS_TABLE", "DAS_EXPECT", "DAS_CONST",
-  "DAS_REQUIRE", "DAS_OPERATOR", "DAS_ENUM", "DAS_FINALLY", "DAS_DELETE",
-  "DAS_DEREF", "DAS_SCOPE", "DAS_TYPEDEF", "DAS_WITH", "DAS_CAST",
-  "DAS_OVERRIDE", "DAS_UPCAST", "DAS_ITERATOR", "DAS_VAR", "DAS_ADDR",
-  "DAS_CONTINUE", "DAS_WHERE", "DAS_REINTERPRET", "DAS_TBOOL", "DAS_TVOID",
-  "DAS_TSTRING", "DAS_TAUTO", "DAS_TINT", "DAS_TINT2", "DAS_TINT3",
-  "DAS_TINT4", "DAS_TUINT", "DAS_TUINT2", "DAS_TUINT3", "DAS_TUINT4",
-  "DAS_TFLOAT", "DAS_TFLOAT2", "DAS_TFLOAT3", "DAS_TFLOAT4", "DAS_TRANGE",
-  "DAS_TURANGE", "DAS_TBLOCK", "DAS_TINT64", "DAS_TUINT64", "DAS_TDOUBLE",
-  "DAS_TFUNCTION", "DAS_TLAMBDA", "DAS_TINT8", "DAS_TUINT8", "DAS_TINT16",
-  "DAS_TUINT16", "DAS_TTUPLE", "ADDEQU", "SUBEQU", "DIVEQU", "MULEQU",
-  "MODEQU", "ANDEQU", "OREQU", "XOREQU", "SHL", "SHR", "ADDADD", "SUBSUB",
-  "LEEQU", "SHLEQU", "SHREQU", "GREQU", "EQUEQU", "NOTEQU", "RARROW",
-  "LARROW", "QQ", "QDOT", "LPIPE", "LBPIPE", "RPIPE", "CLONEEQU", "ROTL",
-  "ROTR", "ROTLEQU", "ROTREQU", "INTEGER", "LONG_INTEGER",
-  "UNSIGNED_INTEGER", "UNSIGNED_LONG_INTEGER", "FLOAT", "DOUBLE", "NAME",
-  "BEGIN_STRING", "STRING_CHARACTER", "END_STRING", "BEGIN_STRING_EXPR",
-  "END_STRING_EXPR", "','", "'='", "'?'", "':'", "'|'", "'^'", "'&'",
-  "'<'", "'>'", "'-'", "'+'", "'*'", "'/'", "'%'", "'@'", "UNARY_MINUS",
-  "UNARY_PLUS", "'~'", "'!'", "PRE_INC", "PRE_DEC", "POST_INC", "POST_DEC",
-  "'.'", "'['", "']'", "'('", "')'", "COLCOL", "';'", "'{'", "'}'", "'$'",
-  "$accept", "program", "character_sequence", "string_constant",
-  "string_builder_body", "string_builder", "options_declaration",
-  "require_declaration", "require_list", "require_module",
-  "expect_declaration", "expect_list", "expect_error", "expression_else",
-  "expression_if_then_else", "expression_for_loop",
-  "expression_while_loop", "expression_with", "annotation_argument",
-  "annotation_argument_list", "annotation_declaration_name",
-  "annotation_declaration", "annotation_list", "optional_annotation_list",
+  "\"end of file\"", "error", "\"invalid token\"", "LEXER_ERROR",
+  "DAS_STRUCT", "DAS_LET", "DAS_DEF", "DAS_WHILE", "DAS_IF", "DAS_ELSE",
+  "DAS_FOR", "DAS_CATCH", "DAS_TRUE", "DAS_FALSE", "DAS_NEWT",
+  "DAS_TYPEINFO", "DAS_TYPE", "DAS_IN", "DAS_ELIF", "DAS_ARRAY",
+  "DAS_RETURN", "DAS_NULL", "DAS_BREAK", "DAS_TRY", "DAS_OPTIONS",
+  "DAS_TABLE", "DAS_EXPECT", "DAS_CONST", "DAS_REQUIRE", "DAS_OPERATOR",
+  "DAS_ENUM", "DAS_FINALLY", "DAS_DELETE", "DAS_DEREF", "DAS_SCOPE",
+  "DAS_TYPEDEF", "DAS_WITH", "DAS_CAST", "DAS_OVERRIDE", "DAS_UPCAST",
+  "DAS_ITERATOR", "DAS_VAR", "DAS_ADDR", "DAS_CONTINUE", "DAS_WHERE",
+  "DAS_REINTERPRET", "DAS_TBOOL", "DAS_TVOID", "DAS_TSTRING", "DAS_TAUTO",
+  "DAS_TINT", "DAS_TINT2", "DAS_TINT3", "DAS_TINT4", "DAS_TUINT",
+  "DAS_TUINT2", "DAS_TUINT3", "DAS_TUINT4", "DAS_TFLOAT", "DAS_TFLOAT2",
+  "DAS_TFLOAT3", "DAS_TFLOAT4", "DAS_TRANGE", "DAS_TURANGE", "DAS_TBLOCK",
+  "DAS_TINT64", "DAS_TUINT64", "DAS_TDOUBLE", "DAS_TFUNCTION",
+  "DAS_TLAMBDA", "DAS_TINT8", "DAS_TUINT8", "DAS_TINT16", "DAS_TUINT16",
+  "DAS_TTUPLE", "ADDEQU", "SUBEQU", "DIVEQU", "MULEQU", "MODEQU", "ANDEQU",
+  "OREQU", "XOREQU", "SHL", "SHR", "ADDADD", "SUBSUB", "LEEQU", "SHLEQU",
+  "SHREQU", "GREQU", "EQUEQU", "NOTEQU", "RARROW", "LARROW", "QQ", "QDOT",
+  "LPIPE", "LBPIPE", "RPIPE", "CLONEEQU", "ROTL", "ROTR", "ROTLEQU",
+  "ROTREQU", "INTEGER", "LONG_INTEGER", "UNSIGNED_INTEGER",
+  "UNSIGNED_LONG_INTEGER", "FLOAT", "DOUBLE", "NAME", "BEGIN_STRING",
+  "STRING_CHARACTER", "END_STRING", "BEGIN_STRING_EXPR", "END_STRING_EXPR",
+  "','", "'='", "'?'", "':'", "'|'", "'^'", "'&'", "'<'", "'>'", "'-'",
+  "'+'", "'*'", "'/'", "'%'", "'@'", "UNARY_MINUS", "UNARY_PLUS", "'~'",
+  "'!'", "PRE_INC", "PRE_DEC", "POST_INC", "POST_DEC", "'.'", "'['", "']'",
+  "'('", "')'", "COLCOL", "';'", "'{'", "'}'", "'$'", "$accept", "program",
+  "character_sequence", "string_constant", "string_builder_body",
+  "string_builder", "options_declaration", "require_declaration",
+  "require_list", "require_module", "expect_declaration", "expect_list",
+  "expect_error", "expression_else", "expression_if_then_else",
+  "expression_for_loop", "expression_while_loop", "expression_with",
+  "annotation_argument", "annotation_argument_list",
+  "annotation_declaration_name", "annotation_declaration",
+  "annotation_list", "optional_annotation_list",
   "optional_function_argument_list", "optional_function_type",
   "function_name", "function_declaration", "expression_block",
   "expression_any", "expressions", "expr_pipe", "name_in_namespace",
@@ -766,111 +862,94 @@ static const char *const yytname[] =
   "make_tuple", "make_dim", "make_dim_decl", "array_comprehension_where",
   "array_comprehension", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[NUM] -- (External) token number corresponding to the
-   (internal) symbol number NUM (which must be that of a token).  */
-static const yytype_uint16 yytoknum[] =
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
 {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
-     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
-     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
-     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
-     355,   356,   357,   358,   359,   360,   361,   362,   363,   364,
-     365,   366,   367,   368,   369,   370,   371,    44,    61,    63,
-      58,   124,    94,    38,    60,    62,    45,    43,    42,    47,
-      37,    64,   372,   373,   126,    33,   374,   375,   376,   377,
-      46,    91,    93,    40,    41,   378,    59,   123,   125,    36
-};
-# endif
+  return yytname[yysymbol];
+}
+#endif
 
-#define YYPACT_NINF -378
+#define YYPACT_NINF (-391)
 
-#define yypact_value_is_default(Yystate) \
-  (!!((Yystate) == (-378)))
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
 
-#define YYTABLE_NINF -150
+#define YYTABLE_NINF (-150)
 
-#define yytable_value_is_error(Yytable_value) \
+#define yytable_value_is_error(Yyn) \
   0
 
-  /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-     STATE-NUM.  */
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-    -378,     9,  -378,  -378,   -57,   -48,   -49,    28,    34,  -378,
-      -2,  -378,  -378,  -378,   242,  -378,   -27,  -378,  -378,  -378,
-    -378,    73,  -378,   103,    93,   108,  -378,  -378,   114,  -378,
-     113,   122,  -378,    87,   152,   123,  -378,   -83,  -378,   156,
-      77,  -378,   203,   -57,   163,   -48,   -49,  -378,  2623,   159,
-    -378,   -57,    -2,  -378,   154,   130,  3324,   253,   254,  -378,
-     141,   -40,  -378,  -378,  -378,  -378,  -378,   172,  -378,  -378,
-    -378,  -378,  -378,   -93,   162,   164,   171,  -378,  -378,  -378,
-     144,  -378,  -378,  -378,  -378,  -378,  -378,  -378,  -378,  -378,
-    -378,  -378,  -378,  -378,  -378,   177,  -378,  -378,  -378,   182,
-     183,  -378,  -378,  -378,  -378,   186,  -378,  -378,  -378,  -378,
-      -7,  -378,   -76,  -378,   -84,  -378,  -378,  -378,  -378,  -378,
-    -378,  -378,  -378,  -378,  -378,  -378,  -378,  -378,  -378,  -378,
-    -378,  -378,  -378,  -378,  -378,  -378,  -378,  -378,  -378,  -378,
-    -378,  -378,  -378,  -378,  -378,  -378,  -378,  -378,  -378,  -378,
-    -378,  -378,  -378,    -9,   176,   -57,  -378,   266,   165,  -378,
-      85,   -75,  -378,  2623,  2623,  2623,   202,  2491,  2491,  2491,
-    2623,  -378,     3,  -378,  -378,  1199,  -378,  -378,    42,   205,
-    -378,  -378,  -378,   106,  -378,   110,  2623,   170,    68,  -378,
-     205,  -378,  -378,  -378,   219,  -378,   180,   206,   217,   178,
-     176,   237,   176,   312,   176,   319,  -378,   -79,    -7,   209,
-    -378,  -378,  -378,  2557,   190,  -378,   192,   213,   214,   198,
-     221,   200,  2321,  2321,  -378,  -378,  -378,  -378,  -378,  -378,
-    -378,  2321,  2321,   -84,  2321,  2321,   185,  -378,  2321,  -378,
-     207,  -378,  -378,   -80,  -378,  -378,  -378,  -378,  -378,  -378,
-    -378,  3377,   210,  -378,  -378,  -378,  -378,  -378,  -378,  -378,
-      17,  -378,   238,  -378,  2623,  2321,    -7,  -378,  -378,  -378,
-     204,  -378,  2623,  -378,  -378,   227,  -378,   230,  -378,   234,
-    -378,  -378,  2623,  -378,    98,  -378,   252,  2321,  2623,  2623,
-    2321,  2623,  1324,   645,   645,   143,   645,   645,  -378,   645,
-     645,    26,  2944,   649,   141,  -378,  1433,  2321,  2321,  -378,
-    -378,  2321,  2321,  2321,  2321,   257,  2321,   258,  2321,  2321,
-    2321,  2321,  2321,  2321,  2321,  2321,  2321,  2321,  2321,  2321,
-    2321,  2321,  2321,   259,  2321,  -378,  1542,  -378,  -378,   157,
-    -378,   267,  2773,  -378,   340,  -378,  -378,  -378,  -378,  1651,
-    1074,  3006,   347,   355,  3068,   368,  -378,  3130,  -378,  2321,
-     251,   205,   936,  -378,  -378,  2321,  2321,   205,  1760,  -378,
-     170,  2321,  2321,  -378,  -378,   342,  -378,  -378,  -378,  -378,
-    -378,  -378,   225,   229,   231,   235,  -378,   359,  -378,   -77,
-    2840,   176,   -71,  -378,    -3,  3601,  3832,  3832,  3794,  3794,
-    3774,  3774,   241,   645,  -378,    53,    53,  3832,  3832,  3497,
-    3653,  3705,  3725,  3794,  3794,  3847,  3847,   473,   473,   473,
-    -378,  3437,  -378,    31,  2321,   112,  2321,  2321,  2321,  2321,
-    2321,  2321,  2321,  2321,  2321,  2321,  2321,  2321,  2321,  2321,
-    2321,  -378,  -378,    62,  2623,   274,  3192,  -378,  2321,  2321,
-    -378,  2321,  -378,  3549,    -4,    84,  1869,  1994,  3601,   272,
-     -94,   273,    40,   501,   501,    12,  2321,  3601,   381,  3601,
-     501,   246,  -378,  -378,  -378,  -378,   360,   205,  -378,   170,
-      13,   105,  2321,  -378,  2103,  2321,  -378,  -378,  3601,  -378,
-    3601,  3601,  3601,  3601,  3601,  3601,  3601,  3601,  3601,  3601,
-    3601,  3601,  3601,  3601,  3601,  -378,    -8,   276,  -378,  3794,
-    3794,  3794,  -378,  2321,  2321,  2425,   291,   294,   264,   291,
-    2321,   269,  2321,  -378,    38,  2321,  3601,   170,  -378,  -378,
-    -378,  -378,   117,  -378,   285,  3601,  -378,    64,  3601,  -378,
-    2212,   -14,  3601,    63,    13,  -378,   272,  3601,  -378,   273,
-     170,  2321,  -378,    27,  -378,   798,  2623,  2321,  -378,  -378,
-    2623,  3254,  2321,   271,  2321,  -378,   501,   170,  -378,    78,
-    -378,  2629,    33,  -378,  2892,  -378,  3601,    38,  -378,  -378,
-    2321,  -378,  -378,   388,   297,  -378,  -378,  2701,  2321,   298,
-    -378,  3601,  -378
+    -391,    25,  -391,  -391,   -71,   -57,   -55,    24,    38,  -391,
+      -2,  -391,  -391,  -391,    98,  -391,    71,  -391,  -391,  -391,
+    -391,    34,  -391,    84,   110,   117,  -391,  -391,   126,  -391,
+     102,   142,  -391,   116,   152,   125,  -391,    29,  -391,   153,
+     108,  -391,   161,   -71,   164,   -57,   -55,  -391,  2586,   160,
+    -391,   -71,    -2,  -391,   154,   130,  3346,   250,   255,  -391,
+     144,    54,  -391,  -391,  -391,  -391,  -391,   175,  -391,  -391,
+    -391,  -391,  -391,   -83,   167,   170,   174,  -391,  -391,  -391,
+     158,  -391,  -391,  -391,  -391,  -391,  -391,  -391,  -391,  -391,
+    -391,  -391,  -391,  -391,  -391,   181,  -391,  -391,  -391,   183,
+     191,  -391,  -391,  -391,  -391,   194,   -95,  -391,  -391,  -391,
+    -391,   209,  -391,    48,  -391,   -88,  -391,  -391,  -391,  -391,
+    -391,  -391,  -391,  -391,  -391,  -391,  -391,  -391,  -391,  -391,
+    -391,  -391,  -391,  -391,  -391,  -391,  -391,  -391,  -391,  -391,
+    -391,  -391,  -391,  -391,  -391,  -391,  -391,  -391,  -391,  -391,
+    -391,  -391,  -391,  -391,    -8,   201,   -71,  -391,   284,   179,
+    -391,   -43,    -6,  -391,  2586,  2586,  2586,   216,  2454,  2454,
+    2454,  2586,  2586,  -391,     7,  -391,  -391,  1162,  -391,  -391,
+      62,   218,  -391,  -391,  -391,    79,  -391,   182,  2586,   184,
+      46,  -391,   218,  -391,  -391,  -391,   230,  -391,    88,   224,
+     112,   196,   201,   189,   201,   292,   201,   321,  -391,    59,
+     209,   328,   221,  -391,  -391,  -391,  2520,   199,  -391,   202,
+     228,   234,   211,   235,   220,  2284,  2284,  -391,  -391,  -391,
+    -391,  -391,  -391,  -391,  2284,  2284,   -88,  2284,  2284,   223,
+    -391,  2284,  -391,   227,  -391,  -391,   -80,  -391,  -391,  -391,
+    -391,  -391,  -391,  -391,  3399,   233,  -391,  -391,  -391,  -391,
+    -391,  -391,  -391,     3,  -391,   281,  -391,  2586,  2284,   209,
+    -391,  -391,  -391,   249,  -391,  2586,  -391,  -391,   236,  -391,
+     271,  -391,   277,  -391,  -391,  2586,  -391,  -391,    81,  -391,
+     293,  2284,  2586,  2586,  2284,  2586,  1287,   608,   608,   285,
+     608,   608,  -391,   608,   608,  2388,  2966,   612,   144,  -391,
+    1396,  2284,  2284,  -391,  -391,  2284,  2284,  2284,  2284,   294,
+    2284,   295,  2284,  2284,  2284,  2284,  2284,  2284,  2284,  2284,
+    2284,  2284,  2284,  2284,  2284,  2284,  2284,   296,  2284,  -391,
+    1505,  -391,  -391,   215,  -391,   305,  2736,  -391,   410,  -391,
+    -391,  -391,  -391,  1614,  1037,  3028,   423,   433,  3090,   436,
+    -391,  3152,  -391,  2284,   297,   218,   899,  -391,  -391,  2284,
+    2284,   218,  1723,  -391,   184,  2284,  2284,  -391,  -391,   377,
+    -391,  -391,  -391,  -391,  -391,  -391,   266,   270,   273,   274,
+    -391,   405,  -391,   -85,  2803,   201,   -72,  -391,    53,  3623,
+    3854,  3854,  3816,  3816,  3796,  3796,   280,   608,  -391,    49,
+      49,  3854,  3854,  3519,  3675,  3727,  3747,  3816,  3816,   501,
+     501,   381,   381,   381,  -391,  3459,  -391,    65,  2284,   103,
+    2284,  2284,  2284,  2284,  2284,  2284,  2284,  2284,  2284,  2284,
+    2284,  2284,  2284,  2284,  2284,  -391,  -391,    68,  2586,   315,
+    3214,  -391,  2284,  2284,  -391,  2284,  -391,  3571,    -1,   -77,
+    1832,  1957,  3623,   311,   -84,   312,     5,  2855,  2855,    10,
+    2284,  3623,   421,  3623,  2855,   287,  -391,  -391,  -391,  -391,
+     401,   218,  -391,   184,    73,    91,  2284,  -391,  2066,  2284,
+    -391,  -391,  3623,  -391,  3623,  3623,  3623,  3623,  3623,  3623,
+    3623,  3623,  3623,  3623,  3623,  3623,  3623,  3623,  3623,  -391,
+     -13,   314,  -391,  3816,  3816,  3816,  -391,  2284,  2284,    27,
+     325,   330,   301,   325,  2284,   303,  2284,  -391,    36,  2284,
+    3623,   184,  -391,  -391,  -391,  -391,   219,  -391,   304,  3623,
+    -391,    70,  3623,  -391,  2175,   -82,  3623,   113,    73,  -391,
+     311,  3623,  -391,   312,   184,  2284,  -391,   -74,  -391,   761,
+    2586,  2284,  -391,  -391,  2586,  3276,  2284,   307,  2284,  -391,
+    2855,   184,  -391,   121,  -391,  2592,   -12,  -391,  2914,  -391,
+    3623,    36,  -391,  -391,  2284,  -391,  -391,   408,   316,  -391,
+    -391,  2664,  2284,   319,  -391,  3623,  -391
 };
 
-  /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
-     Performed when YYTABLE does not specify something else to do.  Zero
-     means the default is an error.  */
-static const yytype_uint16 yydefact[] =
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int16 yydefact[] =
 {
        2,    49,     1,   129,     0,     0,     0,     0,     0,   130,
        0,     9,     8,     7,     0,     6,     0,     5,    10,     4,
@@ -881,593 +960,640 @@ static const yytype_uint16 yydefact[] =
       51,   225,    39,    40,    37,    38,    36,     0,    35,    42,
       27,    25,    21,     0,     0,     0,     0,   263,   283,   264,
      288,   265,   269,   270,   271,   272,   276,   277,   278,   279,
-     280,   281,   282,   284,   285,   304,   268,   275,   286,   307,
-     310,   266,   273,   267,   274,     0,   287,   290,   292,   291,
-     255,   114,     0,    48,     0,   259,   230,    59,    60,    62,
-      61,    63,    64,    65,    66,    85,    86,    83,    84,    76,
-      87,    88,    77,    74,    75,    89,    90,    91,    92,    79,
-      80,    78,    72,    73,    68,    67,    69,    70,    71,    58,
-      57,    81,    82,     0,    54,     0,   251,   227,     0,    11,
-       0,     0,   256,     0,     0,     0,     0,    51,    51,    51,
-       0,   295,     0,   300,   297,     0,    46,   258,   225,     0,
-     261,    52,   234,     0,   232,   241,     0,     0,     0,   228,
-       0,   231,    12,    13,     0,   253,     0,     0,     0,     0,
-      54,     0,    54,     0,    54,     0,   237,     0,   236,   296,
-     298,   173,   174,     0,     0,   168,     0,     0,     0,     0,
-       0,     0,     0,     0,   143,   145,   144,   146,   147,   148,
-      14,     0,     0,     0,     0,     0,     0,   294,     0,   109,
-      49,   171,   141,   169,   218,   217,   216,   221,   170,   220,
-     219,     0,     0,   172,   314,   315,   316,   260,   233,    53,
-       0,   240,     0,   239,     0,     0,    55,    93,   226,   229,
-       0,   301,     0,   303,   289,     0,   305,     0,   308,     0,
-     311,   313,     0,   299,   117,   120,     0,     0,     0,     0,
-       0,     0,     0,   197,   198,     0,   178,   177,   205,   176,
-     175,     0,     0,     0,    51,   224,     0,     0,     0,   199,
-     200,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     280,   281,   282,   284,   285,   305,   268,   275,   286,   308,
+     311,   266,   273,   267,   274,     0,   113,   287,   290,   292,
+     291,   255,   114,     0,    48,     0,   259,   230,    59,    60,
+      62,    61,    63,    64,    65,    66,    85,    86,    83,    84,
+      76,    87,    88,    77,    74,    75,    89,    90,    91,    92,
+      79,    80,    78,    72,    73,    68,    67,    69,    70,    71,
+      58,    57,    81,    82,     0,    54,     0,   251,   227,     0,
+      11,     0,     0,   256,     0,     0,     0,     0,    51,    51,
+      51,     0,     0,   295,     0,   300,   297,     0,    46,   258,
+     225,     0,   261,    52,   234,     0,   232,   241,     0,     0,
+       0,   228,     0,   231,    12,    13,     0,   253,     0,     0,
+       0,     0,    54,     0,    54,     0,    54,     0,   237,     0,
+     236,     0,   296,   298,   173,   174,     0,     0,   168,     0,
+       0,     0,     0,     0,     0,     0,     0,   143,   145,   144,
+     146,   147,   148,    14,     0,     0,     0,     0,     0,     0,
+     294,     0,   109,    49,   171,   141,   169,   218,   217,   216,
+     221,   170,   220,   219,     0,     0,   172,   315,   316,   317,
+     260,   233,    53,     0,   240,     0,   239,     0,     0,    55,
+      93,   226,   229,     0,   301,     0,   304,   289,     0,   306,
+       0,   309,     0,   312,   314,     0,   302,   299,   117,   120,
+       0,     0,     0,     0,     0,     0,     0,   197,   198,     0,
+     178,   177,   205,   176,   175,     0,     0,     0,    51,   224,
+       0,     0,     0,   199,   200,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   293,     0,   235,   262,   242,
-     245,     0,   244,   254,     0,   306,   309,   312,   238,     0,
-       0,     0,     0,     0,     0,     0,   212,     0,    17,     0,
-      15,     0,     0,   201,   111,     0,     0,     0,   123,   121,
-       0,     0,     0,   122,    96,    94,   107,   103,   101,   102,
-     110,    97,     0,     0,     0,     0,   108,   127,   100,     0,
-     149,    54,     0,   206,     0,   139,   179,   180,   192,   193,
-     190,   191,     0,   214,   204,   222,   223,   181,   182,     0,
-     195,   196,   194,   188,   189,   184,   183,   185,   186,   187,
-     203,     0,   208,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   293,
+       0,   235,   262,   242,   245,     0,   244,   254,     0,   307,
+     310,   313,   238,     0,     0,     0,     0,     0,     0,     0,
+     212,     0,    17,     0,    15,     0,     0,   201,   111,     0,
+       0,     0,   123,   121,     0,     0,     0,   122,    96,    94,
+     107,   103,   101,   102,   110,    97,     0,     0,     0,     0,
+     108,   127,   100,     0,   149,    54,     0,   206,     0,   139,
+     179,   180,   192,   193,   190,   191,     0,   214,   204,   222,
+     223,   181,   182,     0,   195,   196,   194,   188,   189,   184,
+     183,   185,   186,   187,   203,     0,   208,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   302,   118,     0,     0,     0,     0,   210,     0,     0,
-     211,     0,   213,     0,     0,   113,     0,     0,   323,   319,
-       0,   325,     0,     0,     0,     0,     0,   124,     0,   116,
-       0,     0,    99,   104,   105,   106,     0,     0,    98,     0,
-       0,     0,     0,   207,     0,     0,   202,   209,   243,   112,
-     156,   157,   159,   158,   160,   153,   154,   155,   161,   162,
-     151,   152,   163,   164,   150,   119,     0,     0,   135,   132,
-     133,   134,    16,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,    33,    28,     0,   125,     0,    34,   109,
-     128,   131,     0,   142,     0,   140,   166,     0,   215,   137,
-       0,     0,   317,     0,     0,   321,   320,   324,   327,   326,
-       0,     0,    31,     0,   126,     0,     0,     0,   165,   167,
-       0,     0,     0,     0,     0,    29,     0,     0,    95,     0,
-     250,   149,     0,   136,   328,   322,   318,    28,    32,   246,
-       0,   249,   138,     0,     0,    30,   248,   149,     0,     0,
-     247,   329,   330
+       0,     0,     0,     0,     0,   303,   118,     0,     0,     0,
+       0,   210,     0,     0,   211,     0,   213,     0,     0,   113,
+       0,     0,   324,   320,     0,   326,     0,     0,     0,     0,
+       0,   124,     0,   116,     0,     0,    99,   104,   105,   106,
+       0,     0,    98,     0,     0,     0,     0,   207,     0,     0,
+     202,   209,   243,   112,   156,   157,   159,   158,   160,   153,
+     154,   155,   161,   162,   151,   152,   163,   164,   150,   119,
+       0,     0,   135,   132,   133,   134,    16,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    33,    28,     0,
+     125,     0,    34,   109,   128,   131,     0,   142,     0,   140,
+     166,     0,   215,   137,     0,     0,   318,     0,     0,   322,
+     321,   325,   328,   327,     0,     0,    31,     0,   126,     0,
+       0,     0,   165,   167,     0,     0,     0,     0,     0,    29,
+       0,     0,    95,     0,   250,   149,     0,   136,   329,   323,
+     319,    28,    32,   246,     0,   249,   138,     0,     0,    30,
+     248,   149,     0,     0,   247,   330,   331
 };
 
-  /* YYPGOTO[NTERM-NUM].  */
+/* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-    -378,  -378,   138,  -378,  -378,  -378,  -378,  -378,  -378,   390,
-    -378,  -378,   396,  -134,  -378,  -378,  -378,  -378,   404,   -28,
-    -378,   397,  -378,   208,  -157,  -196,  -378,  -378,  -170,  -378,
-     -78,  -260,   -10,  -378,  -378,  -378,  -378,  -378,  -378,  -378,
-     449,  -378,  -378,  -378,  -333,    29,  -378,  -302,  -378,  -378,
-      96,  -378,  -378,  -378,   336,   196,  -378,   175,  -378,  -178,
-    -126,  -378,  -378,  -378,  -378,  -378,  -378,  -378,  -378,  -339,
-     -46,  -378,  -378,     1,   260,  -377,   -45,  -378,   -47,  -378,
-    -378,  -378,  -378
+    -391,  -391,   155,  -391,  -391,  -391,  -391,  -391,  -391,   411,
+    -391,  -391,   419,  -125,  -391,  -391,  -391,  -391,   427,   -30,
+    -391,   429,  -391,   232,  -158,  -199,  -391,  -391,  -157,  -391,
+     -62,  -264,   -10,  -391,  -391,  -391,  -391,  -391,  -391,  -391,
+     472,  -391,  -391,  -391,  -331,    50,  -391,  -305,  -391,  -391,
+      55,  -391,  -391,  -391,   365,   237,  -391,   217,  -391,  -179,
+    -145,  -391,  -391,  -391,  -391,  -391,  -391,  -391,  -391,  -347,
+     -47,  -391,  -391,    11,   268,  -390,   -19,  -391,   -23,  -391,
+    -391,  -391,  -391
 };
 
-  /* YYDEFGOTO[NTERM-NUM].  */
+/* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int16 yydefgoto[] =
 {
-      -1,     1,   160,    68,   295,   241,    11,    12,    28,    29,
-      13,    25,    26,   552,   376,   377,   378,   379,    22,    23,
-      35,    36,    37,    14,   154,   187,    60,    15,   242,   380,
-     303,   381,   243,   382,   244,   383,   384,   385,   386,   477,
-     387,   388,   245,   246,   394,   247,   248,   341,   249,   250,
-     395,   157,   190,   158,    61,   182,   183,   206,   207,   514,
-     184,   531,    17,    73,    18,    19,   115,    55,    20,   185,
-     252,   108,   109,   208,   253,   459,   460,   254,   461,   462,
-     255,   584,   256
+       0,     1,   161,    68,   299,   244,    11,    12,    28,    29,
+      13,    25,    26,   556,   380,   381,   382,   383,    22,    23,
+      35,    36,    37,    14,   155,   189,    60,    15,   245,   384,
+     307,   385,   246,   386,   247,   387,   388,   389,   390,   481,
+     391,   392,   248,   249,   398,   250,   251,   345,   252,   253,
+     399,   158,   192,   159,    61,   184,   185,   208,   209,   518,
+     186,   535,    17,    73,    18,    19,   116,    55,    20,   187,
+     255,   109,   110,   210,   256,   463,   464,   257,   465,   466,
+     258,   588,   259
 };
 
-  /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
-     positive, shift that token.  If negative, reduce the rule whose
-     number is the opposite.  If YYTABLE_NINF, syntax error.  */
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_int16 yytable[] =
 {
-      38,   389,   107,   423,   275,   340,   277,   265,   279,     2,
-     200,   202,   204,   513,     3,   481,   443,   267,   161,   171,
-     171,   425,   454,   112,   172,   172,    32,    33,   465,   525,
-     209,   305,   179,     4,    52,     5,   361,     6,   106,     7,
-     480,    43,    38,   194,     8,    74,   281,   550,   518,   110,
-       9,    75,   519,   258,    21,   162,   551,    24,   179,    53,
-     171,    34,    27,   306,   269,   172,    76,   282,   176,   478,
-     301,   195,    77,    78,    79,    80,    81,    82,    83,    84,
-      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
-      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
-     105,   155,   180,   482,   177,   171,    56,   261,   156,    33,
-     172,   173,   173,   262,   482,   174,   174,   107,   107,   107,
-      41,   107,   107,   107,   107,   171,   210,   188,   180,   262,
-     172,   263,   562,   175,   175,   181,   539,    33,   532,    30,
-     107,   483,   546,    34,   482,    31,   315,   391,   482,   317,
-      10,   537,   173,   106,   106,   106,   174,   106,   106,   106,
-     106,   424,    57,    58,   196,   197,   198,   107,   201,   203,
-     205,    34,   261,   567,   175,   487,   106,   582,   261,   482,
-     541,   482,   521,   155,   171,    43,   522,   266,    59,   172,
-     257,    42,   553,   333,   334,   479,   263,   173,   192,   193,
-     468,   174,   263,   106,   261,   563,   505,   171,   559,   519,
-     268,   261,   172,    44,   284,    62,    63,   173,   107,   175,
-      43,   174,   517,   298,   579,    45,   107,   262,   263,    49,
-     264,    46,    49,   171,   262,   263,   107,   556,   172,   175,
-      48,   349,   107,   107,   171,   107,    39,   534,    40,   172,
-     259,   261,   260,   389,   106,   107,   159,   358,   359,   239,
-      47,   240,   106,    50,   171,   339,    51,    54,    70,   172,
-     111,   251,   106,   344,   114,   263,   173,   116,   106,   106,
-     174,   106,   151,   152,   153,   159,   163,   166,   164,   352,
-     353,   106,   355,   523,   524,   165,   186,   570,   175,   173,
-     528,   167,   362,   174,   189,   271,   168,   169,    64,   533,
-     170,   191,    65,   199,    66,    67,   180,   239,   293,   294,
-     586,   175,   274,   272,   270,   173,   301,   296,   297,   174,
-     299,   300,   283,   286,   302,   287,   173,   288,   289,   171,
-     174,   290,   273,   292,   172,   291,   171,   175,    10,   338,
-     343,   172,   345,   336,   557,   346,   173,   554,   175,   347,
-     174,   342,   276,   350,   192,   425,   564,   171,   402,   404,
-     420,   472,   172,   471,   171,   473,   476,   474,   175,   172,
-     565,   475,   171,   351,   484,   507,   354,   172,   357,   517,
-     520,   580,   527,   529,   530,   171,   577,   578,   107,   390,
-     172,   540,   480,   396,   397,   544,   545,   398,   399,   400,
-     401,   548,   403,   575,   405,   406,   407,   408,   409,   410,
-     411,   412,   413,   414,   415,   416,   417,   418,   419,   558,
-     421,   173,   588,   360,   106,   174,    72,   278,   173,   589,
-     592,    71,   174,   585,   280,   506,   446,    69,   304,   113,
-      16,   555,   178,   175,   489,   453,   337,   348,   458,   173,
-     175,   463,   464,   174,   467,   441,   173,   469,   470,   107,
-     174,   543,   448,   285,   173,   549,     0,     0,   174,     0,
-     449,   175,     0,     0,     0,     0,     0,   173,   175,     0,
-       0,   174,     0,   451,     0,     0,   175,     0,     0,     0,
-       0,     0,     0,     0,     0,   106,     0,     0,     0,   175,
-     107,     0,     0,     0,   107,     0,   362,     0,     0,     0,
-     488,     0,   490,   491,   492,   493,   494,   495,   496,   497,
-     498,   499,   500,   501,   502,   503,   504,     0,     0,     0,
-       0,     0,     0,     0,   509,   510,   106,   511,     0,     0,
-     106,     0,   251,   302,     0,     0,     0,   569,   309,   310,
-       0,   572,   526,     0,     0,     0,   315,     0,   316,   317,
-     318,     0,   319,     0,     0,     0,     0,     0,   535,     0,
-       0,   538,     0,     0,   307,   308,   309,   310,   311,     0,
-       0,   312,   313,   314,   315,     0,   316,   317,   318,     0,
-     319,     0,   320,   321,     0,     0,     0,     0,     0,     0,
-     542,     0,     0,   333,   334,     0,   547,     0,   458,     0,
-     322,     0,   323,   324,   325,   326,   327,   328,   329,   330,
-     331,   332,     0,     0,     0,     0,   561,     0,     0,     0,
-       0,   333,   334,     0,     0,     0,     0,   566,   239,     0,
-     364,   390,     0,   571,     3,     0,   365,   366,   574,   367,
-     576,   211,   212,   213,   214,     0,     0,     0,     0,   368,
-     215,   369,   370,     0,     0,     0,   587,     0,     0,     0,
-       0,   371,   216,     0,   591,   372,   217,     0,   218,     0,
-       9,   219,   373,     0,   220,    77,    78,    79,     0,    81,
+      38,   108,   393,   278,   344,   280,   485,   282,   268,   427,
+     202,   204,   206,   429,   173,   173,   517,   264,   458,   174,
+     174,   113,   447,    33,   469,     2,    32,   529,   162,   172,
+       3,   309,   270,   181,   212,   486,   261,   365,   107,   484,
+      21,   266,    38,   486,   181,   554,    74,   272,    24,     4,
+      49,     5,    75,     6,   555,     7,    27,    34,   522,   111,
+       8,   482,   523,   310,   566,   163,     9,    76,    49,   305,
+     194,   195,   571,    77,    78,    79,    80,    81,    82,    83,
+      84,    85,    86,    87,    88,    89,    90,    91,    92,    93,
+      94,    95,    96,    97,    98,    99,   100,   101,   102,   103,
+     104,   105,    39,   182,    40,   179,   175,   175,   173,    33,
+     176,   176,   196,   174,   182,   173,   265,   108,   108,   108,
+     174,   108,   108,   108,   108,   108,   190,   265,   177,   177,
+     213,   543,   586,   550,   536,    30,   183,    56,   106,   173,
+     197,   108,   319,    34,   174,   321,    52,   525,   173,    31,
+     395,   526,    42,   174,   107,   107,   107,   541,   107,   107,
+     107,   107,   107,    43,   428,    43,    10,   264,   305,   108,
+     486,    53,    34,    62,    63,   198,   199,   200,   107,   203,
+     205,   207,   486,   211,   284,   486,   545,   486,   271,   337,
+     338,   266,   178,    57,    58,   156,   483,   487,   557,   269,
+     175,    43,   157,   156,   176,   285,   107,   175,   521,   491,
+     260,   176,   509,   274,   563,   264,   173,   472,    41,    59,
+     108,   174,   177,   262,   353,   263,   302,   288,   108,   177,
+      44,   175,   254,   538,    45,   176,   173,   276,   108,   266,
+     175,   174,   173,    46,   176,   108,   108,   174,   108,    47,
+     242,   173,   243,   177,   393,   567,   174,   107,   108,   523,
+      48,    49,   177,    50,    54,   107,    64,   583,    51,    70,
+      65,   112,    66,    67,   115,   107,   264,   117,   343,   152,
+     297,   298,   107,   107,   153,   107,   348,   154,   160,   300,
+     301,   164,   303,   304,   165,   107,   306,   574,   166,   265,
+     266,   167,   267,   356,   357,   168,   359,   169,   175,   264,
+     527,   528,   176,   264,   279,   170,   366,   532,   171,   173,
+     590,   188,   191,   346,   174,   193,   537,   201,   175,   182,
+     177,   242,   176,   266,   175,   273,   265,   266,   176,   560,
+     277,   275,   290,   175,   287,   291,   355,   176,   173,   358,
+     177,   361,   292,   174,   294,   173,   177,   561,   293,   295,
+     174,   349,   394,   296,   305,   177,   400,   401,    10,   568,
+     402,   403,   404,   405,   558,   407,   340,   409,   410,   411,
+     412,   413,   414,   415,   416,   417,   418,   419,   420,   421,
+     422,   423,   342,   425,   584,   347,   350,   569,   160,   362,
+     363,   108,   351,   429,   354,   406,   408,   424,   475,   450,
+     194,   175,   476,   581,   582,   176,   477,   281,   457,   478,
+     479,   462,   480,   488,   467,   468,   511,   471,   521,   524,
+     473,   474,   531,   177,   533,   534,   484,   173,   107,   544,
+     175,   548,   174,   549,   176,   552,   283,   175,   562,   579,
+     173,   176,   592,   286,   364,   174,   589,    72,   593,   510,
+     173,   596,   177,   173,    71,   174,   313,   314,   174,   177,
+      69,   559,   108,    16,   319,   308,   320,   321,   322,   493,
+     323,   114,   180,   492,   289,   494,   495,   496,   497,   498,
+     499,   500,   501,   502,   503,   504,   505,   506,   507,   508,
+     341,   547,   352,   553,     0,     0,     0,   513,   514,   107,
+     515,     0,     0,   108,     0,   254,   306,   108,     0,     0,
+       0,   337,   338,     0,     0,   530,     0,     0,     0,   175,
+     366,     0,     0,   176,     0,   445,     0,     0,     0,     0,
+       0,   539,   175,     0,   542,     0,   176,     0,   452,     0,
+     107,   177,   175,     0,   107,   175,   176,     0,   453,   176,
+       0,   455,     0,     0,   177,     0,     0,     0,     0,     0,
+       0,   573,     0,   546,   177,   576,     0,   177,     0,   551,
+       0,   462,     0,     0,     0,     0,   313,   314,     0,     0,
+       0,     0,     0,     0,   319,     0,   320,   321,   322,   565,
+     323,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     570,     0,     0,   368,   394,     0,   575,     3,     0,   369,
+     370,   578,   371,   580,   214,   215,   216,   217,     0,   334,
+     335,   336,   372,   218,   373,   374,     0,     0,     0,   591,
+       0,   337,   338,     0,   375,   219,     0,   595,   376,   220,
+       0,   221,     0,     9,   222,   377,     0,   223,    77,    78,
+      79,     0,    81,    82,    83,    84,    85,    86,    87,    88,
+      89,    90,    91,    92,    93,    94,     0,    96,    97,    98,
+       0,   224,   101,   102,   103,   104,     0,     0,     0,     0,
+       0,     0,     0,   313,   314,     0,     0,   225,   226,     0,
+       0,   319,     0,     0,   321,   322,     0,   323,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   227,   228,   229,
+     230,   231,   232,    33,   233,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   234,   235,
+       0,     0,     0,   236,     0,     0,   237,   238,   337,   338,
+       0,     0,     0,   239,     0,   241,     0,    34,   378,   242,
+     379,   243,   368,     0,     0,     0,     3,     0,   369,   370,
+       0,   371,     0,   214,   215,   216,   217,     0,     0,     0,
+       0,   372,   218,   373,   374,     0,     0,     0,     0,     0,
+       0,     0,     0,   375,   219,     0,     0,   376,   220,     0,
+     221,     0,     9,   222,   377,     0,   223,    77,    78,    79,
+       0,    81,    82,    83,    84,    85,    86,    87,    88,    89,
+      90,    91,    92,    93,    94,     0,    96,    97,    98,     0,
+     224,   101,   102,   103,   104,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   225,   226,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   227,   228,   229,   230,
+     231,   232,    33,   233,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   234,   235,     0,
+       0,     0,   236,     0,     0,   237,   238,     0,     0,     0,
+       0,     0,   239,     0,   241,     0,    34,   378,   242,   572,
+     243,   214,   215,   216,   217,     0,     0,     0,     0,     0,
+     218,     0,     0,     0,     0,     0,   173,     0,     0,     0,
+       0,   174,   219,     0,     0,     0,   220,     0,   221,     0,
+       0,   222,     0,     0,   223,    77,    78,    79,     0,    81,
       82,    83,    84,    85,    86,    87,    88,    89,    90,    91,
-      92,    93,    94,     0,    96,    97,    98,     0,   221,   101,
+      92,    93,    94,     0,    96,    97,    98,     0,   224,   101,
      102,   103,   104,     0,     0,     0,     0,     0,     0,     0,
-     309,   310,     0,     0,   222,   223,     0,     0,   315,     0,
-       0,   317,   318,     0,   319,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   224,   225,   226,   227,   228,   229,
-      33,   230,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   231,   232,     0,     0,     0,
-     233,     0,     0,   234,   235,   333,   334,     0,     0,     0,
-     236,     0,   238,     0,    34,   374,   239,   375,   240,   364,
-       0,     0,     0,     3,     0,   365,   366,     0,   367,     0,
-     211,   212,   213,   214,     0,     0,     0,     0,   368,   215,
-     369,   370,     0,     0,     0,     0,     0,     0,     0,     0,
-     371,   216,     0,     0,   372,   217,     0,   218,     0,     9,
-     219,   373,     0,   220,    77,    78,    79,     0,    81,    82,
-      83,    84,    85,    86,    87,    88,    89,    90,    91,    92,
-      93,    94,     0,    96,    97,    98,     0,   221,   101,   102,
-     103,   104,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   222,   223,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   225,   226,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   224,   225,   226,   227,   228,   229,    33,
-     230,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   231,   232,     0,     0,     0,   233,
-       0,     0,   234,   235,     0,     0,     0,     0,     0,   236,
-       0,   238,     0,    34,   374,   239,   568,   240,   211,   212,
-     213,   214,     0,     0,     0,     0,     0,   215,     0,     0,
-       0,     0,     0,   171,     0,     0,     0,     0,   172,   216,
-       0,     0,     0,   217,     0,   218,     0,     0,   219,     0,
-       0,   220,    77,    78,    79,     0,    81,    82,    83,    84,
-      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
-       0,    96,    97,    98,     0,   221,   101,   102,   103,   104,
+       0,     0,     0,     0,   227,   228,   229,   230,   231,   232,
+     459,   233,     0,     0,     0,     0,     0,     0,   175,     0,
+       0,     0,   176,     0,     0,   234,   235,     0,     0,     0,
+     236,     0,     0,   237,   238,     0,     0,     0,     0,     0,
+     460,     0,   461,     0,    34,     0,   242,     0,   243,   214,
+     215,   216,   217,   448,     0,     0,     0,     0,   218,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   222,   223,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   224,   225,   226,   227,   228,   229,   455,   230,     0,
-       0,     0,     0,     0,     0,   173,     0,     0,     0,   174,
-       0,     0,   231,   232,     0,     0,     0,   233,     0,     0,
-     234,   235,     0,     0,     0,     0,     0,   456,     0,   457,
-       0,    34,     0,   239,     0,   240,   211,   212,   213,   214,
-     444,     0,     0,     0,     0,   215,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   216,     0,     0,
-       0,   217,     0,   218,     0,     0,   219,     0,     0,   220,
-      77,    78,    79,     0,    81,    82,    83,    84,    85,    86,
-      87,    88,    89,    90,    91,    92,    93,    94,     0,    96,
-      97,    98,     0,   221,   101,   102,   103,   104,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   222,
-     223,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   224,
-     225,   226,   227,   228,   229,    33,   230,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   445,     0,
-     231,   232,     0,     0,     0,   233,     0,     0,   234,   235,
-       0,   211,   212,   213,   214,   236,     0,   238,     0,    34,
-     215,   239,     0,   240,     0,     0,     0,     0,     0,     0,
-       0,     0,   216,     0,     0,     0,   217,     0,   218,     0,
-       0,   219,     0,     0,   220,    77,    78,    79,     0,    81,
-      82,    83,    84,    85,    86,    87,    88,    89,    90,    91,
-      92,    93,    94,     0,    96,    97,    98,     0,   221,   101,
-     102,   103,   104,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   222,   223,     0,     0,     0,     0,
+     219,     0,     0,     0,   220,     0,   221,     0,     0,   222,
+       0,     0,   223,    77,    78,    79,     0,    81,    82,    83,
+      84,    85,    86,    87,    88,    89,    90,    91,    92,    93,
+      94,     0,    96,    97,    98,     0,   224,   101,   102,   103,
+     104,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   225,   226,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   224,   225,   226,   227,   228,   229,
-      33,   230,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   231,   232,     0,     0,     0,
-     233,     0,     0,   234,   235,     0,   211,   212,   213,   214,
-     236,   237,   238,     0,    34,   215,   239,     0,   240,     0,
-       0,     0,     0,     0,     0,     0,     0,   216,     0,     0,
-       0,   217,     0,   218,     0,     0,   219,     0,     0,   220,
-      77,    78,    79,     0,    81,    82,    83,    84,    85,    86,
-      87,    88,    89,    90,    91,    92,    93,    94,     0,    96,
-      97,    98,     0,   221,   101,   102,   103,   104,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   222,
-     223,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   224,
-     225,   226,   227,   228,   229,    33,   230,     0,     0,     0,
-       0,     0,     0,     0,     0,   211,   212,   213,   214,     0,
-     231,   232,     0,     0,   215,   233,     0,     0,   234,   235,
-       0,     0,     0,     0,     0,   236,   216,   238,   356,    34,
-     217,   239,   218,   240,     0,   219,     0,     0,   220,    77,
-      78,    79,     0,    81,    82,    83,    84,    85,    86,    87,
-      88,    89,    90,    91,    92,    93,    94,     0,    96,    97,
-      98,     0,   221,   101,   102,   103,   104,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   222,   223,
+       0,     0,   227,   228,   229,   230,   231,   232,    33,   233,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   224,   225,
-     226,   227,   228,   229,    33,   230,     0,     0,     0,     0,
-       0,     0,     0,     0,   211,   212,   213,   214,     0,   231,
-     232,     0,     0,   215,   233,     0,     0,   234,   235,     0,
-       0,     0,     0,     0,   392,   216,   238,   393,    34,   217,
-     239,   218,   240,     0,   219,     0,     0,   220,    77,    78,
+       0,   449,     0,   234,   235,     0,     0,     0,   236,     0,
+       0,   237,   238,     0,   214,   215,   216,   217,   239,     0,
+     241,     0,    34,   218,   242,     0,   243,     0,     0,     0,
+       0,     0,     0,     0,     0,   219,     0,     0,     0,   220,
+       0,   221,     0,     0,   222,     0,     0,   223,    77,    78,
       79,     0,    81,    82,    83,    84,    85,    86,    87,    88,
       89,    90,    91,    92,    93,    94,     0,    96,    97,    98,
-       0,   221,   101,   102,   103,   104,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   222,   223,     0,
+       0,   224,   101,   102,   103,   104,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   225,   226,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   224,   225,   226,
-     227,   228,   229,    33,   230,     0,     0,     0,     0,     0,
-       0,     0,     0,   211,   212,   213,   214,     0,   231,   232,
-       0,     0,   215,   233,     0,     0,   234,   235,     0,     0,
-       0,     0,     0,   236,   216,   238,   422,    34,   217,   239,
-     218,   240,     0,   219,     0,     0,   220,    77,    78,    79,
-       0,    81,    82,    83,    84,    85,    86,    87,    88,    89,
-      90,    91,    92,    93,    94,     0,    96,    97,    98,     0,
-     221,   101,   102,   103,   104,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   222,   223,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   227,   228,   229,
+     230,   231,   232,    33,   233,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   234,   235,
+       0,     0,     0,   236,     0,     0,   237,   238,     0,   214,
+     215,   216,   217,   239,   240,   241,     0,    34,   218,   242,
+       0,   243,     0,     0,     0,     0,     0,     0,     0,     0,
+     219,     0,     0,     0,   220,     0,   221,     0,     0,   222,
+       0,     0,   223,    77,    78,    79,     0,    81,    82,    83,
+      84,    85,    86,    87,    88,    89,    90,    91,    92,    93,
+      94,     0,    96,    97,    98,     0,   224,   101,   102,   103,
+     104,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   225,   226,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   224,   225,   226,   227,
-     228,   229,    33,   230,     0,     0,     0,     0,     0,     0,
-       0,     0,   211,   212,   213,   214,     0,   231,   232,     0,
-       0,   215,   233,     0,     0,   234,   235,     0,     0,     0,
-       0,     0,   236,   216,   238,   442,    34,   217,   239,   218,
-     240,     0,   219,     0,     0,   220,    77,    78,    79,     0,
-      81,    82,    83,    84,    85,    86,    87,    88,    89,    90,
-      91,    92,    93,    94,     0,    96,    97,    98,     0,   221,
-     101,   102,   103,   104,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   222,   223,     0,     0,     0,
-       0,     0,     0,     0,   466,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   224,   225,   226,   227,   228,
-     229,    33,   230,     0,     0,     0,     0,     0,     0,     0,
-       0,   211,   212,   213,   214,     0,   231,   232,     0,     0,
-     215,   233,     0,     0,   234,   235,     0,     0,     0,     0,
-       0,   236,   216,   238,     0,    34,   217,   239,   218,   240,
-       0,   219,     0,     0,   220,    77,    78,    79,     0,    81,
-      82,    83,    84,    85,    86,    87,    88,    89,    90,    91,
-      92,    93,    94,     0,    96,    97,    98,     0,   221,   101,
-     102,   103,   104,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   222,   223,     0,     0,     0,     0,
+       0,     0,   227,   228,   229,   230,   231,   232,    33,   233,
+       0,     0,     0,     0,     0,     0,     0,     0,   214,   215,
+     216,   217,     0,   234,   235,     0,     0,   218,   236,     0,
+       0,   237,   238,     0,     0,     0,     0,     0,   239,   219,
+     241,   360,    34,   220,   242,   221,   243,     0,   222,     0,
+       0,   223,    77,    78,    79,     0,    81,    82,    83,    84,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+       0,    96,    97,    98,     0,   224,   101,   102,   103,   104,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   224,   225,   226,   227,   228,   229,
-      33,   230,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   231,   232,     0,     0,     0,
-     233,     0,     0,   234,   235,     0,   211,   212,   213,   214,
-     515,   237,   238,     0,    34,   215,   239,     0,   240,     0,
-       0,     0,     0,     0,     0,     0,     0,   216,     0,     0,
-       0,   217,     0,   218,     0,     0,   219,     0,     0,   220,
+       0,   225,   226,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   227,   228,   229,   230,   231,   232,    33,   233,     0,
+       0,     0,     0,     0,     0,     0,     0,   214,   215,   216,
+     217,     0,   234,   235,     0,     0,   218,   236,     0,     0,
+     237,   238,     0,     0,     0,     0,     0,   396,   219,   241,
+     397,    34,   220,   242,   221,   243,     0,   222,     0,     0,
+     223,    77,    78,    79,     0,    81,    82,    83,    84,    85,
+      86,    87,    88,    89,    90,    91,    92,    93,    94,     0,
+      96,    97,    98,     0,   224,   101,   102,   103,   104,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     225,   226,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     227,   228,   229,   230,   231,   232,    33,   233,     0,     0,
+       0,     0,     0,     0,     0,     0,   214,   215,   216,   217,
+       0,   234,   235,     0,     0,   218,   236,     0,     0,   237,
+     238,     0,     0,     0,     0,     0,   239,   219,   241,   426,
+      34,   220,   242,   221,   243,     0,   222,     0,     0,   223,
       77,    78,    79,     0,    81,    82,    83,    84,    85,    86,
       87,    88,    89,    90,    91,    92,    93,    94,     0,    96,
-      97,    98,     0,   221,   101,   102,   103,   104,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   222,
-     223,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   224,
-     225,   226,   227,   228,   229,    33,   230,     0,     0,     0,
-       0,     0,     0,     0,     0,   211,   212,   213,   214,     0,
-     231,   232,     0,     0,   215,   233,     0,     0,   234,   235,
-       0,     0,     0,     0,     0,   236,   216,   238,   516,    34,
-     217,   239,   218,   240,     0,   219,     0,     0,   220,    77,
+      97,    98,     0,   224,   101,   102,   103,   104,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   225,
+     226,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   227,
+     228,   229,   230,   231,   232,    33,   233,     0,     0,     0,
+       0,     0,     0,     0,     0,   214,   215,   216,   217,     0,
+     234,   235,     0,     0,   218,   236,     0,     0,   237,   238,
+       0,     0,     0,     0,     0,   239,   219,   241,   446,    34,
+     220,   242,   221,   243,     0,   222,     0,     0,   223,    77,
       78,    79,     0,    81,    82,    83,    84,    85,    86,    87,
       88,    89,    90,    91,    92,    93,    94,     0,    96,    97,
-      98,     0,   221,   101,   102,   103,   104,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   222,   223,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   224,   225,
-     226,   227,   228,   229,    33,   230,     0,     0,     0,     0,
-       0,     0,     0,     0,   211,   212,   213,   214,   560,   231,
-     232,     0,     0,   215,   233,     0,     0,   234,   235,     0,
-       0,     0,     0,     0,   236,   216,   238,   536,    34,   217,
-     239,   218,   240,     0,   219,     0,     0,   220,    77,    78,
+      98,     0,   224,   101,   102,   103,   104,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   225,   226,
+       0,     0,     0,     0,     0,     0,     0,   470,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   227,   228,
+     229,   230,   231,   232,    33,   233,     0,     0,     0,     0,
+       0,     0,     0,     0,   214,   215,   216,   217,     0,   234,
+     235,     0,     0,   218,   236,     0,     0,   237,   238,     0,
+       0,     0,     0,     0,   239,   219,   241,     0,    34,   220,
+     242,   221,   243,     0,   222,     0,     0,   223,    77,    78,
       79,     0,    81,    82,    83,    84,    85,    86,    87,    88,
       89,    90,    91,    92,    93,    94,     0,    96,    97,    98,
-       0,   221,   101,   102,   103,   104,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   222,   223,     0,
+       0,   224,   101,   102,   103,   104,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   225,   226,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   224,   225,   226,
-     227,   228,   229,    33,   230,     0,     0,     0,     0,     0,
-       0,     0,     0,   211,   212,   213,   214,     0,   231,   232,
-       0,     0,   215,   233,     0,     0,   234,   235,     0,     0,
-       0,     0,     0,   236,   216,   238,     0,    34,   217,   239,
-     218,   240,     0,   219,     0,     0,   220,    77,    78,    79,
-       0,    81,    82,    83,    84,    85,    86,    87,    88,    89,
-      90,    91,    92,    93,    94,     0,    96,    97,    98,     0,
-     221,   101,   102,   103,   104,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   222,   223,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   227,   228,   229,
+     230,   231,   232,    33,   233,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   234,   235,
+       0,     0,     0,   236,     0,     0,   237,   238,     0,   214,
+     215,   216,   217,   519,   240,   241,     0,    34,   218,   242,
+       0,   243,     0,     0,     0,     0,     0,     0,     0,     0,
+     219,     0,     0,     0,   220,     0,   221,     0,     0,   222,
+       0,     0,   223,    77,    78,    79,     0,    81,    82,    83,
+      84,    85,    86,    87,    88,    89,    90,    91,    92,    93,
+      94,     0,    96,    97,    98,     0,   224,   101,   102,   103,
+     104,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   225,   226,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   224,   225,   226,   227,
-     228,   229,    33,   230,     0,   361,     0,     0,     0,     0,
-       0,     0,     0,     0,    74,     0,     0,   231,   232,     0,
-      75,     0,   233,     0,     0,   234,   235,     0,     0,     0,
-       0,     0,   236,     0,   238,    76,    34,     0,   239,     0,
-     240,    77,    78,    79,    80,    81,    82,    83,    84,    85,
-      86,    87,    88,    89,    90,    91,    92,    93,    94,    95,
-      96,    97,    98,    99,   100,   101,   102,   103,   104,   105,
+       0,     0,   227,   228,   229,   230,   231,   232,    33,   233,
+       0,     0,     0,     0,     0,     0,     0,     0,   214,   215,
+     216,   217,     0,   234,   235,     0,     0,   218,   236,     0,
+       0,   237,   238,     0,     0,     0,     0,     0,   239,   219,
+     241,   520,    34,   220,   242,   221,   243,     0,   222,     0,
+       0,   223,    77,    78,    79,     0,    81,    82,    83,    84,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+       0,    96,    97,    98,     0,   224,   101,   102,   103,   104,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      74,     0,     0,     0,     0,     0,    75,     0,     0,     0,
+       0,   225,   226,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    76,     0,     0,     0,     0,    33,    77,    78,    79,
-      80,    81,    82,    83,    84,    85,    86,    87,    88,    89,
-      90,    91,    92,    93,    94,    95,    96,    97,    98,    99,
-     100,   101,   102,   103,   104,   105,   301,     0,     0,     0,
-      34,     0,     0,     0,     0,     0,    74,     0,     0,     0,
-       0,     0,    75,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    76,     0,     0,
-       0,     0,    33,    77,    78,    79,    80,    81,    82,    83,
-      84,    85,    86,    87,    88,    89,    90,    91,    92,    93,
-      94,    95,    96,    97,    98,    99,   100,   101,   102,   103,
-     104,   105,     0,     0,   153,     0,    34,     0,     0,     0,
-       0,     0,    74,     0,     0,     0,     0,     0,    75,     0,
+       0,   227,   228,   229,   230,   231,   232,    33,   233,     0,
+       0,     0,     0,     0,     0,     0,     0,   214,   215,   216,
+     217,   564,   234,   235,     0,     0,   218,   236,     0,     0,
+     237,   238,     0,     0,     0,     0,     0,   239,   219,   241,
+     540,    34,   220,   242,   221,   243,     0,   222,     0,     0,
+     223,    77,    78,    79,     0,    81,    82,    83,    84,    85,
+      86,    87,    88,    89,    90,    91,    92,    93,    94,     0,
+      96,    97,    98,     0,   224,   101,   102,   103,   104,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,    76,     0,     0,     0,     0,    33,    77,
-      78,    79,    80,    81,    82,    83,    84,    85,    86,    87,
-      88,    89,    90,    91,    92,    93,    94,    95,    96,    97,
-      98,    99,   100,   101,   102,   103,   104,   105,   236,     0,
-       0,     0,    34,     0,   426,   427,   428,   429,   430,   431,
-     432,   433,   307,   308,   309,   310,   311,   434,   435,   312,
-     313,   314,   315,   436,   316,   317,   318,     0,   319,   437,
-     320,   321,   438,   439,    33,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   440,   322,     0,
-     323,   324,   325,   326,   327,   328,   329,   330,   331,   332,
-       0,     0,     0,     0,     0,     0,     0,     0,    34,   333,
-     334,     0,     0,     0,     0,   581,   426,   427,   428,   429,
-     430,   431,   432,   433,   307,   308,   309,   310,   311,   434,
-     435,   312,   313,   314,   315,   436,   316,   317,   318,     0,
-     319,   437,   320,   321,   438,   439,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   440,
-     322,     0,   323,   324,   325,   326,   327,   328,   329,   330,
-     331,   332,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   333,   334,     0,     0,     0,     0,   590,   426,   427,
-     428,   429,   430,   431,   432,   433,   307,   308,   309,   310,
-     311,   434,   435,   312,   313,   314,   315,   436,   316,   317,
-     318,  -149,   319,   437,   320,   321,   438,   439,     0,     0,
+     225,   226,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     227,   228,   229,   230,   231,   232,    33,   233,     0,     0,
+       0,     0,     0,     0,     0,     0,   214,   215,   216,   217,
+       0,   234,   235,     0,     0,   218,   236,     0,     0,   237,
+     238,     0,     0,     0,     0,     0,   239,   219,   241,     0,
+      34,   220,   242,   221,   243,     0,   222,     0,     0,   223,
+      77,    78,    79,     0,    81,    82,    83,    84,    85,    86,
+      87,    88,    89,    90,    91,    92,    93,    94,     0,    96,
+      97,    98,     0,   224,   101,   102,   103,   104,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   225,
+     226,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   227,
+     228,   229,   230,   231,   232,    33,   233,     0,   365,     0,
+       0,     0,     0,     0,     0,     0,     0,    74,     0,     0,
+     234,   235,     0,    75,     0,   236,     0,     0,   237,   238,
+       0,     0,     0,     0,     0,   239,     0,   241,    76,    34,
+       0,   242,     0,   243,    77,    78,    79,    80,    81,    82,
+      83,    84,    85,    86,    87,    88,    89,    90,    91,    92,
+      93,    94,    95,    96,    97,    98,    99,   100,   101,   102,
+     103,   104,   105,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    74,     0,     0,     0,     0,     0,    75,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    76,     0,     0,     0,     0,   106,
+      77,    78,    79,    80,    81,    82,    83,    84,    85,    86,
+      87,    88,    89,    90,    91,    92,    93,    94,    95,    96,
+      97,    98,    99,   100,   101,   102,   103,   104,   105,     0,
+       0,     0,     0,    34,     0,     0,     0,     0,     0,    74,
+       0,     0,     0,     0,     0,    75,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      76,     0,     0,     0,     0,   106,    77,    78,    79,    80,
+      81,    82,    83,    84,    85,    86,    87,    88,    89,    90,
+      91,    92,    93,    94,    95,    96,    97,    98,    99,   100,
+     101,   102,   103,   104,   105,     0,     0,   154,     0,    34,
+       0,     0,     0,     0,     0,    74,     0,     0,     0,     0,
+       0,    75,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    76,     0,     0,     0,
+       0,   106,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
+     105,   239,     0,     0,     0,    34,     0,   430,   431,   432,
+     433,   434,   435,   436,   437,   311,   312,   313,   314,   315,
+     438,   439,   316,   317,   318,   319,   440,   320,   321,   322,
+       0,   323,   441,   324,   325,   442,   443,   106,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     444,   326,     0,   327,   328,   329,   330,   331,   332,   333,
+     334,   335,   336,     0,     0,     0,     0,     0,     0,     0,
+       0,    34,   337,   338,     0,     0,     0,     0,   585,   430,
+     431,   432,   433,   434,   435,   436,   437,   311,   312,   313,
+     314,   315,   438,   439,   316,   317,   318,   319,   440,   320,
+     321,   322,     0,   323,   441,   324,   325,   442,   443,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   440,   322,     0,   323,   324,   325,   326,   327,   328,
-     329,   330,   331,   332,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   333,   334,   426,   427,   428,   429,   430,
-     431,   432,   433,   307,   308,   309,   310,   311,   434,   435,
-     312,   313,   314,   315,   436,   316,   317,   318,     0,   319,
-     437,   320,   321,   438,   439,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   440,   322,
-       0,   323,   324,   325,   326,   327,   328,   329,   330,   331,
-     332,     0,     0,     0,     0,   307,   308,   309,   310,   311,
-     333,   334,   312,   313,   314,   315,     0,   316,   317,   318,
-       0,   319,     0,   320,   321,     0,     0,     0,     0,     0,
+       0,     0,   444,   326,     0,   327,   328,   329,   330,   331,
+     332,   333,   334,   335,   336,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   337,   338,     0,     0,     0,     0,
+     594,   430,   431,   432,   433,   434,   435,   436,   437,   311,
+     312,   313,   314,   315,   438,   439,   316,   317,   318,   319,
+     440,   320,   321,   322,  -149,   323,   441,   324,   325,   442,
+     443,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   444,   326,     0,   327,   328,   329,
+     330,   331,   332,   333,   334,   335,   336,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   337,   338,   430,   431,
+     432,   433,   434,   435,   436,   437,   311,   312,   313,   314,
+     315,   438,   439,   316,   317,   318,   319,   440,   320,   321,
+     322,     0,   323,   441,   324,   325,   442,   443,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   322,     0,   323,   324,   325,   326,   327,   328,   329,
-     330,   331,   332,     0,     0,     0,     0,   307,   308,   309,
-     310,   311,   333,   334,   312,   313,   314,   315,   583,   316,
-     317,   318,     0,   319,     0,   320,   321,     0,     0,     0,
+       0,   444,   326,     0,   327,   328,   329,   330,   331,   332,
+     333,   334,   335,   336,     0,     0,     0,     0,   311,   312,
+     313,   314,   315,   337,   338,   316,   317,   318,   319,     0,
+     320,   321,   322,     0,   323,     0,   324,   325,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   322,     0,   323,   324,   325,   326,   327,
-     328,   329,   330,   331,   332,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   333,   334,     0,     0,   363,   307,
-     308,   309,   310,   311,     0,     0,   312,   313,   314,   315,
-       0,   316,   317,   318,     0,   319,     0,   320,   321,     0,
+       0,     0,     0,     0,   326,     0,   327,   328,   329,   330,
+     331,   332,   333,   334,   335,   336,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   337,   338,   311,   312,   313,
+     314,   315,   242,     0,   316,   317,   318,   319,     0,   320,
+     321,   322,     0,   323,     0,   324,   325,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   322,     0,   323,   324,   325,
-     326,   327,   328,   329,   330,   331,   332,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   333,   334,     0,     0,
-     447,   307,   308,   309,   310,   311,     0,     0,   312,   313,
-     314,   315,     0,   316,   317,   318,     0,   319,     0,   320,
-     321,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   322,     0,   323,
-     324,   325,   326,   327,   328,   329,   330,   331,   332,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   333,   334,
-       0,     0,   450,   307,   308,   309,   310,   311,     0,     0,
-     312,   313,   314,   315,     0,   316,   317,   318,     0,   319,
-       0,   320,   321,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   322,
-       0,   323,   324,   325,   326,   327,   328,   329,   330,   331,
-     332,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     333,   334,     0,     0,   452,   307,   308,   309,   310,   311,
-       0,     0,   312,   313,   314,   315,     0,   316,   317,   318,
-       0,   319,     0,   320,   321,     0,     0,     0,     0,     0,
+       0,     0,     0,   326,     0,   327,   328,   329,   330,   331,
+     332,   333,   334,   335,   336,     0,     0,     0,     0,   311,
+     312,   313,   314,   315,   337,   338,   316,   317,   318,   319,
+     587,   320,   321,   322,     0,   323,     0,   324,   325,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   322,     0,   323,   324,   325,   326,   327,   328,   329,
-     330,   331,   332,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   333,   334,     0,     0,   508,   307,   308,   309,
-     310,   311,     0,     0,   312,   313,   314,   315,     0,   316,
-     317,   318,     0,   319,     0,   320,   321,     0,     0,     0,
+       0,     0,     0,     0,     0,   326,     0,   327,   328,   329,
+     330,   331,   332,   333,   334,   335,   336,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   337,   338,     0,     0,
+     367,   311,   312,   313,   314,   315,     0,     0,   316,   317,
+     318,   319,     0,   320,   321,   322,     0,   323,     0,   324,
+     325,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   326,     0,   327,
+     328,   329,   330,   331,   332,   333,   334,   335,   336,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   337,   338,
+       0,     0,   451,   311,   312,   313,   314,   315,     0,     0,
+     316,   317,   318,   319,     0,   320,   321,   322,     0,   323,
+       0,   324,   325,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   326,
+       0,   327,   328,   329,   330,   331,   332,   333,   334,   335,
+     336,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     337,   338,     0,     0,   454,   311,   312,   313,   314,   315,
+       0,     0,   316,   317,   318,   319,     0,   320,   321,   322,
+       0,   323,     0,   324,   325,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   322,     0,   323,   324,   325,   326,   327,
-     328,   329,   330,   331,   332,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   333,   334,     0,     0,   573,   117,
-     118,   119,   120,   121,   122,   123,   124,   125,   126,   127,
-     128,   129,   130,   131,   132,   133,   134,     0,     0,     0,
-       0,     0,     0,     0,     0,   135,   136,   137,   138,     0,
+       0,   326,     0,   327,   328,   329,   330,   331,   332,   333,
+     334,   335,   336,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   337,   338,     0,     0,   456,   311,   312,   313,
+     314,   315,     0,     0,   316,   317,   318,   319,     0,   320,
+     321,   322,     0,   323,     0,   324,   325,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   139,   140,   141,   142,   143,
-     144,   145,   146,   147,   148,     0,     0,     0,   149,   150,
-     307,   308,   309,   310,   311,     0,     0,   312,   313,   314,
-     315,     0,   316,   317,   318,     0,   319,     0,   320,   321,
+       0,     0,     0,   326,     0,   327,   328,   329,   330,   331,
+     332,   333,   334,   335,   336,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   337,   338,     0,     0,   512,   311,
+     312,   313,   314,   315,     0,     0,   316,   317,   318,   319,
+       0,   320,   321,   322,     0,   323,     0,   324,   325,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   322,     0,   323,   324,
-     325,   326,   327,   328,   329,   330,   331,   332,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   333,   334,   335,
-     307,   308,   309,   310,   311,     0,     0,   312,   313,   314,
-     315,     0,   316,   317,   318,     0,   319,     0,   320,   321,
+       0,     0,     0,     0,     0,   326,     0,   327,   328,   329,
+     330,   331,   332,   333,   334,   335,   336,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   337,   338,     0,     0,
+     577,   118,   119,   120,   121,   122,   123,   124,   125,   126,
+     127,   128,   129,   130,   131,   132,   133,   134,   135,     0,
+       0,     0,     0,     0,     0,     0,     0,   136,   137,   138,
+     139,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   140,   141,   142,
+     143,   144,   145,   146,   147,   148,   149,     0,     0,     0,
+     150,   151,   311,   312,   313,   314,   315,     0,     0,   316,
+     317,   318,   319,     0,   320,   321,   322,     0,   323,     0,
+     324,   325,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   326,     0,
+     327,   328,   329,   330,   331,   332,   333,   334,   335,   336,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   337,
+     338,   339,   311,   312,   313,   314,   315,     0,     0,   316,
+     317,   318,   319,     0,   320,   321,   322,     0,   323,     0,
+     324,   325,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   326,     0,
+     327,   328,   329,   330,   331,   332,   333,   334,   335,   336,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   337,
+     338,   490,   311,   312,   313,   314,   315,     0,     0,   316,
+     317,   318,   319,     0,   320,   321,   322,     0,   323,     0,
+     324,   325,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   326,   489,
+     327,   328,   329,   330,   331,   332,   333,   334,   335,   336,
+       0,     0,     0,     0,   311,   312,   313,   314,   315,   337,
+     338,   316,   317,   318,   319,     0,   320,   321,   322,     0,
+     323,     0,   324,   325,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   516,     0,     0,
+     326,     0,   327,   328,   329,   330,   331,   332,   333,   334,
+     335,   336,     0,     0,     0,     0,   311,   312,   313,   314,
+     315,   337,   338,   316,   317,   318,   319,     0,   320,   321,
+     322,     0,   323,     0,   324,   325,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   322,     0,   323,   324,
-     325,   326,   327,   328,   329,   330,   331,   332,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   333,   334,   486,
-     307,   308,   309,   310,   311,     0,     0,   312,   313,   314,
-     315,     0,   316,   317,   318,     0,   319,     0,   320,   321,
+       0,     0,   326,     0,   327,   328,   329,   330,   331,   332,
+     333,   334,   335,   336,     0,     0,     0,     0,   311,   312,
+     313,   314,   315,   337,   338,   316,   317,   318,   319,     0,
+     320,   321,   322,     0,   323,     0,   324,   325,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   322,   485,   323,   324,
-     325,   326,   327,   328,   329,   330,   331,   332,     0,     0,
-       0,     0,   307,   308,   309,   310,   311,   333,   334,   312,
-     313,   314,   315,     0,   316,   317,   318,     0,   319,     0,
-     320,   321,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   512,     0,     0,   322,     0,
-     323,   324,   325,   326,   327,   328,   329,   330,   331,   332,
-       0,     0,     0,     0,   307,   308,   309,   310,   311,   333,
-     334,   312,   313,   314,   315,     0,   316,   317,   318,     0,
-     319,     0,   320,   321,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   328,   329,   330,
+     331,   332,   333,   334,   335,   336,     0,     0,     0,     0,
+     311,   312,   313,   314,   315,   337,   338,   316,   317,   318,
+     319,     0,   320,   321,   322,     0,   323,     0,   324,   325,
+     311,   312,   313,   314,   315,     0,     0,   316,   317,   318,
+     319,     0,   320,   321,   322,     0,   323,     0,   324,   325,
+     329,   330,   331,   332,   333,   334,   335,   336,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   337,   338,     0,
+       0,   330,   331,   332,   333,   334,   335,   336,     0,   311,
+     312,   313,   314,   315,     0,     0,   316,   337,   338,   319,
+       0,   320,   321,   322,     0,   323,     0,   324,   325,   311,
+     312,   313,   314,     0,     0,     0,     0,     0,     0,   319,
+       0,   320,   321,   322,     0,   323,     0,   324,   325,     0,
+     330,   331,   332,   333,   334,   335,   336,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   337,   338,     0,   313,
+     314,     0,   332,   333,   334,   335,   336,   319,     0,   320,
+     321,   322,     0,   323,     0,     0,   337,   338,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     322,     0,   323,   324,   325,   326,   327,   328,   329,   330,
-     331,   332,     0,     0,     0,     0,   307,   308,   309,   310,
-     311,   333,   334,   312,   313,   314,   315,     0,   316,   317,
-     318,     0,   319,     0,   320,   321,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   324,   325,   326,   327,   328,
-     329,   330,   331,   332,     0,     0,     0,     0,   307,   308,
-     309,   310,   311,   333,   334,   312,   313,   314,   315,     0,
-     316,   317,   318,     0,   319,     0,   320,   321,   307,   308,
-     309,   310,   311,     0,     0,   312,   313,   314,   315,     0,
-     316,   317,   318,     0,   319,     0,   320,   321,   325,   326,
-     327,   328,   329,   330,   331,   332,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   333,   334,     0,     0,   326,
-     327,   328,   329,   330,   331,   332,     0,   307,   308,   309,
-     310,   311,     0,     0,   312,   333,   334,   315,     0,   316,
-     317,   318,     0,   319,     0,   320,   321,   307,   308,   309,
-     310,     0,     0,     0,     0,     0,     0,   315,     0,   316,
-     317,   318,     0,   319,     0,   320,   321,     0,   326,   327,
-     328,   329,   330,   331,   332,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   333,   334,     0,   309,   310,     0,
-     328,   329,   330,   331,   332,   315,     0,   316,   317,   318,
-       0,   319,   309,   310,   333,   334,     0,     0,     0,     0,
-     315,     0,   316,   317,   318,     0,   319,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   328,   329,
-     330,   331,   332,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   333,   334,     0,   330,   331,   332,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   333,   334
+     332,   333,   334,   335,   336,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   337,   338
 };
 
 static const yytype_int16 yycheck[] =
 {
-      10,   303,    48,   336,   200,   265,   202,   185,   204,     0,
-     167,   168,   169,    17,     5,   392,   349,   187,   111,    27,
-      27,    98,   361,    51,    32,    32,    28,   111,   367,    17,
-      27,   111,    41,    24,   117,    26,    10,    28,    48,    30,
-     111,   117,    52,   118,    35,    19,   125,     9,   142,    48,
-      41,    25,   146,   179,   111,   148,    18,   105,    41,   142,
-      27,   145,   111,   143,   190,    32,    40,   146,   144,   146,
-     141,   146,    46,    47,    48,    49,    50,    51,    52,    53,
-      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
-      64,    65,    66,    67,    68,    69,    70,    71,    72,    73,
-      74,   141,   111,   117,   114,    27,    29,    94,   148,   111,
-      32,   119,   119,   117,   117,   123,   123,   163,   164,   165,
-     147,   167,   168,   169,   170,    27,   123,   155,   111,   117,
-      32,   118,   146,   141,   141,   144,   144,   111,   477,   111,
-     186,   144,   519,   145,   117,   111,    93,   304,   117,    96,
-     141,   484,   119,   163,   164,   165,   123,   167,   168,   169,
-     170,   339,    85,    86,   163,   164,   165,   213,   167,   168,
-     169,   145,    94,   146,   141,   144,   186,   144,    94,   117,
-     513,   117,   142,   141,    27,   117,   146,   186,   111,    32,
-     148,   118,   525,   140,   141,   391,   118,   119,   113,   114,
-     370,   123,   118,   213,    94,   142,   144,    27,   144,   146,
-     142,    94,    32,   120,   213,    12,    13,   119,   264,   141,
-     117,   123,   117,   233,   146,   117,   272,   117,   118,   145,
-     120,   117,   145,    27,   117,   118,   282,   120,    32,   141,
-     118,   143,   288,   289,    27,   291,     4,   142,     6,    32,
-     144,    94,   146,   555,   264,   301,   113,   114,   115,   147,
-     147,   149,   272,   111,    27,   264,   143,   111,   105,    32,
-     111,   175,   282,   272,   120,   118,   119,   147,   288,   289,
-     123,   291,    29,    29,   143,   113,   124,   143,   124,   288,
-     289,   301,   291,   463,   464,   124,   120,   557,   141,   119,
-     470,   124,   301,   123,    38,   125,   124,   124,   105,   479,
-     124,   146,   109,   111,   111,   112,   111,   147,   222,   223,
-     580,   141,   144,   117,   105,   119,   141,   231,   232,   123,
-     234,   235,   123,   143,   238,   143,   119,   124,   124,    27,
-     123,   143,   125,   143,    32,   124,    27,   141,   141,   111,
-     146,    32,   125,   143,   532,   125,   119,   527,   141,   125,
-     123,   265,   125,   111,   113,    98,   544,    27,   111,   111,
-     111,   146,    32,    31,    27,   146,    17,   146,   141,    32,
-     550,   146,    27,   287,   143,   111,   290,    32,   292,   117,
-     117,   569,    11,   147,    34,    27,   566,   567,   444,   303,
-      32,   125,   111,   307,   308,   111,   142,   311,   312,   313,
-     314,   142,   316,   142,   318,   319,   320,   321,   322,   323,
-     324,   325,   326,   327,   328,   329,   330,   331,   332,   144,
-     334,   119,    44,   295,   444,   123,    46,   125,   119,   142,
-     142,    45,   123,   577,   125,   444,   350,    43,   240,    52,
-       1,   529,   116,   141,   425,   359,   260,   282,   362,   119,
-     141,   365,   366,   123,   368,   125,   119,   371,   372,   515,
-     123,   516,   125,   213,   119,   522,    -1,    -1,   123,    -1,
-     125,   141,    -1,    -1,    -1,    -1,    -1,   119,   141,    -1,
-      -1,   123,    -1,   125,    -1,    -1,   141,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   515,    -1,    -1,    -1,   141,
-     556,    -1,    -1,    -1,   560,    -1,   515,    -1,    -1,    -1,
-     424,    -1,   426,   427,   428,   429,   430,   431,   432,   433,
-     434,   435,   436,   437,   438,   439,   440,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   448,   449,   556,   451,    -1,    -1,
-     560,    -1,   456,   457,    -1,    -1,    -1,   556,    85,    86,
-      -1,   560,   466,    -1,    -1,    -1,    93,    -1,    95,    96,
-      97,    -1,    99,    -1,    -1,    -1,    -1,    -1,   482,    -1,
-      -1,   485,    -1,    -1,    83,    84,    85,    86,    87,    -1,
-      -1,    90,    91,    92,    93,    -1,    95,    96,    97,    -1,
-      99,    -1,   101,   102,    -1,    -1,    -1,    -1,    -1,    -1,
-     514,    -1,    -1,   140,   141,    -1,   520,    -1,   522,    -1,
-     119,    -1,   121,   122,   123,   124,   125,   126,   127,   128,
-     129,   130,    -1,    -1,    -1,    -1,   540,    -1,    -1,    -1,
-      -1,   140,   141,    -1,    -1,    -1,    -1,   551,   147,    -1,
-       1,   555,    -1,   557,     5,    -1,     7,     8,   562,    10,
-     564,    12,    13,    14,    15,    -1,    -1,    -1,    -1,    20,
-      21,    22,    23,    -1,    -1,    -1,   580,    -1,    -1,    -1,
-      -1,    32,    33,    -1,   588,    36,    37,    -1,    39,    -1,
-      41,    42,    43,    -1,    45,    46,    47,    48,    -1,    50,
+      10,    48,   307,   202,   268,   204,   396,   206,   187,   340,
+     168,   169,   170,    98,    27,    27,    17,    94,   365,    32,
+      32,    51,   353,   111,   371,     0,    28,    17,   111,   124,
+       5,   111,   189,    41,    27,   117,   181,    10,    48,   111,
+     111,   118,    52,   117,    41,     9,    19,   192,   105,    24,
+     145,    26,    25,    28,    18,    30,   111,   145,   142,    48,
+      35,   146,   146,   143,   146,   148,    41,    40,   145,   141,
+     113,   114,   146,    46,    47,    48,    49,    50,    51,    52,
+      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
+      63,    64,    65,    66,    67,    68,    69,    70,    71,    72,
+      73,    74,     4,   111,     6,   115,   119,   119,    27,   111,
+     123,   123,   118,    32,   111,    27,   117,   164,   165,   166,
+      32,   168,   169,   170,   171,   172,   156,   117,   141,   141,
+     123,   144,   144,   523,   481,   111,   144,    29,   111,    27,
+     146,   188,    93,   145,    32,    96,   117,   142,    27,   111,
+     308,   146,   118,    32,   164,   165,   166,   488,   168,   169,
+     170,   171,   172,   117,   343,   117,   141,    94,   141,   216,
+     117,   142,   145,    12,    13,   164,   165,   166,   188,   168,
+     169,   170,   117,   172,   125,   117,   517,   117,   142,   140,
+     141,   118,   144,    85,    86,   141,   395,   144,   529,   188,
+     119,   117,   148,   141,   123,   146,   216,   119,   117,   144,
+     148,   123,   144,   125,   144,    94,    27,   374,   147,   111,
+     267,    32,   141,   144,   143,   146,   236,   216,   275,   141,
+     120,   119,   177,   142,   117,   123,    27,   125,   285,   118,
+     119,    32,    27,   117,   123,   292,   293,    32,   295,   147,
+     147,    27,   149,   141,   559,   142,    32,   267,   305,   146,
+     118,   145,   141,   111,   111,   275,   105,   146,   143,   105,
+     109,   111,   111,   112,   120,   285,    94,   147,   267,    29,
+     225,   226,   292,   293,    29,   295,   275,   143,   113,   234,
+     235,   124,   237,   238,   124,   305,   241,   561,   124,   117,
+     118,   143,   120,   292,   293,   124,   295,   124,   119,    94,
+     467,   468,   123,    94,   125,   124,   305,   474,   124,    27,
+     584,   120,    38,   268,    32,   146,   483,   111,   119,   111,
+     141,   147,   123,   118,   119,   105,   117,   118,   123,   120,
+     144,   117,   143,   119,   123,   143,   291,   123,    27,   294,
+     141,   296,   124,    32,   143,    27,   141,   536,   124,   124,
+      32,   125,   307,   143,   141,   141,   311,   312,   141,   548,
+     315,   316,   317,   318,   531,   320,   143,   322,   323,   324,
+     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
+     335,   336,   111,   338,   573,   146,   125,   554,   113,   114,
+     115,   448,   125,    98,   111,   111,   111,   111,    31,   354,
+     113,   119,   146,   570,   571,   123,   146,   125,   363,   146,
+     146,   366,    17,   143,   369,   370,   111,   372,   117,   117,
+     375,   376,    11,   141,   147,    34,   111,    27,   448,   125,
+     119,   111,    32,   142,   123,   142,   125,   119,   144,   142,
+      27,   123,    44,   125,   299,    32,   581,    46,   142,   448,
+      27,   142,   141,    27,    45,    32,    85,    86,    32,   141,
+      43,   533,   519,     1,    93,   243,    95,    96,    97,   429,
+      99,    52,   117,   428,   216,   430,   431,   432,   433,   434,
+     435,   436,   437,   438,   439,   440,   441,   442,   443,   444,
+     263,   520,   285,   526,    -1,    -1,    -1,   452,   453,   519,
+     455,    -1,    -1,   560,    -1,   460,   461,   564,    -1,    -1,
+      -1,   140,   141,    -1,    -1,   470,    -1,    -1,    -1,   119,
+     519,    -1,    -1,   123,    -1,   125,    -1,    -1,    -1,    -1,
+      -1,   486,   119,    -1,   489,    -1,   123,    -1,   125,    -1,
+     560,   141,   119,    -1,   564,   119,   123,    -1,   125,   123,
+      -1,   125,    -1,    -1,   141,    -1,    -1,    -1,    -1,    -1,
+      -1,   560,    -1,   518,   141,   564,    -1,   141,    -1,   524,
+      -1,   526,    -1,    -1,    -1,    -1,    85,    86,    -1,    -1,
+      -1,    -1,    -1,    -1,    93,    -1,    95,    96,    97,   544,
+      99,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     555,    -1,    -1,     1,   559,    -1,   561,     5,    -1,     7,
+       8,   566,    10,   568,    12,    13,    14,    15,    -1,   128,
+     129,   130,    20,    21,    22,    23,    -1,    -1,    -1,   584,
+      -1,   140,   141,    -1,    32,    33,    -1,   592,    36,    37,
+      -1,    39,    -1,    41,    42,    43,    -1,    45,    46,    47,
+      48,    -1,    50,    51,    52,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    62,    63,    -1,    65,    66,    67,
+      -1,    69,    70,    71,    72,    73,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    85,    86,    -1,    -1,    85,    86,    -1,
+      -1,    93,    -1,    -1,    96,    97,    -1,    99,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   105,   106,   107,
+     108,   109,   110,   111,   112,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   126,   127,
+      -1,    -1,    -1,   131,    -1,    -1,   134,   135,   140,   141,
+      -1,    -1,    -1,   141,    -1,   143,    -1,   145,   146,   147,
+     148,   149,     1,    -1,    -1,    -1,     5,    -1,     7,     8,
+      -1,    10,    -1,    12,    13,    14,    15,    -1,    -1,    -1,
+      -1,    20,    21,    22,    23,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    32,    33,    -1,    -1,    36,    37,    -1,
+      39,    -1,    41,    42,    43,    -1,    45,    46,    47,    48,
+      -1,    50,    51,    52,    53,    54,    55,    56,    57,    58,
+      59,    60,    61,    62,    63,    -1,    65,    66,    67,    -1,
+      69,    70,    71,    72,    73,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    85,    86,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   105,   106,   107,   108,
+     109,   110,   111,   112,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   126,   127,    -1,
+      -1,    -1,   131,    -1,    -1,   134,   135,    -1,    -1,    -1,
+      -1,    -1,   141,    -1,   143,    -1,   145,   146,   147,   148,
+     149,    12,    13,    14,    15,    -1,    -1,    -1,    -1,    -1,
+      21,    -1,    -1,    -1,    -1,    -1,    27,    -1,    -1,    -1,
+      -1,    32,    33,    -1,    -1,    -1,    37,    -1,    39,    -1,
+      -1,    42,    -1,    -1,    45,    46,    47,    48,    -1,    50,
       51,    52,    53,    54,    55,    56,    57,    58,    59,    60,
       61,    62,    63,    -1,    65,    66,    67,    -1,    69,    70,
       71,    72,    73,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      85,    86,    -1,    -1,    85,    86,    -1,    -1,    93,    -1,
-      -1,    96,    97,    -1,    99,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    85,    86,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,   105,   106,   107,   108,   109,   110,
-     111,   112,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   126,   127,    -1,    -1,    -1,
-     131,    -1,    -1,   134,   135,   140,   141,    -1,    -1,    -1,
-     141,    -1,   143,    -1,   145,   146,   147,   148,   149,     1,
-      -1,    -1,    -1,     5,    -1,     7,     8,    -1,    10,    -1,
-      12,    13,    14,    15,    -1,    -1,    -1,    -1,    20,    21,
-      22,    23,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      32,    33,    -1,    -1,    36,    37,    -1,    39,    -1,    41,
-      42,    43,    -1,    45,    46,    47,    48,    -1,    50,    51,
-      52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
-      62,    63,    -1,    65,    66,    67,    -1,    69,    70,    71,
-      72,    73,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    85,    86,    -1,    -1,    -1,    -1,    -1,
+     111,   112,    -1,    -1,    -1,    -1,    -1,    -1,   119,    -1,
+      -1,    -1,   123,    -1,    -1,   126,   127,    -1,    -1,    -1,
+     131,    -1,    -1,   134,   135,    -1,    -1,    -1,    -1,    -1,
+     141,    -1,   143,    -1,   145,    -1,   147,    -1,   149,    12,
+      13,    14,    15,    16,    -1,    -1,    -1,    -1,    21,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      33,    -1,    -1,    -1,    37,    -1,    39,    -1,    -1,    42,
+      -1,    -1,    45,    46,    47,    48,    -1,    50,    51,    52,
+      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
+      63,    -1,    65,    66,    67,    -1,    69,    70,    71,    72,
+      73,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    85,    86,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   105,   106,   107,   108,   109,   110,   111,   112,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   124,    -1,   126,   127,    -1,    -1,    -1,   131,    -1,
+      -1,   134,   135,    -1,    12,    13,    14,    15,   141,    -1,
+     143,    -1,   145,    21,   147,    -1,   149,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    33,    -1,    -1,    -1,    37,
+      -1,    39,    -1,    -1,    42,    -1,    -1,    45,    46,    47,
+      48,    -1,    50,    51,    52,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    62,    63,    -1,    65,    66,    67,
+      -1,    69,    70,    71,    72,    73,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    85,    86,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   105,   106,   107,
+     108,   109,   110,   111,   112,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   126,   127,
+      -1,    -1,    -1,   131,    -1,    -1,   134,   135,    -1,    12,
+      13,    14,    15,   141,   142,   143,    -1,   145,    21,   147,
+      -1,   149,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      33,    -1,    -1,    -1,    37,    -1,    39,    -1,    -1,    42,
+      -1,    -1,    45,    46,    47,    48,    -1,    50,    51,    52,
+      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
+      63,    -1,    65,    66,    67,    -1,    69,    70,    71,    72,
+      73,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    85,    86,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   105,   106,   107,   108,   109,   110,   111,
-     112,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   126,   127,    -1,    -1,    -1,   131,
-      -1,    -1,   134,   135,    -1,    -1,    -1,    -1,    -1,   141,
-      -1,   143,    -1,   145,   146,   147,   148,   149,    12,    13,
-      14,    15,    -1,    -1,    -1,    -1,    -1,    21,    -1,    -1,
-      -1,    -1,    -1,    27,    -1,    -1,    -1,    -1,    32,    33,
-      -1,    -1,    -1,    37,    -1,    39,    -1,    -1,    42,    -1,
+      -1,    -1,   105,   106,   107,   108,   109,   110,   111,   112,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    12,    13,
+      14,    15,    -1,   126,   127,    -1,    -1,    21,   131,    -1,
+      -1,   134,   135,    -1,    -1,    -1,    -1,    -1,   141,    33,
+     143,   144,   145,    37,   147,    39,   149,    -1,    42,    -1,
       -1,    45,    46,    47,    48,    -1,    50,    51,    52,    53,
       54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
       -1,    65,    66,    67,    -1,    69,    70,    71,    72,    73,
@@ -1475,38 +1601,21 @@ static const yytype_int16 yycheck[] =
       -1,    85,    86,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,   105,   106,   107,   108,   109,   110,   111,   112,    -1,
-      -1,    -1,    -1,    -1,    -1,   119,    -1,    -1,    -1,   123,
-      -1,    -1,   126,   127,    -1,    -1,    -1,   131,    -1,    -1,
-     134,   135,    -1,    -1,    -1,    -1,    -1,   141,    -1,   143,
-      -1,   145,    -1,   147,    -1,   149,    12,    13,    14,    15,
-      16,    -1,    -1,    -1,    -1,    21,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    33,    -1,    -1,
-      -1,    37,    -1,    39,    -1,    -1,    42,    -1,    -1,    45,
-      46,    47,    48,    -1,    50,    51,    52,    53,    54,    55,
-      56,    57,    58,    59,    60,    61,    62,    63,    -1,    65,
-      66,    67,    -1,    69,    70,    71,    72,    73,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    85,
-      86,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   105,
-     106,   107,   108,   109,   110,   111,   112,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   124,    -1,
-     126,   127,    -1,    -1,    -1,   131,    -1,    -1,   134,   135,
-      -1,    12,    13,    14,    15,   141,    -1,   143,    -1,   145,
-      21,   147,    -1,   149,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    33,    -1,    -1,    -1,    37,    -1,    39,    -1,
-      -1,    42,    -1,    -1,    45,    46,    47,    48,    -1,    50,
-      51,    52,    53,    54,    55,    56,    57,    58,    59,    60,
-      61,    62,    63,    -1,    65,    66,    67,    -1,    69,    70,
-      71,    72,    73,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    85,    86,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    12,    13,    14,
+      15,    -1,   126,   127,    -1,    -1,    21,   131,    -1,    -1,
+     134,   135,    -1,    -1,    -1,    -1,    -1,   141,    33,   143,
+     144,   145,    37,   147,    39,   149,    -1,    42,    -1,    -1,
+      45,    46,    47,    48,    -1,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    -1,
+      65,    66,    67,    -1,    69,    70,    71,    72,    73,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   105,   106,   107,   108,   109,   110,
-     111,   112,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   126,   127,    -1,    -1,    -1,
-     131,    -1,    -1,   134,   135,    -1,    12,    13,    14,    15,
-     141,   142,   143,    -1,   145,    21,   147,    -1,   149,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    33,    -1,    -1,
-      -1,    37,    -1,    39,    -1,    -1,    42,    -1,    -1,    45,
+      85,    86,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     105,   106,   107,   108,   109,   110,   111,   112,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    12,    13,    14,    15,
+      -1,   126,   127,    -1,    -1,    21,   131,    -1,    -1,   134,
+     135,    -1,    -1,    -1,    -1,    -1,   141,    33,   143,   144,
+     145,    37,   147,    39,   149,    -1,    42,    -1,    -1,    45,
       46,    47,    48,    -1,    50,    51,    52,    53,    54,    55,
       56,    57,    58,    59,    60,    61,    62,    63,    -1,    65,
       66,    67,    -1,    69,    70,    71,    72,    73,    -1,    -1,
@@ -1522,12 +1631,12 @@ static const yytype_int16 yycheck[] =
       57,    58,    59,    60,    61,    62,    63,    -1,    65,    66,
       67,    -1,    69,    70,    71,    72,    73,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    85,    86,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    94,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   105,   106,
      107,   108,   109,   110,   111,   112,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    12,    13,    14,    15,    -1,   126,
      127,    -1,    -1,    21,   131,    -1,    -1,   134,   135,    -1,
-      -1,    -1,    -1,    -1,   141,    33,   143,   144,   145,    37,
+      -1,    -1,    -1,    -1,   141,    33,   143,    -1,   145,    37,
      147,    39,   149,    -1,    42,    -1,    -1,    45,    46,    47,
       48,    -1,    50,    51,    52,    53,    54,    55,    56,    57,
       58,    59,    60,    61,    62,    63,    -1,    65,    66,    67,
@@ -1536,151 +1645,118 @@ static const yytype_int16 yycheck[] =
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,   105,   106,   107,
      108,   109,   110,   111,   112,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    12,    13,    14,    15,    -1,   126,   127,
-      -1,    -1,    21,   131,    -1,    -1,   134,   135,    -1,    -1,
-      -1,    -1,    -1,   141,    33,   143,   144,   145,    37,   147,
-      39,   149,    -1,    42,    -1,    -1,    45,    46,    47,    48,
-      -1,    50,    51,    52,    53,    54,    55,    56,    57,    58,
-      59,    60,    61,    62,    63,    -1,    65,    66,    67,    -1,
-      69,    70,    71,    72,    73,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    85,    86,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   126,   127,
+      -1,    -1,    -1,   131,    -1,    -1,   134,   135,    -1,    12,
+      13,    14,    15,   141,   142,   143,    -1,   145,    21,   147,
+      -1,   149,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      33,    -1,    -1,    -1,    37,    -1,    39,    -1,    -1,    42,
+      -1,    -1,    45,    46,    47,    48,    -1,    50,    51,    52,
+      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
+      63,    -1,    65,    66,    67,    -1,    69,    70,    71,    72,
+      73,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    85,    86,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   105,   106,   107,   108,
-     109,   110,   111,   112,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    12,    13,    14,    15,    -1,   126,   127,    -1,
-      -1,    21,   131,    -1,    -1,   134,   135,    -1,    -1,    -1,
-      -1,    -1,   141,    33,   143,   144,   145,    37,   147,    39,
-     149,    -1,    42,    -1,    -1,    45,    46,    47,    48,    -1,
-      50,    51,    52,    53,    54,    55,    56,    57,    58,    59,
-      60,    61,    62,    63,    -1,    65,    66,    67,    -1,    69,
-      70,    71,    72,    73,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    85,    86,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    94,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   105,   106,   107,   108,   109,
-     110,   111,   112,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    12,    13,    14,    15,    -1,   126,   127,    -1,    -1,
-      21,   131,    -1,    -1,   134,   135,    -1,    -1,    -1,    -1,
-      -1,   141,    33,   143,    -1,   145,    37,   147,    39,   149,
-      -1,    42,    -1,    -1,    45,    46,    47,    48,    -1,    50,
-      51,    52,    53,    54,    55,    56,    57,    58,    59,    60,
-      61,    62,    63,    -1,    65,    66,    67,    -1,    69,    70,
-      71,    72,    73,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    85,    86,    -1,    -1,    -1,    -1,
+      -1,    -1,   105,   106,   107,   108,   109,   110,   111,   112,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    12,    13,
+      14,    15,    -1,   126,   127,    -1,    -1,    21,   131,    -1,
+      -1,   134,   135,    -1,    -1,    -1,    -1,    -1,   141,    33,
+     143,   144,   145,    37,   147,    39,   149,    -1,    42,    -1,
+      -1,    45,    46,    47,    48,    -1,    50,    51,    52,    53,
+      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
+      -1,    65,    66,    67,    -1,    69,    70,    71,    72,    73,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   105,   106,   107,   108,   109,   110,
-     111,   112,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   126,   127,    -1,    -1,    -1,
-     131,    -1,    -1,   134,   135,    -1,    12,    13,    14,    15,
-     141,   142,   143,    -1,   145,    21,   147,    -1,   149,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    33,    -1,    -1,
-      -1,    37,    -1,    39,    -1,    -1,    42,    -1,    -1,    45,
+      -1,    85,    86,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   105,   106,   107,   108,   109,   110,   111,   112,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    12,    13,    14,
+      15,    16,   126,   127,    -1,    -1,    21,   131,    -1,    -1,
+     134,   135,    -1,    -1,    -1,    -1,    -1,   141,    33,   143,
+     144,   145,    37,   147,    39,   149,    -1,    42,    -1,    -1,
+      45,    46,    47,    48,    -1,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    -1,
+      65,    66,    67,    -1,    69,    70,    71,    72,    73,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      85,    86,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     105,   106,   107,   108,   109,   110,   111,   112,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    12,    13,    14,    15,
+      -1,   126,   127,    -1,    -1,    21,   131,    -1,    -1,   134,
+     135,    -1,    -1,    -1,    -1,    -1,   141,    33,   143,    -1,
+     145,    37,   147,    39,   149,    -1,    42,    -1,    -1,    45,
       46,    47,    48,    -1,    50,    51,    52,    53,    54,    55,
       56,    57,    58,    59,    60,    61,    62,    63,    -1,    65,
       66,    67,    -1,    69,    70,    71,    72,    73,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    85,
       86,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   105,
-     106,   107,   108,   109,   110,   111,   112,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    12,    13,    14,    15,    -1,
-     126,   127,    -1,    -1,    21,   131,    -1,    -1,   134,   135,
-      -1,    -1,    -1,    -1,    -1,   141,    33,   143,   144,   145,
-      37,   147,    39,   149,    -1,    42,    -1,    -1,    45,    46,
-      47,    48,    -1,    50,    51,    52,    53,    54,    55,    56,
-      57,    58,    59,    60,    61,    62,    63,    -1,    65,    66,
-      67,    -1,    69,    70,    71,    72,    73,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    85,    86,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   105,   106,
-     107,   108,   109,   110,   111,   112,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    12,    13,    14,    15,    16,   126,
-     127,    -1,    -1,    21,   131,    -1,    -1,   134,   135,    -1,
-      -1,    -1,    -1,    -1,   141,    33,   143,   144,   145,    37,
-     147,    39,   149,    -1,    42,    -1,    -1,    45,    46,    47,
-      48,    -1,    50,    51,    52,    53,    54,    55,    56,    57,
-      58,    59,    60,    61,    62,    63,    -1,    65,    66,    67,
-      -1,    69,    70,    71,    72,    73,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    85,    86,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   105,   106,   107,
-     108,   109,   110,   111,   112,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    12,    13,    14,    15,    -1,   126,   127,
-      -1,    -1,    21,   131,    -1,    -1,   134,   135,    -1,    -1,
-      -1,    -1,    -1,   141,    33,   143,    -1,   145,    37,   147,
-      39,   149,    -1,    42,    -1,    -1,    45,    46,    47,    48,
-      -1,    50,    51,    52,    53,    54,    55,    56,    57,    58,
-      59,    60,    61,    62,    63,    -1,    65,    66,    67,    -1,
-      69,    70,    71,    72,    73,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    85,    86,    -1,    -1,
+     106,   107,   108,   109,   110,   111,   112,    -1,    10,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    19,    -1,    -1,
+     126,   127,    -1,    25,    -1,   131,    -1,    -1,   134,   135,
+      -1,    -1,    -1,    -1,    -1,   141,    -1,   143,    40,   145,
+      -1,   147,    -1,   149,    46,    47,    48,    49,    50,    51,
+      52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
+      62,    63,    64,    65,    66,    67,    68,    69,    70,    71,
+      72,    73,    74,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    19,    -1,    -1,    -1,    -1,    -1,    25,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   105,   106,   107,   108,
-     109,   110,   111,   112,    -1,    10,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    19,    -1,    -1,   126,   127,    -1,
-      25,    -1,   131,    -1,    -1,   134,   135,    -1,    -1,    -1,
-      -1,    -1,   141,    -1,   143,    40,   145,    -1,   147,    -1,
-     149,    46,    47,    48,    49,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
-      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      -1,    -1,    -1,    -1,    40,    -1,    -1,    -1,    -1,   111,
+      46,    47,    48,    49,    50,    51,    52,    53,    54,    55,
+      56,    57,    58,    59,    60,    61,    62,    63,    64,    65,
+      66,    67,    68,    69,    70,    71,    72,    73,    74,    -1,
+      -1,    -1,    -1,   145,    -1,    -1,    -1,    -1,    -1,    19,
+      -1,    -1,    -1,    -1,    -1,    25,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      19,    -1,    -1,    -1,    -1,    -1,    25,    -1,    -1,    -1,
+      40,    -1,    -1,    -1,    -1,   111,    46,    47,    48,    49,
+      50,    51,    52,    53,    54,    55,    56,    57,    58,    59,
+      60,    61,    62,    63,    64,    65,    66,    67,    68,    69,
+      70,    71,    72,    73,    74,    -1,    -1,   143,    -1,   145,
+      -1,    -1,    -1,    -1,    -1,    19,    -1,    -1,    -1,    -1,
+      -1,    25,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    40,    -1,    -1,    -1,
+      -1,   111,    46,    47,    48,    49,    50,    51,    52,    53,
+      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
+      64,    65,    66,    67,    68,    69,    70,    71,    72,    73,
+      74,   141,    -1,    -1,    -1,   145,    -1,    75,    76,    77,
+      78,    79,    80,    81,    82,    83,    84,    85,    86,    87,
+      88,    89,    90,    91,    92,    93,    94,    95,    96,    97,
+      -1,    99,   100,   101,   102,   103,   104,   111,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    40,    -1,    -1,    -1,    -1,   111,    46,    47,    48,
-      49,    50,    51,    52,    53,    54,    55,    56,    57,    58,
-      59,    60,    61,    62,    63,    64,    65,    66,    67,    68,
-      69,    70,    71,    72,    73,    74,   141,    -1,    -1,    -1,
-     145,    -1,    -1,    -1,    -1,    -1,    19,    -1,    -1,    -1,
-      -1,    -1,    25,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    40,    -1,    -1,
-      -1,    -1,   111,    46,    47,    48,    49,    50,    51,    52,
-      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
-      63,    64,    65,    66,    67,    68,    69,    70,    71,    72,
-      73,    74,    -1,    -1,   143,    -1,   145,    -1,    -1,    -1,
-      -1,    -1,    19,    -1,    -1,    -1,    -1,    -1,    25,    -1,
+     118,   119,    -1,   121,   122,   123,   124,   125,   126,   127,
+     128,   129,   130,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   145,   140,   141,    -1,    -1,    -1,    -1,   146,    75,
+      76,    77,    78,    79,    80,    81,    82,    83,    84,    85,
+      86,    87,    88,    89,    90,    91,    92,    93,    94,    95,
+      96,    97,    -1,    99,   100,   101,   102,   103,   104,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    40,    -1,    -1,    -1,    -1,   111,    46,
-      47,    48,    49,    50,    51,    52,    53,    54,    55,    56,
-      57,    58,    59,    60,    61,    62,    63,    64,    65,    66,
-      67,    68,    69,    70,    71,    72,    73,    74,   141,    -1,
-      -1,    -1,   145,    -1,    75,    76,    77,    78,    79,    80,
-      81,    82,    83,    84,    85,    86,    87,    88,    89,    90,
-      91,    92,    93,    94,    95,    96,    97,    -1,    99,   100,
-     101,   102,   103,   104,   111,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   118,   119,    -1,
-     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   145,   140,
-     141,    -1,    -1,    -1,    -1,   146,    75,    76,    77,    78,
-      79,    80,    81,    82,    83,    84,    85,    86,    87,    88,
-      89,    90,    91,    92,    93,    94,    95,    96,    97,    -1,
-      99,   100,   101,   102,   103,   104,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   118,
-     119,    -1,   121,   122,   123,   124,   125,   126,   127,   128,
-     129,   130,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   140,   141,    -1,    -1,    -1,    -1,   146,    75,    76,
+      -1,    -1,   118,   119,    -1,   121,   122,   123,   124,   125,
+     126,   127,   128,   129,   130,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   140,   141,    -1,    -1,    -1,    -1,
+     146,    75,    76,    77,    78,    79,    80,    81,    82,    83,
+      84,    85,    86,    87,    88,    89,    90,    91,    92,    93,
+      94,    95,    96,    97,    98,    99,   100,   101,   102,   103,
+     104,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   118,   119,    -1,   121,   122,   123,
+     124,   125,   126,   127,   128,   129,   130,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   140,   141,    75,    76,
       77,    78,    79,    80,    81,    82,    83,    84,    85,    86,
       87,    88,    89,    90,    91,    92,    93,    94,    95,    96,
-      97,    98,    99,   100,   101,   102,   103,   104,    -1,    -1,
+      97,    -1,    99,   100,   101,   102,   103,   104,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,   118,   119,    -1,   121,   122,   123,   124,   125,   126,
-     127,   128,   129,   130,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   140,   141,    75,    76,    77,    78,    79,
-      80,    81,    82,    83,    84,    85,    86,    87,    88,    89,
-      90,    91,    92,    93,    94,    95,    96,    97,    -1,    99,
-     100,   101,   102,   103,   104,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   118,   119,
-      -1,   121,   122,   123,   124,   125,   126,   127,   128,   129,
-     130,    -1,    -1,    -1,    -1,    83,    84,    85,    86,    87,
-     140,   141,    90,    91,    92,    93,    -1,    95,    96,    97,
-      -1,    99,    -1,   101,   102,    -1,    -1,    -1,    -1,    -1,
+     127,   128,   129,   130,    -1,    -1,    -1,    -1,    83,    84,
+      85,    86,    87,   140,   141,    90,    91,    92,    93,    -1,
+      95,    96,    97,    -1,    99,    -1,   101,   102,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   119,    -1,   121,   122,   123,   124,   125,   126,   127,
-     128,   129,   130,    -1,    -1,    -1,    -1,    83,    84,    85,
-      86,    87,   140,   141,    90,    91,    92,    93,   146,    95,
+      -1,    -1,    -1,    -1,   119,    -1,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   140,   141,    83,    84,    85,
+      86,    87,   147,    -1,    90,    91,    92,    93,    -1,    95,
       96,    97,    -1,    99,    -1,   101,   102,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,   119,    -1,   121,   122,   123,   124,   125,
-     126,   127,   128,   129,   130,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   140,   141,    -1,    -1,   144,    83,
-      84,    85,    86,    87,    -1,    -1,    90,    91,    92,    93,
-      -1,    95,    96,    97,    -1,    99,    -1,   101,   102,    -1,
+     126,   127,   128,   129,   130,    -1,    -1,    -1,    -1,    83,
+      84,    85,    86,    87,   140,   141,    90,    91,    92,    93,
+     146,    95,    96,    97,    -1,    99,    -1,   101,   102,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,   119,    -1,   121,   122,   123,
      124,   125,   126,   127,   128,   129,   130,    -1,    -1,    -1,
@@ -1709,70 +1785,75 @@ static const yytype_int16 yycheck[] =
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,   119,    -1,   121,   122,   123,   124,   125,
      126,   127,   128,   129,   130,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   140,   141,    -1,    -1,   144,    75,
-      76,    77,    78,    79,    80,    81,    82,    83,    84,    85,
-      86,    87,    88,    89,    90,    91,    92,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   101,   102,   103,   104,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   121,   122,   123,   124,   125,
-     126,   127,   128,   129,   130,    -1,    -1,    -1,   134,   135,
-      83,    84,    85,    86,    87,    -1,    -1,    90,    91,    92,
-      93,    -1,    95,    96,    97,    -1,    99,    -1,   101,   102,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   119,    -1,   121,   122,
-     123,   124,   125,   126,   127,   128,   129,   130,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   140,   141,   142,
-      83,    84,    85,    86,    87,    -1,    -1,    90,    91,    92,
-      93,    -1,    95,    96,    97,    -1,    99,    -1,   101,   102,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   119,    -1,   121,   122,
-     123,   124,   125,   126,   127,   128,   129,   130,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   140,   141,   142,
-      83,    84,    85,    86,    87,    -1,    -1,    90,    91,    92,
-      93,    -1,    95,    96,    97,    -1,    99,    -1,   101,   102,
+      -1,    -1,    -1,    -1,   140,   141,    -1,    -1,   144,    83,
+      84,    85,    86,    87,    -1,    -1,    90,    91,    92,    93,
+      -1,    95,    96,    97,    -1,    99,    -1,   101,   102,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   119,   120,   121,   122,
-     123,   124,   125,   126,   127,   128,   129,   130,    -1,    -1,
-      -1,    -1,    83,    84,    85,    86,    87,   140,   141,    90,
+      -1,    -1,    -1,    -1,    -1,   119,    -1,   121,   122,   123,
+     124,   125,   126,   127,   128,   129,   130,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   140,   141,    -1,    -1,
+     144,    75,    76,    77,    78,    79,    80,    81,    82,    83,
+      84,    85,    86,    87,    88,    89,    90,    91,    92,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   101,   102,   103,
+     104,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   121,   122,   123,
+     124,   125,   126,   127,   128,   129,   130,    -1,    -1,    -1,
+     134,   135,    83,    84,    85,    86,    87,    -1,    -1,    90,
+      91,    92,    93,    -1,    95,    96,    97,    -1,    99,    -1,
+     101,   102,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   119,    -1,
+     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   140,
+     141,   142,    83,    84,    85,    86,    87,    -1,    -1,    90,
       91,    92,    93,    -1,    95,    96,    97,    -1,    99,    -1,
      101,   102,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   116,    -1,    -1,   119,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   119,    -1,
+     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   140,
+     141,   142,    83,    84,    85,    86,    87,    -1,    -1,    90,
+      91,    92,    93,    -1,    95,    96,    97,    -1,    99,    -1,
+     101,   102,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   119,   120,
      121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
       -1,    -1,    -1,    -1,    83,    84,    85,    86,    87,   140,
      141,    90,    91,    92,    93,    -1,    95,    96,    97,    -1,
       99,    -1,   101,   102,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   116,    -1,    -1,
      119,    -1,   121,   122,   123,   124,   125,   126,   127,   128,
      129,   130,    -1,    -1,    -1,    -1,    83,    84,    85,    86,
       87,   140,   141,    90,    91,    92,    93,    -1,    95,    96,
       97,    -1,    99,    -1,   101,   102,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   122,   123,   124,   125,   126,
-     127,   128,   129,   130,    -1,    -1,    -1,    -1,    83,    84,
-      85,    86,    87,   140,   141,    90,    91,    92,    93,    -1,
-      95,    96,    97,    -1,    99,    -1,   101,   102,    83,    84,
-      85,    86,    87,    -1,    -1,    90,    91,    92,    93,    -1,
-      95,    96,    97,    -1,    99,    -1,   101,   102,   123,   124,
-     125,   126,   127,   128,   129,   130,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   140,   141,    -1,    -1,   124,
-     125,   126,   127,   128,   129,   130,    -1,    83,    84,    85,
-      86,    87,    -1,    -1,    90,   140,   141,    93,    -1,    95,
-      96,    97,    -1,    99,    -1,   101,   102,    83,    84,    85,
-      86,    -1,    -1,    -1,    -1,    -1,    -1,    93,    -1,    95,
-      96,    97,    -1,    99,    -1,   101,   102,    -1,   124,   125,
+      -1,    -1,   119,    -1,   121,   122,   123,   124,   125,   126,
+     127,   128,   129,   130,    -1,    -1,    -1,    -1,    83,    84,
+      85,    86,    87,   140,   141,    90,    91,    92,    93,    -1,
+      95,    96,    97,    -1,    99,    -1,   101,   102,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,    -1,    -1,    -1,    -1,
+      83,    84,    85,    86,    87,   140,   141,    90,    91,    92,
+      93,    -1,    95,    96,    97,    -1,    99,    -1,   101,   102,
+      83,    84,    85,    86,    87,    -1,    -1,    90,    91,    92,
+      93,    -1,    95,    96,    97,    -1,    99,    -1,   101,   102,
+     123,   124,   125,   126,   127,   128,   129,   130,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   140,   141,    -1,
+      -1,   124,   125,   126,   127,   128,   129,   130,    -1,    83,
+      84,    85,    86,    87,    -1,    -1,    90,   140,   141,    93,
+      -1,    95,    96,    97,    -1,    99,    -1,   101,   102,    83,
+      84,    85,    86,    -1,    -1,    -1,    -1,    -1,    -1,    93,
+      -1,    95,    96,    97,    -1,    99,    -1,   101,   102,    -1,
+     124,   125,   126,   127,   128,   129,   130,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   140,   141,    -1,    85,
+      86,    -1,   126,   127,   128,   129,   130,    93,    -1,    95,
+      96,    97,    -1,    99,    -1,    -1,   140,   141,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
      126,   127,   128,   129,   130,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   140,   141,    -1,    85,    86,    -1,
-     126,   127,   128,   129,   130,    93,    -1,    95,    96,    97,
-      -1,    99,    85,    86,   140,   141,    -1,    -1,    -1,    -1,
-      93,    -1,    95,    96,    97,    -1,    99,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   126,   127,
-     128,   129,   130,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   140,   141,    -1,   128,   129,   130,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   140,   141
+      -1,    -1,    -1,    -1,   140,   141
 };
 
-  /* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-     symbol of state STATE-NUM.  */
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
 static const yytype_uint8 yystos[] =
 {
        0,   151,     0,     5,    24,    26,    28,    30,    35,    41,
@@ -1785,59 +1866,59 @@ static const yytype_uint8 yystos[] =
      105,   162,   159,   213,    19,    25,    40,    46,    47,    48,
       49,    50,    51,    52,    53,    54,    55,    56,    57,    58,
       59,    60,    61,    62,    63,    64,    65,    66,    67,    68,
-      69,    70,    71,    72,    73,    74,   182,   220,   221,   222,
-     223,   111,   169,   171,   120,   216,   147,    75,    76,    77,
-      78,    79,    80,    81,    82,    83,    84,    85,    86,    87,
-      88,    89,    90,    91,    92,   101,   102,   103,   104,   121,
-     122,   123,   124,   125,   126,   127,   128,   129,   130,   134,
-     135,    29,    29,   143,   174,   141,   148,   201,   203,   113,
-     152,   111,   148,   124,   124,   124,   143,   124,   124,   124,
-     124,    27,    32,   119,   123,   141,   144,   182,   204,    41,
-     111,   144,   205,   206,   210,   219,   120,   175,   169,    38,
-     202,   146,   113,   114,   118,   146,   223,   223,   223,   111,
-     174,   223,   174,   223,   174,   223,   207,   208,   223,    27,
-     123,    12,    13,    14,    15,    21,    33,    37,    39,    42,
-      45,    69,    85,    86,   105,   106,   107,   108,   109,   110,
-     112,   126,   127,   131,   134,   135,   141,   142,   143,   147,
-     149,   155,   178,   182,   184,   192,   193,   195,   196,   198,
-     199,   200,   220,   224,   227,   230,   232,   148,   210,   144,
-     146,    94,   117,   118,   120,   209,   223,   178,   142,   210,
-     105,   125,   117,   125,   144,   175,   125,   175,   125,   175,
-     125,   125,   146,   123,   223,   224,   143,   143,   124,   124,
-     143,   124,   143,   200,   200,   154,   200,   200,   182,   200,
-     200,   141,   200,   180,   173,   111,   143,    83,    84,    85,
-      86,    87,    90,    91,    92,    93,    95,    96,    97,    99,
-     101,   102,   119,   121,   122,   123,   124,   125,   126,   127,
-     128,   129,   130,   140,   141,   142,   143,   205,   111,   223,
-     181,   197,   200,   146,   223,   125,   125,   125,   207,   143,
-     111,   200,   223,   223,   200,   223,   144,   200,   114,   115,
-     152,    10,   223,   144,     1,     7,     8,    10,    20,    22,
-      23,    32,    36,    43,   146,   148,   164,   165,   166,   167,
-     179,   181,   183,   185,   186,   187,   188,   190,   191,   197,
-     200,   174,   141,   144,   194,   200,   200,   200,   200,   200,
-     200,   200,   111,   200,   111,   200,   200,   200,   200,   200,
-     200,   200,   200,   200,   200,   200,   200,   200,   200,   200,
-     111,   200,   144,   194,   209,    98,    75,    76,    77,    78,
-      79,    80,    81,    82,    88,    89,    94,   100,   103,   104,
-     118,   125,   144,   194,    16,   124,   200,   144,   125,   125,
-     144,   125,   144,   200,   219,   111,   141,   143,   200,   225,
-     226,   228,   229,   200,   200,   219,    94,   200,   178,   200,
-     200,    31,   146,   146,   146,   146,    17,   189,   146,   175,
-     111,   225,   117,   144,   143,   120,   142,   144,   200,   195,
+      69,    70,    71,    72,    73,    74,   111,   182,   220,   221,
+     222,   223,   111,   169,   171,   120,   216,   147,    75,    76,
+      77,    78,    79,    80,    81,    82,    83,    84,    85,    86,
+      87,    88,    89,    90,    91,    92,   101,   102,   103,   104,
+     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
+     134,   135,    29,    29,   143,   174,   141,   148,   201,   203,
+     113,   152,   111,   148,   124,   124,   124,   143,   124,   124,
+     124,   124,   124,    27,    32,   119,   123,   141,   144,   182,
+     204,    41,   111,   144,   205,   206,   210,   219,   120,   175,
+     169,    38,   202,   146,   113,   114,   118,   146,   223,   223,
+     223,   111,   174,   223,   174,   223,   174,   223,   207,   208,
+     223,   223,    27,   123,    12,    13,    14,    15,    21,    33,
+      37,    39,    42,    45,    69,    85,    86,   105,   106,   107,
+     108,   109,   110,   112,   126,   127,   131,   134,   135,   141,
+     142,   143,   147,   149,   155,   178,   182,   184,   192,   193,
+     195,   196,   198,   199,   200,   220,   224,   227,   230,   232,
+     148,   210,   144,   146,    94,   117,   118,   120,   209,   223,
+     178,   142,   210,   105,   125,   117,   125,   144,   175,   125,
+     175,   125,   175,   125,   125,   146,   125,   123,   223,   224,
+     143,   143,   124,   124,   143,   124,   143,   200,   200,   154,
+     200,   200,   182,   200,   200,   141,   200,   180,   173,   111,
+     143,    83,    84,    85,    86,    87,    90,    91,    92,    93,
+      95,    96,    97,    99,   101,   102,   119,   121,   122,   123,
+     124,   125,   126,   127,   128,   129,   130,   140,   141,   142,
+     143,   205,   111,   223,   181,   197,   200,   146,   223,   125,
+     125,   125,   207,   143,   111,   200,   223,   223,   200,   223,
+     144,   200,   114,   115,   152,    10,   223,   144,     1,     7,
+       8,    10,    20,    22,    23,    32,    36,    43,   146,   148,
+     164,   165,   166,   167,   179,   181,   183,   185,   186,   187,
+     188,   190,   191,   197,   200,   174,   141,   144,   194,   200,
+     200,   200,   200,   200,   200,   200,   111,   200,   111,   200,
      200,   200,   200,   200,   200,   200,   200,   200,   200,   200,
-     200,   200,   200,   200,   200,   144,   223,   111,   144,   200,
-     200,   200,   116,    17,   209,   141,   144,   117,   142,   146,
-     117,   142,   146,   178,   178,    17,   200,    11,   178,   147,
-      34,   211,   219,   178,   142,   200,   144,   194,   200,   144,
-     125,   194,   200,   226,   111,   142,   225,   200,   142,   228,
-       9,    18,   163,   194,   178,   180,   120,   209,   144,   144,
-      16,   200,   146,   142,   209,   178,   200,   146,   148,   223,
-     181,   200,   223,   144,   200,   142,   200,   178,   178,   146,
-     209,   146,   144,   146,   231,   163,   181,   200,    44,   142,
-     146,   200,   142
+     200,   200,   200,   200,   111,   200,   144,   194,   209,    98,
+      75,    76,    77,    78,    79,    80,    81,    82,    88,    89,
+      94,   100,   103,   104,   118,   125,   144,   194,    16,   124,
+     200,   144,   125,   125,   144,   125,   144,   200,   219,   111,
+     141,   143,   200,   225,   226,   228,   229,   200,   200,   219,
+      94,   200,   178,   200,   200,    31,   146,   146,   146,   146,
+      17,   189,   146,   175,   111,   225,   117,   144,   143,   120,
+     142,   144,   200,   195,   200,   200,   200,   200,   200,   200,
+     200,   200,   200,   200,   200,   200,   200,   200,   200,   144,
+     223,   111,   144,   200,   200,   200,   116,    17,   209,   141,
+     144,   117,   142,   146,   117,   142,   146,   178,   178,    17,
+     200,    11,   178,   147,    34,   211,   219,   178,   142,   200,
+     144,   194,   200,   144,   125,   194,   200,   226,   111,   142,
+     225,   200,   142,   228,     9,    18,   163,   194,   178,   180,
+     120,   209,   144,   144,    16,   200,   146,   142,   209,   178,
+     200,   146,   148,   223,   181,   200,   223,   144,   200,   142,
+     200,   178,   178,   146,   209,   146,   144,   146,   231,   163,
+     181,   200,    44,   142,   146,   200,   142
 };
 
-  /* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
 static const yytype_uint8 yyr1[] =
 {
        0,   150,   151,   151,   151,   151,   151,   151,   151,   151,
@@ -1871,13 +1952,13 @@ static const yytype_uint8 yyr1[] =
      220,   220,   220,   220,   220,   220,   220,   221,   222,   222,
      223,   223,   223,   223,   223,   223,   223,   223,   223,   223,
      223,   223,   223,   223,   223,   223,   223,   223,   223,   223,
-     223,   223,   223,   223,   224,   224,   224,   225,   225,   226,
-     226,   227,   227,   228,   228,   229,   229,   230,   231,   231,
-     232
+     223,   223,   223,   223,   223,   224,   224,   224,   225,   225,
+     226,   226,   227,   227,   228,   228,   229,   229,   230,   231,
+     231,   232
 };
 
-  /* YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.  */
-static const yytype_uint8 yyr2[] =
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
 {
        0,     2,     0,     2,     2,     2,     2,     2,     2,     2,
        2,     1,     2,     3,     0,     2,     4,     3,     2,     2,
@@ -1909,46 +1990,46 @@ static const yytype_uint8 yyr2[] =
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     4,
        1,     1,     1,     4,     3,     2,     3,     2,     3,     4,
-       2,     4,     6,     4,     1,     4,     5,     1,     4,     5,
-       1,     4,     5,     4,     1,     1,     1,     3,     5,     1,
-       3,     6,     8,     1,     3,     1,     3,     6,     0,     3,
-      11
+       2,     4,     4,     6,     4,     1,     4,     5,     1,     4,
+       5,     1,     4,     5,     4,     1,     1,     1,     3,     5,
+       1,     3,     6,     8,     1,     3,     1,     3,     6,     0,
+       3,    11
 };
 
 
+enum { YYENOMEM = -2 };
+
 #define yyerrok         (yyerrstatus = 0)
-#define yyclearin       (yychar = YYEMPTY)
-#define YYEMPTY         (-2)
-#define YYEOF           0
+#define yyclearin       (yychar = DAS_YYEMPTY)
 
 #define YYACCEPT        goto yyacceptlab
 #define YYABORT         goto yyabortlab
 #define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
 
 #define YYRECOVERING()  (!!yyerrstatus)
 
-#define YYBACKUP(Token, Value)                                  \
-do                                                              \
-  if (yychar == YYEMPTY)                                        \
-    {                                                           \
-      yychar = (Token);                                         \
-      yylval = (Value);                                         \
-      YYPOPSTACK (yylen);                                       \
-      yystate = *yyssp;                                         \
-      goto yybackup;                                            \
-    }                                                           \
-  else                                                          \
-    {                                                           \
-      yyerror (YY_("syntax error: cannot back up")); \
-      YYERROR;                                                  \
-    }                                                           \
-while (0)
-
-/* Error token number */
-#define YYTERROR        1
-#define YYERRCODE       256
-
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == DAS_YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use DAS_YYerror or DAS_YYUNDEF. */
+#define YYERRCODE DAS_YYUNDEF
 
 /* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
    If N is 0, then set CURRENT to the empty location which ends
@@ -1992,12 +2073,19 @@ do {                                            \
 } while (0)
 
 
-/* YY_LOCATION_PRINT -- Print the location on the stream.
+/* YYLOCATION_PRINT -- Print the location on the stream.
    This macro was not mandated originally: define only if we know
    we won't break user code: when these are the locations we know.  */
 
-#ifndef YY_LOCATION_PRINT
-# if defined DAS_YYLTYPE_IS_TRIVIAL && DAS_YYLTYPE_IS_TRIVIAL
+# ifndef YYLOCATION_PRINT
+
+#  if defined YY_LOCATION_PRINT
+
+   /* Temporary convenience wrapper in case some people defined the
+      undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YYLOCATION_PRINT(File, Loc)  YY_LOCATION_PRINT(File, *(Loc))
+
+#  elif defined DAS_YYLTYPE_IS_TRIVIAL && DAS_YYLTYPE_IS_TRIVIAL
 
 /* Print *YYLOCP on YYO.  Private, do not rely on its existence. */
 
@@ -2025,24 +2113,32 @@ yy_location_print_ (FILE *yyo, YYLTYPE const * const yylocp)
         res += YYFPRINTF (yyo, "-%d", end_col);
     }
   return res;
- }
+}
 
-#  define YY_LOCATION_PRINT(File, Loc)          \
-  yy_location_print_ (File, &(Loc))
+#   define YYLOCATION_PRINT  yy_location_print_
 
-# else
-#  define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-# endif
-#endif
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT(File, Loc)  YYLOCATION_PRINT(File, &(Loc))
+
+#  else
+
+#   define YYLOCATION_PRINT(File, Loc) ((void) 0)
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT  YYLOCATION_PRINT
+
+#  endif
+# endif /* !defined YYLOCATION_PRINT */
 
 
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)                    \
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
 do {                                                                      \
   if (yydebug)                                                            \
     {                                                                     \
       YYFPRINTF (stderr, "%s ", Title);                                   \
       yy_symbol_print (stderr,                                            \
-                  Type, Value, Location); \
+                  Kind, Value, Location); \
       YYFPRINTF (stderr, "\n");                                           \
     }                                                                     \
 } while (0)
@@ -2053,18 +2149,17 @@ do {                                                                      \
 `-----------------------------------*/
 
 static void
-yy_symbol_value_print (FILE *yyo, int yytype, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp)
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp)
 {
   FILE *yyoutput = yyo;
-  YYUSE (yyoutput);
-  YYUSE (yylocationp);
+  YY_USE (yyoutput);
+  YY_USE (yylocationp);
   if (!yyvaluep)
     return;
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyo, yytoknum[yytype], *yyvaluep);
-# endif
-  YYUSE (yytype);
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
@@ -2073,14 +2168,15 @@ yy_symbol_value_print (FILE *yyo, int yytype, YYSTYPE const * const yyvaluep, YY
 `---------------------------*/
 
 static void
-yy_symbol_print (FILE *yyo, int yytype, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp)
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp)
 {
   YYFPRINTF (yyo, "%s %s (",
-             yytype < YYNTOKENS ? "token" : "nterm", yytname[yytype]);
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  YY_LOCATION_PRINT (yyo, *yylocationp);
+  YYLOCATION_PRINT (yyo, yylocationp);
   YYFPRINTF (yyo, ": ");
-  yy_symbol_value_print (yyo, yytype, yyvaluep, yylocationp);
+  yy_symbol_value_print (yyo, yykind, yyvaluep, yylocationp);
   YYFPRINTF (yyo, ")");
 }
 
@@ -2090,7 +2186,7 @@ yy_symbol_print (FILE *yyo, int yytype, YYSTYPE const * const yyvaluep, YYLTYPE
 `------------------------------------------------------------------*/
 
 static void
-yy_stack_print (yytype_int16 *yybottom, yytype_int16 *yytop)
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
 {
   YYFPRINTF (stderr, "Stack now");
   for (; yybottom <= yytop; yybottom++)
@@ -2113,21 +2209,22 @@ do {                                                            \
 `------------------------------------------------*/
 
 static void
-yy_reduce_print (yytype_int16 *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp, int yyrule)
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp,
+                 int yyrule)
 {
-  unsigned long yylno = yyrline[yyrule];
+  int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
   int yyi;
-  YYFPRINTF (stderr, "Reducing stack by rule %d (line %lu):\n",
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
              yyrule - 1, yylno);
   /* The symbols being reduced.  */
   for (yyi = 0; yyi < yynrhs; yyi++)
     {
       YYFPRINTF (stderr, "   $%d = ", yyi + 1);
       yy_symbol_print (stderr,
-                       yystos[yyssp[yyi + 1 - yynrhs]],
-                       &(yyvsp[(yyi + 1) - (yynrhs)])
-                       , &(yylsp[(yyi + 1) - (yynrhs)])                       );
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)],
+                       &(yylsp[(yyi + 1) - (yynrhs)]));
       YYFPRINTF (stderr, "\n");
     }
 }
@@ -2142,8 +2239,8 @@ do {                                    \
    multiple parsers can coexist.  */
 int yydebug;
 #else /* !DAS_YYDEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
 #endif /* !DAS_YYDEBUG */
@@ -2166,630 +2263,411 @@ int yydebug;
 #endif
 
 
-#if YYERROR_VERBOSE
-
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen strlen
-#  else
-/* Return the length of YYSTR.  */
-static YYSIZE_T
-yystrlen (const char *yystr)
-{
-  YYSIZE_T yylen;
-  for (yylen = 0; yystr[yylen]; yylen++)
-    continue;
-  return yylen;
-}
-#  endif
-# endif
-
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
-/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
-   YYDEST.  */
-static char *
-yystpcpy (char *yydest, const char *yysrc)
-{
-  char *yyd = yydest;
-  const char *yys = yysrc;
-
-  while ((*yyd++ = *yys++) != '\0')
-    continue;
-
-  return yyd - 1;
-}
-#  endif
-# endif
-
-# ifndef yytnamerr
-/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
-   quotes and backslashes, so that it's suitable for yyerror.  The
-   heuristic is that double-quoting is unnecessary unless the string
-   contains an apostrophe, a comma, or backslash (other than
-   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
-   null, do not copy; instead, return the length of what the result
-   would have been.  */
-static YYSIZE_T
-yytnamerr (char *yyres, const char *yystr)
-{
-  if (*yystr == '"')
-    {
-      YYSIZE_T yyn = 0;
-      char const *yyp = yystr;
-
-      for (;;)
-        switch (*++yyp)
-          {
-          case '\'':
-          case ',':
-            goto do_not_strip_quotes;
-
-          case '\\':
-            if (*++yyp != '\\')
-              goto do_not_strip_quotes;
-            /* Fall through.  */
-          default:
-            if (yyres)
-              yyres[yyn] = *yyp;
-            yyn++;
-            break;
-
-          case '"':
-            if (yyres)
-              yyres[yyn] = '\0';
-            return yyn;
-          }
-    do_not_strip_quotes: ;
-    }
-
-  if (! yyres)
-    return yystrlen (yystr);
-
-  return (YYSIZE_T) (yystpcpy (yyres, yystr) - yyres);
-}
-# endif
-
-/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
-   about the unexpected token YYTOKEN for the state stack whose top is
-   YYSSP.
-
-   Return 0 if *YYMSG was successfully written.  Return 1 if *YYMSG is
-   not large enough to hold the message.  In that case, also set
-   *YYMSG_ALLOC to the required number of bytes.  Return 2 if the
-   required number of bytes is too large to store.  */
-static int
-yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
-                yytype_int16 *yyssp, int yytoken)
-{
-  YYSIZE_T yysize0 = yytnamerr (YY_NULLPTR, yytname[yytoken]);
-  YYSIZE_T yysize = yysize0;
-  enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-  /* Internationalized format string. */
-  const char *yyformat = YY_NULLPTR;
-  /* Arguments of yyformat. */
-  char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
-  /* Number of reported tokens (one for the "unexpected", one per
-     "expected"). */
-  int yycount = 0;
-
-  /* There are many possibilities here to consider:
-     - If this state is a consistent state with a default action, then
-       the only way this function was invoked is if the default action
-       is an error action.  In that case, don't check for expected
-       tokens because there are none.
-     - The only way there can be no lookahead present (in yychar) is if
-       this state is a consistent state with a default action.  Thus,
-       detecting the absence of a lookahead is sufficient to determine
-       that there is no unexpected or expected token to report.  In that
-       case, just report a simple "syntax error".
-     - Don't assume there isn't a lookahead just because this state is a
-       consistent state with a default action.  There might have been a
-       previous inconsistent state, consistent state with a non-default
-       action, or user semantic action that manipulated yychar.
-     - Of course, the expected token list depends on states to have
-       correct lookahead information, and it depends on the parser not
-       to perform extra reductions after fetching a lookahead from the
-       scanner and before detecting a syntax error.  Thus, state merging
-       (from LALR or IELR) and default reductions corrupt the expected
-       token list.  However, the list is correct for canonical LR with
-       one exception: it will still contain any token that will not be
-       accepted due to an error action in a later state.
-  */
-  if (yytoken != YYEMPTY)
-    {
-      int yyn = yypact[*yyssp];
-      yyarg[yycount++] = yytname[yytoken];
-      if (!yypact_value_is_default (yyn))
-        {
-          /* Start YYX at -YYN if negative to avoid negative indexes in
-             YYCHECK.  In other words, skip the first -YYN actions for
-             this state because they are default actions.  */
-          int yyxbegin = yyn < 0 ? -yyn : 0;
-          /* Stay within bounds of both yycheck and yytname.  */
-          int yychecklim = YYLAST - yyn + 1;
-          int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-          int yyx;
-
-          for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-            if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR
-                && !yytable_value_is_error (yytable[yyx + yyn]))
-              {
-                if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                  {
-                    yycount = 1;
-                    yysize = yysize0;
-                    break;
-                  }
-                yyarg[yycount++] = yytname[yyx];
-                {
-                  YYSIZE_T yysize1 = yysize + yytnamerr (YY_NULLPTR, yytname[yyx]);
-                  if (! (yysize <= yysize1
-                         && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-                    return 2;
-                  yysize = yysize1;
-                }
-              }
-        }
-    }
-
-  switch (yycount)
-    {
-# define YYCASE_(N, S)                      \
-      case N:                               \
-        yyformat = S;                       \
-      break
-    default: /* Avoid compiler warnings. */
-      YYCASE_(0, YY_("syntax error"));
-      YYCASE_(1, YY_("syntax error, unexpected %s"));
-      YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
-      YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
-      YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
-      YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
-# undef YYCASE_
-    }
 
-  {
-    YYSIZE_T yysize1 = yysize + yystrlen (yyformat);
-    if (! (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-      return 2;
-    yysize = yysize1;
-  }
 
-  if (*yymsg_alloc < yysize)
-    {
-      *yymsg_alloc = 2 * yysize;
-      if (! (yysize <= *yymsg_alloc
-             && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
-        *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
-      return 1;
-    }
 
-  /* Avoid sprintf, as that infringes on the user's name space.
-     Don't have undefined behavior even if the translation
-     produced a string with the wrong number of "%s"s.  */
-  {
-    char *yyp = *yymsg;
-    int yyi = 0;
-    while ((*yyp = *yyformat) != '\0')
-      if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
-        {
-          yyp += yytnamerr (yyp, yyarg[yyi++]);
-          yyformat += 2;
-        }
-      else
-        {
-          yyp++;
-          yyformat++;
-        }
-  }
-  return 0;
-}
-#endif /* YYERROR_VERBOSE */
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
 static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep, YYLTYPE *yylocationp)
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, YYLTYPE *yylocationp)
 {
-  YYUSE (yyvaluep);
-  YYUSE (yylocationp);
+  YY_USE (yyvaluep);
+  YY_USE (yylocationp);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-  switch (yytype)
+  switch (yykind)
     {
-          case 111: /* NAME  */
-#line 92 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).s); }
-#line 2412 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_NAME: /* NAME  */
+#line 92 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).s); }
+#line 2291 "generated/ds_parser.cpp"
         break;
 
-    case 152: /* character_sequence  */
-#line 92 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).s); }
-#line 2418 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_character_sequence: /* character_sequence  */
+#line 92 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).s); }
+#line 2297 "generated/ds_parser.cpp"
         break;
 
-    case 153: /* string_constant  */
-#line 92 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).s); }
-#line 2424 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_string_constant: /* string_constant  */
+#line 92 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).s); }
+#line 2303 "generated/ds_parser.cpp"
         break;
 
-    case 154: /* string_builder_body  */
-#line 97 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).pExpression); }
-#line 2430 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_string_builder_body: /* string_builder_body  */
+#line 97 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).pExpression); }
+#line 2309 "generated/ds_parser.cpp"
         break;
 
-    case 155: /* string_builder  */
-#line 97 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).pExpression); }
-#line 2436 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_string_builder: /* string_builder  */
+#line 97 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).pExpression); }
+#line 2315 "generated/ds_parser.cpp"
         break;
 
-    case 163: /* expression_else  */
-#line 97 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).pExpression); }
-#line 2442 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_expression_else: /* expression_else  */
+#line 97 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).pExpression); }
+#line 2321 "generated/ds_parser.cpp"
         break;
 
-    case 164: /* expression_if_then_else  */
-#line 97 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).pExpression); }
-#line 2448 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_expression_if_then_else: /* expression_if_then_else  */
+#line 97 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).pExpression); }
+#line 2327 "generated/ds_parser.cpp"
         break;
 
-    case 165: /* expression_for_loop  */
-#line 97 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).pExpression); }
-#line 2454 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_expression_for_loop: /* expression_for_loop  */
+#line 97 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).pExpression); }
+#line 2333 "generated/ds_parser.cpp"
         break;
 
-    case 166: /* expression_while_loop  */
-#line 97 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).pExpression); }
-#line 2460 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_expression_while_loop: /* expression_while_loop  */
+#line 97 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).pExpression); }
+#line 2339 "generated/ds_parser.cpp"
         break;
 
-    case 167: /* expression_with  */
-#line 97 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).pExpression); }
-#line 2466 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_expression_with: /* expression_with  */
+#line 97 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).pExpression); }
+#line 2345 "generated/ds_parser.cpp"
         break;
 
-    case 168: /* annotation_argument  */
-#line 98 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).aa); }
-#line 2472 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_annotation_argument: /* annotation_argument  */
+#line 98 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).aa); }
+#line 2351 "generated/ds_parser.cpp"
         break;
 
-    case 169: /* annotation_argument_list  */
-#line 99 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).aaList); }
-#line 2478 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_annotation_argument_list: /* annotation_argument_list  */
+#line 99 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).aaList); }
+#line 2357 "generated/ds_parser.cpp"
         break;
 
-    case 170: /* annotation_declaration_name  */
-#line 92 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).s); }
-#line 2484 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_annotation_declaration_name: /* annotation_declaration_name  */
+#line 92 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).s); }
+#line 2363 "generated/ds_parser.cpp"
         break;
 
-    case 171: /* annotation_declaration  */
-#line 100 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).fa); }
-#line 2490 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_annotation_declaration: /* annotation_declaration  */
+#line 100 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).fa); }
+#line 2369 "generated/ds_parser.cpp"
         break;
 
-    case 172: /* annotation_list  */
-#line 101 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).faList); }
-#line 2496 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_annotation_list: /* annotation_list  */
+#line 101 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).faList); }
+#line 2375 "generated/ds_parser.cpp"
         break;
 
-    case 173: /* optional_annotation_list  */
-#line 101 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).faList); }
-#line 2502 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_optional_annotation_list: /* optional_annotation_list  */
+#line 101 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).faList); }
+#line 2381 "generated/ds_parser.cpp"
         break;
 
-    case 174: /* optional_function_argument_list  */
-#line 95 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { deleteVariableDeclarationList(((*yyvaluep).pVarDeclList)); }
-#line 2508 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_optional_function_argument_list: /* optional_function_argument_list  */
+#line 95 "src/parser/ds_parser.ypp"
+            { deleteVariableDeclarationList(((*yyvaluep).pVarDeclList)); }
+#line 2387 "generated/ds_parser.cpp"
         break;
 
-    case 175: /* optional_function_type  */
-#line 96 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).pTypeDecl); }
-#line 2514 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_optional_function_type: /* optional_function_type  */
+#line 96 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).pTypeDecl); }
+#line 2393 "generated/ds_parser.cpp"
         break;
 
-    case 176: /* function_name  */
-#line 92 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).s); }
-#line 2520 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_function_name: /* function_name  */
+#line 92 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).s); }
+#line 2399 "generated/ds_parser.cpp"
         break;
 
-    case 178: /* expression_block  */
-#line 97 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).pExpression); }
-#line 2526 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_expression_block: /* expression_block  */
+#line 97 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).pExpression); }
+#line 2405 "generated/ds_parser.cpp"
         break;
 
-    case 179: /* expression_any  */
-#line 97 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).pExpression); }
-#line 2532 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_expression_any: /* expression_any  */
+#line 97 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).pExpression); }
+#line 2411 "generated/ds_parser.cpp"
         break;
 
-    case 180: /* expressions  */
-#line 97 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).pExpression); }
-#line 2538 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_expressions: /* expressions  */
+#line 97 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).pExpression); }
+#line 2417 "generated/ds_parser.cpp"
         break;
 
-    case 181: /* expr_pipe  */
-#line 97 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).pExpression); }
-#line 2544 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_expr_pipe: /* expr_pipe  */
+#line 97 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).pExpression); }
+#line 2423 "generated/ds_parser.cpp"
         break;
 
-    case 182: /* name_in_namespace  */
-#line 92 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).s); }
-#line 2550 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_name_in_namespace: /* name_in_namespace  */
+#line 92 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).s); }
+#line 2429 "generated/ds_parser.cpp"
         break;
 
-    case 183: /* expression_delete  */
-#line 97 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).pExpression); }
-#line 2556 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_expression_delete: /* expression_delete  */
+#line 97 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).pExpression); }
+#line 2435 "generated/ds_parser.cpp"
         break;
 
-    case 184: /* expr_new  */
-#line 97 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).pExpression); }
-#line 2562 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_expr_new: /* expr_new  */
+#line 97 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).pExpression); }
+#line 2441 "generated/ds_parser.cpp"
         break;
 
-    case 185: /* expression_break  */
-#line 97 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).pExpression); }
-#line 2568 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_expression_break: /* expression_break  */
+#line 97 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).pExpression); }
+#line 2447 "generated/ds_parser.cpp"
         break;
 
-    case 186: /* expression_continue  */
-#line 97 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).pExpression); }
-#line 2574 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_expression_continue: /* expression_continue  */
+#line 97 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).pExpression); }
+#line 2453 "generated/ds_parser.cpp"
         break;
 
-    case 187: /* expression_return  */
-#line 97 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).pExpression); }
-#line 2580 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_expression_return: /* expression_return  */
+#line 97 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).pExpression); }
+#line 2459 "generated/ds_parser.cpp"
         break;
 
-    case 188: /* expression_try_catch  */
-#line 97 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).pExpression); }
-#line 2586 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_expression_try_catch: /* expression_try_catch  */
+#line 97 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).pExpression); }
+#line 2465 "generated/ds_parser.cpp"
         break;
 
-    case 191: /* expression_let  */
-#line 97 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).pExpression); }
-#line 2592 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_expression_let: /* expression_let  */
+#line 97 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).pExpression); }
+#line 2471 "generated/ds_parser.cpp"
         break;
 
-    case 192: /* expr_cast  */
-#line 97 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).pExpression); }
-#line 2598 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_expr_cast: /* expr_cast  */
+#line 97 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).pExpression); }
+#line 2477 "generated/ds_parser.cpp"
         break;
 
-    case 193: /* expr_type_info  */
-#line 97 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).pExpression); }
-#line 2604 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_expr_type_info: /* expr_type_info  */
+#line 97 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).pExpression); }
+#line 2483 "generated/ds_parser.cpp"
         break;
 
-    case 194: /* expr_list  */
-#line 97 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).pExpression); }
-#line 2610 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_expr_list: /* expr_list  */
+#line 97 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).pExpression); }
+#line 2489 "generated/ds_parser.cpp"
         break;
 
-    case 195: /* expr_block  */
-#line 97 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).pExpression); }
-#line 2616 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_expr_block: /* expr_block  */
+#line 97 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).pExpression); }
+#line 2495 "generated/ds_parser.cpp"
         break;
 
-    case 196: /* expr_numeric_const  */
-#line 97 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).pExpression); }
-#line 2622 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_expr_numeric_const: /* expr_numeric_const  */
+#line 97 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).pExpression); }
+#line 2501 "generated/ds_parser.cpp"
         break;
 
-    case 197: /* expr_assign  */
-#line 97 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).pExpression); }
-#line 2628 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_expr_assign: /* expr_assign  */
+#line 97 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).pExpression); }
+#line 2507 "generated/ds_parser.cpp"
         break;
 
-    case 198: /* expr_named_call  */
-#line 97 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).pExpression); }
-#line 2634 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_expr_named_call: /* expr_named_call  */
+#line 97 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).pExpression); }
+#line 2513 "generated/ds_parser.cpp"
         break;
 
-    case 199: /* expr_method_call  */
-#line 97 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).pExpression); }
-#line 2640 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_expr_method_call: /* expr_method_call  */
+#line 97 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).pExpression); }
+#line 2519 "generated/ds_parser.cpp"
         break;
 
-    case 200: /* expr  */
-#line 97 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).pExpression); }
-#line 2646 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_expr: /* expr  */
+#line 97 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).pExpression); }
+#line 2525 "generated/ds_parser.cpp"
         break;
 
-    case 201: /* optional_field_annotation  */
-#line 99 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).aaList); }
-#line 2652 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_optional_field_annotation: /* optional_field_annotation  */
+#line 99 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).aaList); }
+#line 2531 "generated/ds_parser.cpp"
         break;
 
-    case 203: /* structure_variable_declaration  */
-#line 94 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).pVarDecl); }
-#line 2658 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_structure_variable_declaration: /* structure_variable_declaration  */
+#line 94 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).pVarDecl); }
+#line 2537 "generated/ds_parser.cpp"
         break;
 
-    case 204: /* struct_variable_declaration_list  */
-#line 95 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { deleteVariableDeclarationList(((*yyvaluep).pVarDeclList)); }
-#line 2664 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_struct_variable_declaration_list: /* struct_variable_declaration_list  */
+#line 95 "src/parser/ds_parser.ypp"
+            { deleteVariableDeclarationList(((*yyvaluep).pVarDeclList)); }
+#line 2543 "generated/ds_parser.cpp"
         break;
 
-    case 205: /* function_argument_declaration  */
-#line 94 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).pVarDecl); }
-#line 2670 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_function_argument_declaration: /* function_argument_declaration  */
+#line 94 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).pVarDecl); }
+#line 2549 "generated/ds_parser.cpp"
         break;
 
-    case 206: /* function_argument_list  */
-#line 95 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { deleteVariableDeclarationList(((*yyvaluep).pVarDeclList)); }
-#line 2676 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_function_argument_list: /* function_argument_list  */
+#line 95 "src/parser/ds_parser.ypp"
+            { deleteVariableDeclarationList(((*yyvaluep).pVarDeclList)); }
+#line 2555 "generated/ds_parser.cpp"
         break;
 
-    case 207: /* tuple_type  */
-#line 94 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).pVarDecl); }
-#line 2682 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_tuple_type: /* tuple_type  */
+#line 94 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).pVarDecl); }
+#line 2561 "generated/ds_parser.cpp"
         break;
 
-    case 208: /* tuple_type_list  */
-#line 95 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { deleteVariableDeclarationList(((*yyvaluep).pVarDeclList)); }
-#line 2688 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_tuple_type_list: /* tuple_type_list  */
+#line 95 "src/parser/ds_parser.ypp"
+            { deleteVariableDeclarationList(((*yyvaluep).pVarDeclList)); }
+#line 2567 "generated/ds_parser.cpp"
         break;
 
-    case 210: /* variable_declaration  */
-#line 94 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).pVarDecl); }
-#line 2694 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_variable_declaration: /* variable_declaration  */
+#line 94 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).pVarDecl); }
+#line 2573 "generated/ds_parser.cpp"
         break;
 
-    case 211: /* let_variable_declaration  */
-#line 94 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).pVarDecl); }
-#line 2700 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_let_variable_declaration: /* let_variable_declaration  */
+#line 94 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).pVarDecl); }
+#line 2579 "generated/ds_parser.cpp"
         break;
 
-    case 213: /* enum_list  */
-#line 103 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).pEnum); }
-#line 2706 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_enum_list: /* enum_list  */
+#line 103 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).pEnum); }
+#line 2585 "generated/ds_parser.cpp"
         break;
 
-    case 216: /* optional_structure_parent  */
-#line 92 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).s); }
-#line 2712 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_optional_structure_parent: /* optional_structure_parent  */
+#line 92 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).s); }
+#line 2591 "generated/ds_parser.cpp"
         break;
 
-    case 219: /* variable_name_list  */
-#line 93 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).pNameList); }
-#line 2718 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_variable_name_list: /* variable_name_list  */
+#line 93 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).pNameList); }
+#line 2597 "generated/ds_parser.cpp"
         break;
 
-    case 221: /* structure_type_declaration  */
-#line 96 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).pTypeDecl); }
-#line 2724 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_structure_type_declaration: /* structure_type_declaration  */
+#line 96 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).pTypeDecl); }
+#line 2603 "generated/ds_parser.cpp"
         break;
 
-    case 222: /* auto_type_declaration  */
-#line 96 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).pTypeDecl); }
-#line 2730 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_auto_type_declaration: /* auto_type_declaration  */
+#line 96 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).pTypeDecl); }
+#line 2609 "generated/ds_parser.cpp"
         break;
 
-    case 223: /* type_declaration  */
-#line 96 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).pTypeDecl); }
-#line 2736 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_type_declaration: /* type_declaration  */
+#line 96 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).pTypeDecl); }
+#line 2615 "generated/ds_parser.cpp"
         break;
 
-    case 224: /* make_decl  */
-#line 97 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).pExpression); }
-#line 2742 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_make_decl: /* make_decl  */
+#line 97 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).pExpression); }
+#line 2621 "generated/ds_parser.cpp"
         break;
 
-    case 225: /* make_struct_fields  */
-#line 102 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).pMakeStruct); }
-#line 2748 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_make_struct_fields: /* make_struct_fields  */
+#line 102 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).pMakeStruct); }
+#line 2627 "generated/ds_parser.cpp"
         break;
 
-    case 226: /* make_struct_dim  */
-#line 97 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).pExpression); }
-#line 2754 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_make_struct_dim: /* make_struct_dim  */
+#line 97 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).pExpression); }
+#line 2633 "generated/ds_parser.cpp"
         break;
 
-    case 227: /* make_struct_decl  */
-#line 97 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).pExpression); }
-#line 2760 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_make_struct_decl: /* make_struct_decl  */
+#line 97 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).pExpression); }
+#line 2639 "generated/ds_parser.cpp"
         break;
 
-    case 228: /* make_tuple  */
-#line 97 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).pExpression); }
-#line 2766 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_make_tuple: /* make_tuple  */
+#line 97 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).pExpression); }
+#line 2645 "generated/ds_parser.cpp"
         break;
 
-    case 229: /* make_dim  */
-#line 97 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).pExpression); }
-#line 2772 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_make_dim: /* make_dim  */
+#line 97 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).pExpression); }
+#line 2651 "generated/ds_parser.cpp"
         break;
 
-    case 230: /* make_dim_decl  */
-#line 97 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).pExpression); }
-#line 2778 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_make_dim_decl: /* make_dim_decl  */
+#line 97 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).pExpression); }
+#line 2657 "generated/ds_parser.cpp"
         break;
 
-    case 231: /* array_comprehension_where  */
-#line 97 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).pExpression); }
-#line 2784 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_array_comprehension_where: /* array_comprehension_where  */
+#line 97 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).pExpression); }
+#line 2663 "generated/ds_parser.cpp"
         break;
 
-    case 232: /* array_comprehension  */
-#line 97 "src/parser/ds_parser.ypp" /* yacc.c:1254  */
-      { delete ((*yyvaluep).pExpression); }
-#line 2790 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1254  */
+    case YYSYMBOL_array_comprehension: /* array_comprehension  */
+#line 97 "src/parser/ds_parser.ypp"
+            { delete ((*yyvaluep).pExpression); }
+#line 2669 "generated/ds_parser.cpp"
         break;
 
-
       default:
         break;
     }
@@ -2797,9 +2675,7 @@ yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep, YYLTYPE *yylocatio
 }
 
 
-
-
-/* The lookahead symbol.  */
+/* Lookahead token kind.  */
 int yychar;
 
 /* The semantic value of the lookahead symbol.  */
@@ -2814,6 +2690,8 @@ YYLTYPE yylloc
 int yynerrs;
 
 
+
+
 /*----------.
 | yyparse.  |
 `----------*/
@@ -2821,53 +2699,45 @@ int yynerrs;
 int
 yyparse (void)
 {
-    int yystate;
+    yy_state_fast_t yystate = 0;
     /* Number of tokens to shift before error messages enabled.  */
-    int yyerrstatus;
-
-    /* The stacks and their tools:
-       'yyss': related to states.
-       'yyvs': related to semantic values.
-       'yyls': related to locations.
+    int yyerrstatus = 0;
 
-       Refer to the stacks through separate pointers, to allow yyoverflow
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
        to reallocate them elsewhere.  */
 
-    /* The state stack.  */
-    yytype_int16 yyssa[YYINITDEPTH];
-    yytype_int16 *yyss;
-    yytype_int16 *yyssp;
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
 
-    /* The semantic value stack.  */
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
     YYSTYPE yyvsa[YYINITDEPTH];
-    YYSTYPE *yyvs;
-    YYSTYPE *yyvsp;
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
 
-    /* The location stack.  */
+    /* The location stack: array, bottom, top.  */
     YYLTYPE yylsa[YYINITDEPTH];
-    YYLTYPE *yyls;
-    YYLTYPE *yylsp;
-
-    /* The locations where the error started and ended.  */
-    YYLTYPE yyerror_range[3];
-
-    YYSIZE_T yystacksize;
+    YYLTYPE *yyls = yylsa;
+    YYLTYPE *yylsp = yyls;
 
   int yyn;
+  /* The return value of yyparse.  */
   int yyresult;
-  /* Lookahead token as an internal (translated) token number.  */
-  int yytoken = 0;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
   YYLTYPE yyloc;
 
-#if YYERROR_VERBOSE
-  /* Buffer for error messages, and its allocated size.  */
-  char yymsgbuf[128];
-  char *yymsg = yymsgbuf;
-  YYSIZE_T yymsg_alloc = sizeof yymsgbuf;
-#endif
+  /* The locations where the error started and ended.  */
+  YYLTYPE yyerror_range[3];
+
+
 
 #define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N), yylsp -= (N))
 
@@ -2875,43 +2745,49 @@ yyparse (void)
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
-  yyssp = yyss = yyssa;
-  yyvsp = yyvs = yyvsa;
-  yylsp = yyls = yylsa;
-  yystacksize = YYINITDEPTH;
-
   YYDPRINTF ((stderr, "Starting parse\n"));
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
-  yychar = YYEMPTY; /* Cause a token to be read.  */
+  yychar = DAS_YYEMPTY; /* Cause a token to be read.  */
+
   yylsp[0] = yylloc;
   goto yysetstate;
 
+
 /*------------------------------------------------------------.
-| yynewstate -- Push a new state, which is found in yystate.  |
+| yynewstate -- push a new state, which is found in yystate.  |
 `------------------------------------------------------------*/
- yynewstate:
+yynewstate:
   /* In all cases, when you get here, the value and location stacks
      have just been pushed.  So pushing a state here evens the stacks.  */
   yyssp++;
 
- yysetstate:
-  *yyssp = (yytype_int16) yystate;
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
     {
       /* Get the current used size of the three stacks, in elements.  */
-      YYSIZE_T yysize = (YYSIZE_T) (yyssp - yyss + 1);
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
 
-#ifdef yyoverflow
+# if defined yyoverflow
       {
         /* Give user a chance to reallocate the stack.  Use copies of
            these so that the &'s don't force the real ones into
            memory.  */
+        yy_state_t *yyss1 = yyss;
         YYSTYPE *yyvs1 = yyvs;
-        yytype_int16 *yyss1 = yyss;
         YYLTYPE *yyls1 = yyls;
 
         /* Each stack pointer address is followed by the size of the
@@ -2919,31 +2795,29 @@ yyparse (void)
            conditional around just the two extra args, but that might
            be undefined if yyoverflow is a macro.  */
         yyoverflow (YY_("memory exhausted"),
-                    &yyss1, yysize * sizeof (*yyssp),
-                    &yyvs1, yysize * sizeof (*yyvsp),
-                    &yyls1, yysize * sizeof (*yylsp),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yyls1, yysize * YYSIZEOF (*yylsp),
                     &yystacksize);
         yyss = yyss1;
         yyvs = yyvs1;
         yyls = yyls1;
       }
-#else /* no yyoverflow */
-# ifndef YYSTACK_RELOCATE
-      goto yyexhaustedlab;
-# else
+# else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-        goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
         yystacksize = YYMAXDEPTH;
 
       {
-        yytype_int16 *yyss1 = yyss;
+        yy_state_t *yyss1 = yyss;
         union yyalloc *yyptr =
-          (union yyalloc *) YYSTACK_ALLOC (YYSTACK_BYTES (yystacksize));
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
         if (! yyptr)
-          goto yyexhaustedlab;
+          YYNOMEM;
         YYSTACK_RELOCATE (yyss_alloc, yyss);
         YYSTACK_RELOCATE (yyvs_alloc, yyvs);
         YYSTACK_RELOCATE (yyls_alloc, yyls);
@@ -2952,31 +2826,32 @@ yyparse (void)
           YYSTACK_FREE (yyss1);
       }
 # endif
-#endif /* no yyoverflow */
 
       yyssp = yyss + yysize - 1;
       yyvsp = yyvs + yysize - 1;
       yylsp = yyls + yysize - 1;
 
-      YYDPRINTF ((stderr, "Stack size increased to %lu\n",
-                  (unsigned long) yystacksize));
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
 
       if (yyss + yystacksize - 1 <= yyssp)
         YYABORT;
     }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
-  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
 
   if (yystate == YYFINAL)
     YYACCEPT;
 
   goto yybackup;
 
+
 /*-----------.
 | yybackup.  |
 `-----------*/
 yybackup:
-
   /* Do appropriate processing given the current state.  Read a
      lookahead token if we need one and don't already have one.  */
 
@@ -2987,18 +2862,30 @@ yybackup:
 
   /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid lookahead symbol.  */
-  if (yychar == YYEMPTY)
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == DAS_YYEMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
+      YYDPRINTF ((stderr, "Reading a token\n"));
       yychar = yylex ();
     }
 
-  if (yychar <= YYEOF)
+  if (yychar <= DAS_YYEOF)
     {
-      yychar = yytoken = YYEOF;
+      yychar = DAS_YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == DAS_YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = DAS_YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      yyerror_range[1] = yylloc;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -3026,15 +2913,14 @@ yybackup:
 
   /* Shift the lookahead token.  */
   YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
-
-  /* Discard the shifted token.  */
-  yychar = YYEMPTY;
-
   yystate = yyn;
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
   YY_IGNORE_MAYBE_UNINITIALIZED_END
   *++yylsp = yylloc;
+
+  /* Discard the shifted token.  */
+  yychar = DAS_YYEMPTY;
   goto yynewstate;
 
 
@@ -3049,7 +2935,7 @@ yydefault:
 
 
 /*-----------------------------.
-| yyreduce -- Do a reduction.  |
+| yyreduce -- do a reduction.  |
 `-----------------------------*/
 yyreduce:
   /* yyn is the number of a rule to reduce with.  */
@@ -3071,35 +2957,35 @@ yyreduce:
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-        case 11:
-#line 259 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.s) = new string(); *(yyval.s) += (yyvsp[0].ch); }
-#line 3078 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 11: /* character_sequence: STRING_CHARACTER  */
+#line 259 "src/parser/ds_parser.ypp"
+                                                            { (yyval.s) = new string(); *(yyval.s) += (yyvsp[0].ch); }
+#line 2964 "generated/ds_parser.cpp"
     break;
 
-  case 12:
-#line 260 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.s) = (yyvsp[-1].s); *(yyvsp[-1].s) += (yyvsp[0].ch); }
-#line 3084 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 12: /* character_sequence: character_sequence STRING_CHARACTER  */
+#line 260 "src/parser/ds_parser.ypp"
+                                                            { (yyval.s) = (yyvsp[-1].s); *(yyvsp[-1].s) += (yyvsp[0].ch); }
+#line 2970 "generated/ds_parser.cpp"
     break;
 
-  case 13:
-#line 264 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.s) = (yyvsp[-1].s); }
-#line 3090 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 13: /* string_constant: BEGIN_STRING character_sequence END_STRING  */
+#line 264 "src/parser/ds_parser.ypp"
+                                                           { (yyval.s) = (yyvsp[-1].s); }
+#line 2976 "generated/ds_parser.cpp"
     break;
 
-  case 14:
-#line 268 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 14: /* string_builder_body: %empty  */
+#line 268 "src/parser/ds_parser.ypp"
+        {
         (yyval.pExpression) = new ExprStringBuilder();
     }
-#line 3098 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 2984 "generated/ds_parser.cpp"
     break;
 
-  case 15:
-#line 271 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 15: /* string_builder_body: string_builder_body character_sequence  */
+#line 271 "src/parser/ds_parser.ypp"
+                                                           {
         bool err;
         auto esconst = unescapeString(*(yyvsp[0].s),&err);
         if ( err ) das_yyerror("invalid escape sequence",tokAt((yylsp[-1])), CompilationError::invalid_escape_sequence);
@@ -3108,22 +2994,22 @@ yyreduce:
         static_cast<ExprStringBuilder *>((yyvsp[-1].pExpression))->elements.push_back(sc);
         (yyval.pExpression) = (yyvsp[-1].pExpression);
     }
-#line 3112 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 2998 "generated/ds_parser.cpp"
     break;
 
-  case 16:
-#line 280 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 16: /* string_builder_body: string_builder_body BEGIN_STRING_EXPR expr END_STRING_EXPR  */
+#line 280 "src/parser/ds_parser.ypp"
+                                                                                {
         auto se = ExpressionPtr((yyvsp[-1].pExpression));
         static_cast<ExprStringBuilder *>((yyvsp[-3].pExpression))->elements.push_back(se);
         (yyval.pExpression) = (yyvsp[-3].pExpression);
     }
-#line 3122 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 3008 "generated/ds_parser.cpp"
     break;
 
-  case 17:
-#line 288 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 17: /* string_builder: BEGIN_STRING string_builder_body END_STRING  */
+#line 288 "src/parser/ds_parser.ypp"
+                                                        {
         auto strb = static_cast<ExprStringBuilder *>((yyvsp[-1].pExpression));
         if ( strb->elements.size()==0 ) {
             (yyval.pExpression) = new ExprConstString(strb->at,"");
@@ -3136,12 +3022,12 @@ yyreduce:
             (yyval.pExpression) = (yyvsp[-1].pExpression);
         }
     }
-#line 3140 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 3026 "generated/ds_parser.cpp"
     break;
 
-  case 18:
-#line 304 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 18: /* options_declaration: DAS_OPTIONS annotation_argument_list  */
+#line 304 "src/parser/ds_parser.ypp"
+                                                               {
 		if ( g_Program->options.size() ) {
 			g_Program->options.insert ( g_Program->options.begin(),
                 (yyvsp[0].aaList)->begin(), (yyvsp[0].aaList)->end() );
@@ -3159,187 +3045,187 @@ yyreduce:
 		}
 		delete (yyvsp[0].aaList);
 	}
-#line 3163 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 3049 "generated/ds_parser.cpp"
     break;
 
-  case 22:
-#line 334 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 22: /* require_module: NAME  */
+#line 334 "src/parser/ds_parser.ypp"
+                   {
         if ( !g_Program->addModule(*(yyvsp[0].s)) ) {
             das_yyerror("required module not found " + *(yyvsp[0].s),tokAt((yylsp[0])),
                 CompilationError::module_not_found);
         }
         delete (yyvsp[0].s);
     }
-#line 3175 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 3061 "generated/ds_parser.cpp"
     break;
 
-  case 26:
-#line 353 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 26: /* expect_error: INTEGER  */
+#line 353 "src/parser/ds_parser.ypp"
+                   {
         g_Program->expectErrors[CompilationError((yyvsp[0].i))] ++;
     }
-#line 3183 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 3069 "generated/ds_parser.cpp"
     break;
 
-  case 27:
-#line 356 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 27: /* expect_error: INTEGER ':' INTEGER  */
+#line 356 "src/parser/ds_parser.ypp"
+                                      {
         g_Program->expectErrors[CompilationError((yyvsp[-2].i))] += (yyvsp[0].i);
     }
-#line 3191 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 3077 "generated/ds_parser.cpp"
     break;
 
-  case 28:
-#line 362 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = nullptr; }
-#line 3197 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 28: /* expression_else: %empty  */
+#line 362 "src/parser/ds_parser.ypp"
+                                                           { (yyval.pExpression) = nullptr; }
+#line 3083 "generated/ds_parser.cpp"
     break;
 
-  case 29:
-#line 363 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = (yyvsp[0].pExpression); }
-#line 3203 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 29: /* expression_else: DAS_ELSE expression_block  */
+#line 363 "src/parser/ds_parser.ypp"
+                                                           { (yyval.pExpression) = (yyvsp[0].pExpression); }
+#line 3089 "generated/ds_parser.cpp"
     break;
 
-  case 30:
-#line 364 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 30: /* expression_else: DAS_ELIF expr expression_block expression_else  */
+#line 364 "src/parser/ds_parser.ypp"
+                                                                               {
         (yyval.pExpression) = new ExprIfThenElse(tokAt((yylsp[-3])),ExpressionPtr((yyvsp[-2].pExpression)),
             ExpressionPtr((yyvsp[-1].pExpression)),ExpressionPtr((yyvsp[0].pExpression)));
     }
-#line 3212 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 3098 "generated/ds_parser.cpp"
     break;
 
-  case 31:
-#line 371 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 31: /* expression_if_then_else: DAS_IF expr expression_block expression_else  */
+#line 371 "src/parser/ds_parser.ypp"
+                                                                             {
         (yyval.pExpression) = new ExprIfThenElse(tokAt((yylsp[-3])),ExpressionPtr((yyvsp[-2].pExpression)),
             ExpressionPtr((yyvsp[-1].pExpression)),ExpressionPtr((yyvsp[0].pExpression)));
     }
-#line 3221 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 3107 "generated/ds_parser.cpp"
     break;
 
-  case 32:
-#line 378 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 32: /* expression_for_loop: DAS_FOR variable_name_list DAS_IN expr_list ';' expression_block  */
+#line 378 "src/parser/ds_parser.ypp"
+                                                                                                  {
         auto pFor = new ExprFor(tokAt((yylsp[-5])));
         pFor->iterators = *(yyvsp[-4].pNameList);
         delete (yyvsp[-4].pNameList);
         pFor->sources = sequenceToList((yyvsp[-2].pExpression));
         pFor->subexpr = ExpressionPtr((yyvsp[0].pExpression));
         ((ExprBlock *)(yyvsp[0].pExpression))->inTheLoop = true;
-        (yyval.pExpression) = pFor;
+        (yyval.pExpression) = generateFusedFor(pFor);
     }
-#line 3235 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 3121 "generated/ds_parser.cpp"
     break;
 
-  case 33:
-#line 390 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 33: /* expression_while_loop: DAS_WHILE expr expression_block  */
+#line 390 "src/parser/ds_parser.ypp"
+                                                               {
         auto pWhile = new ExprWhile(tokAt((yylsp[-2])));
         pWhile->cond = ExpressionPtr((yyvsp[-1].pExpression));
         pWhile->body = ExpressionPtr((yyvsp[0].pExpression));
         ((ExprBlock *)(yyvsp[0].pExpression))->inTheLoop = true;
         (yyval.pExpression) = pWhile;
     }
-#line 3247 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 3133 "generated/ds_parser.cpp"
     break;
 
-  case 34:
-#line 400 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 34: /* expression_with: DAS_WITH expr expression_block  */
+#line 400 "src/parser/ds_parser.ypp"
+                                                         {
         auto pWith = new ExprWith(tokAt((yylsp[-2])));
         pWith->with = ExpressionPtr((yyvsp[-1].pExpression));
         pWith->body = ExpressionPtr((yyvsp[0].pExpression));
         (yyval.pExpression) = pWith;
     }
-#line 3258 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 3144 "generated/ds_parser.cpp"
     break;
 
-  case 35:
-#line 409 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.aa) = new AnnotationArgument(*(yyvsp[-2].s),*(yyvsp[0].s)); delete (yyvsp[0].s); delete (yyvsp[-2].s); }
-#line 3264 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 35: /* annotation_argument: NAME '=' string_constant  */
+#line 409 "src/parser/ds_parser.ypp"
+                                                { (yyval.aa) = new AnnotationArgument(*(yyvsp[-2].s),*(yyvsp[0].s)); delete (yyvsp[0].s); delete (yyvsp[-2].s); }
+#line 3150 "generated/ds_parser.cpp"
     break;
 
-  case 36:
-#line 410 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.aa) = new AnnotationArgument(*(yyvsp[-2].s),*(yyvsp[0].s)); delete (yyvsp[0].s); delete (yyvsp[-2].s); }
-#line 3270 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 36: /* annotation_argument: NAME '=' NAME  */
+#line 410 "src/parser/ds_parser.ypp"
+                                                { (yyval.aa) = new AnnotationArgument(*(yyvsp[-2].s),*(yyvsp[0].s)); delete (yyvsp[0].s); delete (yyvsp[-2].s); }
+#line 3156 "generated/ds_parser.cpp"
     break;
 
-  case 37:
-#line 411 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.aa) = new AnnotationArgument(*(yyvsp[-2].s),(yyvsp[0].i)); delete (yyvsp[-2].s); }
-#line 3276 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 37: /* annotation_argument: NAME '=' INTEGER  */
+#line 411 "src/parser/ds_parser.ypp"
+                                                { (yyval.aa) = new AnnotationArgument(*(yyvsp[-2].s),(yyvsp[0].i)); delete (yyvsp[-2].s); }
+#line 3162 "generated/ds_parser.cpp"
     break;
 
-  case 38:
-#line 412 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.aa) = new AnnotationArgument(*(yyvsp[-2].s),float((yyvsp[0].fd))); delete (yyvsp[-2].s); }
-#line 3282 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 38: /* annotation_argument: NAME '=' FLOAT  */
+#line 412 "src/parser/ds_parser.ypp"
+                                                { (yyval.aa) = new AnnotationArgument(*(yyvsp[-2].s),float((yyvsp[0].fd))); delete (yyvsp[-2].s); }
+#line 3168 "generated/ds_parser.cpp"
     break;
 
-  case 39:
-#line 413 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.aa) = new AnnotationArgument(*(yyvsp[-2].s),true); delete (yyvsp[-2].s); }
-#line 3288 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 39: /* annotation_argument: NAME '=' DAS_TRUE  */
+#line 413 "src/parser/ds_parser.ypp"
+                                                { (yyval.aa) = new AnnotationArgument(*(yyvsp[-2].s),true); delete (yyvsp[-2].s); }
+#line 3174 "generated/ds_parser.cpp"
     break;
 
-  case 40:
-#line 414 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.aa) = new AnnotationArgument(*(yyvsp[-2].s),false); delete (yyvsp[-2].s); }
-#line 3294 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 40: /* annotation_argument: NAME '=' DAS_FALSE  */
+#line 414 "src/parser/ds_parser.ypp"
+                                                { (yyval.aa) = new AnnotationArgument(*(yyvsp[-2].s),false); delete (yyvsp[-2].s); }
+#line 3180 "generated/ds_parser.cpp"
     break;
 
-  case 41:
-#line 418 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 41: /* annotation_argument_list: annotation_argument  */
+#line 418 "src/parser/ds_parser.ypp"
+                                  {
         (yyval.aaList) = new AnnotationArgumentList();
         (yyval.aaList)->push_back(*(yyvsp[0].aa));
         delete (yyvsp[0].aa);
     }
-#line 3304 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 3190 "generated/ds_parser.cpp"
     break;
 
-  case 42:
-#line 423 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 42: /* annotation_argument_list: annotation_argument_list ',' annotation_argument  */
+#line 423 "src/parser/ds_parser.ypp"
+                                                                    {
             (yyval.aaList) = (yyvsp[-2].aaList);
             (yyval.aaList)->push_back(*(yyvsp[0].aa));
             delete (yyvsp[0].aa);
     }
-#line 3314 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 3200 "generated/ds_parser.cpp"
     break;
 
-  case 43:
-#line 431 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.s) = (yyvsp[0].s); }
-#line 3320 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 43: /* annotation_declaration_name: name_in_namespace  */
+#line 431 "src/parser/ds_parser.ypp"
+                                    { (yyval.s) = (yyvsp[0].s); }
+#line 3206 "generated/ds_parser.cpp"
     break;
 
-  case 44:
-#line 432 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.s) = new string("require"); }
-#line 3326 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 44: /* annotation_declaration_name: DAS_REQUIRE  */
+#line 432 "src/parser/ds_parser.ypp"
+                                    { (yyval.s) = new string("require"); }
+#line 3212 "generated/ds_parser.cpp"
     break;
 
-  case 45:
-#line 436 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 45: /* annotation_declaration: annotation_declaration_name  */
+#line 436 "src/parser/ds_parser.ypp"
+                                          {
         (yyval.fa) = new AnnotationDeclaration();
         if ( auto ann = findAnnotation(*(yyvsp[0].s),tokAt((yylsp[0]))) ) {
             (yyval.fa)->annotation = ann->shared_from_this();
         }
         delete (yyvsp[0].s);
     }
-#line 3338 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 3224 "generated/ds_parser.cpp"
     break;
 
-  case 46:
-#line 443 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 46: /* annotation_declaration: annotation_declaration_name '(' annotation_argument_list ')'  */
+#line 443 "src/parser/ds_parser.ypp"
+                                                                                 {
         (yyval.fa) = new AnnotationDeclaration();
         if ( auto ann = findAnnotation(*(yyvsp[-3].s),tokAt((yylsp[-3]))) ) {
             (yyval.fa)->annotation = ann->shared_from_this();
@@ -3348,303 +3234,303 @@ yyreduce:
         delete (yyvsp[-1].aaList);
         delete (yyvsp[-3].s);
     }
-#line 3352 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 3238 "generated/ds_parser.cpp"
     break;
 
-  case 47:
-#line 455 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 47: /* annotation_list: annotation_declaration  */
+#line 455 "src/parser/ds_parser.ypp"
+                                    {
             (yyval.faList) = new AnnotationList();
             (yyval.faList)->push_back(AnnotationDeclarationPtr((yyvsp[0].fa)));
     }
-#line 3361 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 3247 "generated/ds_parser.cpp"
     break;
 
-  case 48:
-#line 459 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 48: /* annotation_list: annotation_list ',' annotation_declaration  */
+#line 459 "src/parser/ds_parser.ypp"
+                                                              {
         (yyval.faList) = (yyvsp[-2].faList);
         (yyval.faList)->push_back(AnnotationDeclarationPtr((yyvsp[0].fa)));
     }
-#line 3370 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 3256 "generated/ds_parser.cpp"
     break;
 
-  case 49:
-#line 466 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.faList) = nullptr; }
-#line 3376 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 49: /* optional_annotation_list: %empty  */
+#line 466 "src/parser/ds_parser.ypp"
+                                        { (yyval.faList) = nullptr; }
+#line 3262 "generated/ds_parser.cpp"
     break;
 
-  case 50:
-#line 467 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.faList) = (yyvsp[-1].faList); }
-#line 3382 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 50: /* optional_annotation_list: '[' annotation_list ']'  */
+#line 467 "src/parser/ds_parser.ypp"
+                                        { (yyval.faList) = (yyvsp[-1].faList); }
+#line 3268 "generated/ds_parser.cpp"
     break;
 
-  case 51:
-#line 471 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pVarDeclList) = nullptr; }
-#line 3388 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 51: /* optional_function_argument_list: %empty  */
+#line 471 "src/parser/ds_parser.ypp"
+                                                { (yyval.pVarDeclList) = nullptr; }
+#line 3274 "generated/ds_parser.cpp"
     break;
 
-  case 52:
-#line 472 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pVarDeclList) = nullptr; }
-#line 3394 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 52: /* optional_function_argument_list: '(' ')'  */
+#line 472 "src/parser/ds_parser.ypp"
+                                                { (yyval.pVarDeclList) = nullptr; }
+#line 3280 "generated/ds_parser.cpp"
     break;
 
-  case 53:
-#line 473 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pVarDeclList) = (yyvsp[-1].pVarDeclList); }
-#line 3400 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 53: /* optional_function_argument_list: '(' function_argument_list ')'  */
+#line 473 "src/parser/ds_parser.ypp"
+                                                { (yyval.pVarDeclList) = (yyvsp[-1].pVarDeclList); }
+#line 3286 "generated/ds_parser.cpp"
     break;
 
-  case 54:
-#line 477 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 54: /* optional_function_type: %empty  */
+#line 477 "src/parser/ds_parser.ypp"
+        {
         (yyval.pTypeDecl) = new TypeDecl(Type::autoinfer);
         (yyval.pTypeDecl)->at = LineInfo(g_FileAccessStack.back(), yylloc.first_column,yylloc.first_line);
     }
-#line 3409 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 3295 "generated/ds_parser.cpp"
     break;
 
-  case 55:
-#line 481 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 55: /* optional_function_type: ':' type_declaration  */
+#line 481 "src/parser/ds_parser.ypp"
+                                        {
         (yyval.pTypeDecl) = (yyvsp[0].pTypeDecl);
         (yyval.pTypeDecl)->at = tokAt((yylsp[0]));
     }
-#line 3418 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 3304 "generated/ds_parser.cpp"
     break;
 
-  case 56:
-#line 488 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { 
+  case 56: /* function_name: NAME  */
+#line 488 "src/parser/ds_parser.ypp"
+                          { 
 		das_checkName(*(yyvsp[0].s),tokAt((yylsp[0])));
 		(yyval.s) = (yyvsp[0].s); 
 	}
-#line 3427 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 3313 "generated/ds_parser.cpp"
     break;
 
-  case 57:
-#line 492 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.s) = new string("!"); }
-#line 3433 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 57: /* function_name: DAS_OPERATOR '!'  */
+#line 492 "src/parser/ds_parser.ypp"
+                             { (yyval.s) = new string("!"); }
+#line 3319 "generated/ds_parser.cpp"
     break;
 
-  case 58:
-#line 493 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.s) = new string("~"); }
-#line 3439 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 58: /* function_name: DAS_OPERATOR '~'  */
+#line 493 "src/parser/ds_parser.ypp"
+                             { (yyval.s) = new string("~"); }
+#line 3325 "generated/ds_parser.cpp"
     break;
 
-  case 59:
-#line 494 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.s) = new string("+="); }
-#line 3445 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 59: /* function_name: DAS_OPERATOR ADDEQU  */
+#line 494 "src/parser/ds_parser.ypp"
+                             { (yyval.s) = new string("+="); }
+#line 3331 "generated/ds_parser.cpp"
     break;
 
-  case 60:
-#line 495 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.s) = new string("-="); }
-#line 3451 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 60: /* function_name: DAS_OPERATOR SUBEQU  */
+#line 495 "src/parser/ds_parser.ypp"
+                             { (yyval.s) = new string("-="); }
+#line 3337 "generated/ds_parser.cpp"
     break;
 
-  case 61:
-#line 496 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.s) = new string("*="); }
-#line 3457 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 61: /* function_name: DAS_OPERATOR MULEQU  */
+#line 496 "src/parser/ds_parser.ypp"
+                             { (yyval.s) = new string("*="); }
+#line 3343 "generated/ds_parser.cpp"
     break;
 
-  case 62:
-#line 497 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.s) = new string("/="); }
-#line 3463 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 62: /* function_name: DAS_OPERATOR DIVEQU  */
+#line 497 "src/parser/ds_parser.ypp"
+                             { (yyval.s) = new string("/="); }
+#line 3349 "generated/ds_parser.cpp"
     break;
 
-  case 63:
-#line 498 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.s) = new string("%="); }
-#line 3469 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 63: /* function_name: DAS_OPERATOR MODEQU  */
+#line 498 "src/parser/ds_parser.ypp"
+                             { (yyval.s) = new string("%="); }
+#line 3355 "generated/ds_parser.cpp"
     break;
 
-  case 64:
-#line 499 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.s) = new string("&="); }
-#line 3475 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 64: /* function_name: DAS_OPERATOR ANDEQU  */
+#line 499 "src/parser/ds_parser.ypp"
+                             { (yyval.s) = new string("&="); }
+#line 3361 "generated/ds_parser.cpp"
     break;
 
-  case 65:
-#line 500 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.s) = new string("|="); }
-#line 3481 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 65: /* function_name: DAS_OPERATOR OREQU  */
+#line 500 "src/parser/ds_parser.ypp"
+                             { (yyval.s) = new string("|="); }
+#line 3367 "generated/ds_parser.cpp"
     break;
 
-  case 66:
-#line 501 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.s) = new string("^="); }
-#line 3487 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 66: /* function_name: DAS_OPERATOR XOREQU  */
+#line 501 "src/parser/ds_parser.ypp"
+                             { (yyval.s) = new string("^="); }
+#line 3373 "generated/ds_parser.cpp"
     break;
 
-  case 67:
-#line 502 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.s) = new string("+"); }
-#line 3493 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 67: /* function_name: DAS_OPERATOR '+'  */
+#line 502 "src/parser/ds_parser.ypp"
+                             { (yyval.s) = new string("+"); }
+#line 3379 "generated/ds_parser.cpp"
     break;
 
-  case 68:
-#line 503 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.s) = new string("-"); }
-#line 3499 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 68: /* function_name: DAS_OPERATOR '-'  */
+#line 503 "src/parser/ds_parser.ypp"
+                             { (yyval.s) = new string("-"); }
+#line 3385 "generated/ds_parser.cpp"
     break;
 
-  case 69:
-#line 504 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.s) = new string("*"); }
-#line 3505 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 69: /* function_name: DAS_OPERATOR '*'  */
+#line 504 "src/parser/ds_parser.ypp"
+                             { (yyval.s) = new string("*"); }
+#line 3391 "generated/ds_parser.cpp"
     break;
 
-  case 70:
-#line 505 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.s) = new string("/"); }
-#line 3511 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 70: /* function_name: DAS_OPERATOR '/'  */
+#line 505 "src/parser/ds_parser.ypp"
+                             { (yyval.s) = new string("/"); }
+#line 3397 "generated/ds_parser.cpp"
     break;
 
-  case 71:
-#line 506 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.s) = new string("%"); }
-#line 3517 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 71: /* function_name: DAS_OPERATOR '%'  */
+#line 506 "src/parser/ds_parser.ypp"
+                             { (yyval.s) = new string("%"); }
+#line 3403 "generated/ds_parser.cpp"
     break;
 
-  case 72:
-#line 507 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.s) = new string("<"); }
-#line 3523 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 72: /* function_name: DAS_OPERATOR '<'  */
+#line 507 "src/parser/ds_parser.ypp"
+                             { (yyval.s) = new string("<"); }
+#line 3409 "generated/ds_parser.cpp"
     break;
 
-  case 73:
-#line 508 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.s) = new string(">"); }
-#line 3529 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 73: /* function_name: DAS_OPERATOR '>'  */
+#line 508 "src/parser/ds_parser.ypp"
+                             { (yyval.s) = new string(">"); }
+#line 3415 "generated/ds_parser.cpp"
     break;
 
-  case 74:
-#line 509 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.s) = new string("=="); }
-#line 3535 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 74: /* function_name: DAS_OPERATOR EQUEQU  */
+#line 509 "src/parser/ds_parser.ypp"
+                             { (yyval.s) = new string("=="); }
+#line 3421 "generated/ds_parser.cpp"
     break;
 
-  case 75:
-#line 510 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.s) = new string("!="); }
-#line 3541 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 75: /* function_name: DAS_OPERATOR NOTEQU  */
+#line 510 "src/parser/ds_parser.ypp"
+                             { (yyval.s) = new string("!="); }
+#line 3427 "generated/ds_parser.cpp"
     break;
 
-  case 76:
-#line 511 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.s) = new string("<="); }
-#line 3547 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 76: /* function_name: DAS_OPERATOR LEEQU  */
+#line 511 "src/parser/ds_parser.ypp"
+                             { (yyval.s) = new string("<="); }
+#line 3433 "generated/ds_parser.cpp"
     break;
 
-  case 77:
-#line 512 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.s) = new string(">="); }
-#line 3553 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 77: /* function_name: DAS_OPERATOR GREQU  */
+#line 512 "src/parser/ds_parser.ypp"
+                             { (yyval.s) = new string(">="); }
+#line 3439 "generated/ds_parser.cpp"
     break;
 
-  case 78:
-#line 513 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.s) = new string("&"); }
-#line 3559 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 78: /* function_name: DAS_OPERATOR '&'  */
+#line 513 "src/parser/ds_parser.ypp"
+                             { (yyval.s) = new string("&"); }
+#line 3445 "generated/ds_parser.cpp"
     break;
 
-  case 79:
-#line 514 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.s) = new string("|"); }
-#line 3565 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 79: /* function_name: DAS_OPERATOR '|'  */
+#line 514 "src/parser/ds_parser.ypp"
+                             { (yyval.s) = new string("|"); }
+#line 3451 "generated/ds_parser.cpp"
     break;
 
-  case 80:
-#line 515 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.s) = new string("^"); }
-#line 3571 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 80: /* function_name: DAS_OPERATOR '^'  */
+#line 515 "src/parser/ds_parser.ypp"
+                             { (yyval.s) = new string("^"); }
+#line 3457 "generated/ds_parser.cpp"
     break;
 
-  case 81:
-#line 516 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.s) = new string("++"); }
-#line 3577 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 81: /* function_name: ADDADD DAS_OPERATOR  */
+#line 516 "src/parser/ds_parser.ypp"
+                             { (yyval.s) = new string("++"); }
+#line 3463 "generated/ds_parser.cpp"
     break;
 
-  case 82:
-#line 517 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.s) = new string("--"); }
-#line 3583 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 82: /* function_name: SUBSUB DAS_OPERATOR  */
+#line 517 "src/parser/ds_parser.ypp"
+                             { (yyval.s) = new string("--"); }
+#line 3469 "generated/ds_parser.cpp"
     break;
 
-  case 83:
-#line 518 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.s) = new string("+++"); }
-#line 3589 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 83: /* function_name: DAS_OPERATOR ADDADD  */
+#line 518 "src/parser/ds_parser.ypp"
+                             { (yyval.s) = new string("+++"); }
+#line 3475 "generated/ds_parser.cpp"
     break;
 
-  case 84:
-#line 519 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.s) = new string("---"); }
-#line 3595 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 84: /* function_name: DAS_OPERATOR SUBSUB  */
+#line 519 "src/parser/ds_parser.ypp"
+                             { (yyval.s) = new string("---"); }
+#line 3481 "generated/ds_parser.cpp"
     break;
 
-  case 85:
-#line 520 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.s) = new string("<<"); }
-#line 3601 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 85: /* function_name: DAS_OPERATOR SHL  */
+#line 520 "src/parser/ds_parser.ypp"
+                             { (yyval.s) = new string("<<"); }
+#line 3487 "generated/ds_parser.cpp"
     break;
 
-  case 86:
-#line 521 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.s) = new string(">>"); }
-#line 3607 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 86: /* function_name: DAS_OPERATOR SHR  */
+#line 521 "src/parser/ds_parser.ypp"
+                             { (yyval.s) = new string(">>"); }
+#line 3493 "generated/ds_parser.cpp"
     break;
 
-  case 87:
-#line 522 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.s) = new string("<<="); }
-#line 3613 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 87: /* function_name: DAS_OPERATOR SHLEQU  */
+#line 522 "src/parser/ds_parser.ypp"
+                             { (yyval.s) = new string("<<="); }
+#line 3499 "generated/ds_parser.cpp"
     break;
 
-  case 88:
-#line 523 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.s) = new string(">>="); }
-#line 3619 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 88: /* function_name: DAS_OPERATOR SHREQU  */
+#line 523 "src/parser/ds_parser.ypp"
+                             { (yyval.s) = new string(">>="); }
+#line 3505 "generated/ds_parser.cpp"
     break;
 
-  case 89:
-#line 524 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.s) = new string("<<<"); }
-#line 3625 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 89: /* function_name: DAS_OPERATOR ROTL  */
+#line 524 "src/parser/ds_parser.ypp"
+                             { (yyval.s) = new string("<<<"); }
+#line 3511 "generated/ds_parser.cpp"
     break;
 
-  case 90:
-#line 525 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.s) = new string(">>>"); }
-#line 3631 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 90: /* function_name: DAS_OPERATOR ROTR  */
+#line 525 "src/parser/ds_parser.ypp"
+                             { (yyval.s) = new string(">>>"); }
+#line 3517 "generated/ds_parser.cpp"
     break;
 
-  case 91:
-#line 526 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.s) = new string("<<<="); }
-#line 3637 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 91: /* function_name: DAS_OPERATOR ROTLEQU  */
+#line 526 "src/parser/ds_parser.ypp"
+                             { (yyval.s) = new string("<<<="); }
+#line 3523 "generated/ds_parser.cpp"
     break;
 
-  case 92:
-#line 527 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.s) = new string(">>>="); }
-#line 3643 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 92: /* function_name: DAS_OPERATOR ROTREQU  */
+#line 527 "src/parser/ds_parser.ypp"
+                             { (yyval.s) = new string(">>>="); }
+#line 3529 "generated/ds_parser.cpp"
     break;
 
-  case 93:
-#line 532 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 93: /* function_declaration: optional_annotation_list DAS_DEF function_name optional_function_argument_list optional_function_type expression_block  */
+#line 532 "src/parser/ds_parser.ypp"
+                                                                                                         {
         auto pFunction = make_shared<Function>();
         pFunction->at = tokAt((yylsp[-4]));
         pFunction->name = *(yyvsp[-3].s);
@@ -3709,138 +3595,138 @@ yyreduce:
         }
         delete (yyvsp[-3].s);
     }
-#line 3713 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 3599 "generated/ds_parser.cpp"
     break;
 
-  case 94:
-#line 600 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 94: /* expression_block: '{' expressions '}'  */
+#line 600 "src/parser/ds_parser.ypp"
+                                   {
         (yyval.pExpression) = (yyvsp[-1].pExpression);
     }
-#line 3721 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 3607 "generated/ds_parser.cpp"
     break;
 
-  case 95:
-#line 603 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 95: /* expression_block: '{' expressions '}' DAS_FINALLY '{' expressions '}'  */
+#line 603 "src/parser/ds_parser.ypp"
+                                                                          {
         auto pB = (ExprBlock *) (yyvsp[-5].pExpression);
         auto pF = (ExprBlock *) (yyvsp[-1].pExpression);
         swap ( pB->finalList, pF->list );
         (yyval.pExpression) = (yyvsp[-5].pExpression);
         delete (yyvsp[-1].pExpression);
     }
-#line 3733 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 3619 "generated/ds_parser.cpp"
     break;
 
-  case 96:
-#line 613 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = nullptr; }
-#line 3739 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 96: /* expression_any: ';'  */
+#line 613 "src/parser/ds_parser.ypp"
+                                            { (yyval.pExpression) = nullptr; }
+#line 3625 "generated/ds_parser.cpp"
     break;
 
-  case 97:
-#line 614 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = (yyvsp[0].pExpression); }
-#line 3745 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 97: /* expression_any: expr_pipe  */
+#line 614 "src/parser/ds_parser.ypp"
+                                            { (yyval.pExpression) = (yyvsp[0].pExpression); }
+#line 3631 "generated/ds_parser.cpp"
     break;
 
-  case 98:
-#line 615 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = (yyvsp[-1].pExpression); }
-#line 3751 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 98: /* expression_any: expr_assign ';'  */
+#line 615 "src/parser/ds_parser.ypp"
+                                            { (yyval.pExpression) = (yyvsp[-1].pExpression); }
+#line 3637 "generated/ds_parser.cpp"
     break;
 
-  case 99:
-#line 616 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = (yyvsp[-1].pExpression); }
-#line 3757 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 99: /* expression_any: expression_delete ';'  */
+#line 616 "src/parser/ds_parser.ypp"
+                                            { (yyval.pExpression) = (yyvsp[-1].pExpression); }
+#line 3643 "generated/ds_parser.cpp"
     break;
 
-  case 100:
-#line 617 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = (yyvsp[0].pExpression); }
-#line 3763 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 100: /* expression_any: expression_let  */
+#line 617 "src/parser/ds_parser.ypp"
+                                            { (yyval.pExpression) = (yyvsp[0].pExpression); }
+#line 3649 "generated/ds_parser.cpp"
     break;
 
-  case 101:
-#line 618 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = (yyvsp[0].pExpression); }
-#line 3769 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 101: /* expression_any: expression_while_loop  */
+#line 618 "src/parser/ds_parser.ypp"
+                                            { (yyval.pExpression) = (yyvsp[0].pExpression); }
+#line 3655 "generated/ds_parser.cpp"
     break;
 
-  case 102:
-#line 619 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = (yyvsp[0].pExpression); }
-#line 3775 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 102: /* expression_any: expression_with  */
+#line 619 "src/parser/ds_parser.ypp"
+                                            { (yyval.pExpression) = (yyvsp[0].pExpression); }
+#line 3661 "generated/ds_parser.cpp"
     break;
 
-  case 103:
-#line 620 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = (yyvsp[0].pExpression); }
-#line 3781 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 103: /* expression_any: expression_for_loop  */
+#line 620 "src/parser/ds_parser.ypp"
+                                            { (yyval.pExpression) = (yyvsp[0].pExpression); }
+#line 3667 "generated/ds_parser.cpp"
     break;
 
-  case 104:
-#line 621 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = (yyvsp[-1].pExpression); }
-#line 3787 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 104: /* expression_any: expression_break ';'  */
+#line 621 "src/parser/ds_parser.ypp"
+                                            { (yyval.pExpression) = (yyvsp[-1].pExpression); }
+#line 3673 "generated/ds_parser.cpp"
     break;
 
-  case 105:
-#line 622 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = (yyvsp[-1].pExpression); }
-#line 3793 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 105: /* expression_any: expression_continue ';'  */
+#line 622 "src/parser/ds_parser.ypp"
+                                            { (yyval.pExpression) = (yyvsp[-1].pExpression); }
+#line 3679 "generated/ds_parser.cpp"
     break;
 
-  case 106:
-#line 623 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = (yyvsp[-1].pExpression); }
-#line 3799 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 106: /* expression_any: expression_return ';'  */
+#line 623 "src/parser/ds_parser.ypp"
+                                            { (yyval.pExpression) = (yyvsp[-1].pExpression); }
+#line 3685 "generated/ds_parser.cpp"
     break;
 
-  case 107:
-#line 624 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = (yyvsp[0].pExpression); }
-#line 3805 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 107: /* expression_any: expression_if_then_else  */
+#line 624 "src/parser/ds_parser.ypp"
+                                            { (yyval.pExpression) = (yyvsp[0].pExpression); }
+#line 3691 "generated/ds_parser.cpp"
     break;
 
-  case 108:
-#line 625 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = (yyvsp[0].pExpression); }
-#line 3811 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 108: /* expression_any: expression_try_catch  */
+#line 625 "src/parser/ds_parser.ypp"
+                                            { (yyval.pExpression) = (yyvsp[0].pExpression); }
+#line 3697 "generated/ds_parser.cpp"
     break;
 
-  case 109:
-#line 629 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 109: /* expressions: %empty  */
+#line 629 "src/parser/ds_parser.ypp"
+                                                        {
         (yyval.pExpression) = new ExprBlock();
         (yyval.pExpression)->at = tokAt((yyloc));
     }
-#line 3820 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 3706 "generated/ds_parser.cpp"
     break;
 
-  case 110:
-#line 633 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 110: /* expressions: expressions expression_any  */
+#line 633 "src/parser/ds_parser.ypp"
+                                                        {
         (yyval.pExpression) = (yyvsp[-1].pExpression);
         if ( (yyvsp[0].pExpression) ) {
             static_cast<ExprBlock*>((yyvsp[-1].pExpression))->list.push_back(ExpressionPtr((yyvsp[0].pExpression)));
         }
     }
-#line 3831 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 3717 "generated/ds_parser.cpp"
     break;
 
-  case 111:
-#line 639 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 111: /* expressions: expressions error  */
+#line 639 "src/parser/ds_parser.ypp"
+                                 {
         delete (yyvsp[-1].pExpression); (yyval.pExpression) = nullptr; YYABORT;
     }
-#line 3839 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 3725 "generated/ds_parser.cpp"
     break;
 
-  case 112:
-#line 645 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 112: /* expr_pipe: expr_assign LBPIPE expr_block  */
+#line 645 "src/parser/ds_parser.ypp"
+                                                        {
         Expression * pipeCall = (yyvsp[-2].pExpression)->tail();
         if ( pipeCall->rtti_isCallLikeExpr() ) {
             auto pCall = (ExprLooksLikeCall *) pipeCall;
@@ -3851,146 +3737,146 @@ yyreduce:
             (yyval.pExpression) = (yyvsp[-2].pExpression);
         }
     }
-#line 3855 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 3741 "generated/ds_parser.cpp"
     break;
 
-  case 113:
-#line 659 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.s) = (yyvsp[0].s); }
-#line 3861 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 113: /* name_in_namespace: NAME  */
+#line 659 "src/parser/ds_parser.ypp"
+                                               { (yyval.s) = (yyvsp[0].s); }
+#line 3747 "generated/ds_parser.cpp"
     break;
 
-  case 114:
-#line 660 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 114: /* name_in_namespace: NAME COLCOL NAME  */
+#line 660 "src/parser/ds_parser.ypp"
+                                               {
             *(yyvsp[-2].s) += "::";
             *(yyvsp[-2].s) += *(yyvsp[0].s);
             delete (yyvsp[0].s);
             (yyval.s) = (yyvsp[-2].s);
         }
-#line 3872 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 3758 "generated/ds_parser.cpp"
     break;
 
-  case 115:
-#line 666 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { *(yyvsp[0].s) = "::" + *(yyvsp[0].s); (yyval.s) = (yyvsp[0].s); }
-#line 3878 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 115: /* name_in_namespace: COLCOL NAME  */
+#line 666 "src/parser/ds_parser.ypp"
+                                               { *(yyvsp[0].s) = "::" + *(yyvsp[0].s); (yyval.s) = (yyvsp[0].s); }
+#line 3764 "generated/ds_parser.cpp"
     break;
 
-  case 116:
-#line 670 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 116: /* expression_delete: DAS_DELETE expr  */
+#line 670 "src/parser/ds_parser.ypp"
+                                      {
         (yyval.pExpression) = new ExprDelete(tokAt((yylsp[-1])), ExpressionPtr((yyvsp[0].pExpression)));
     }
-#line 3886 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 3772 "generated/ds_parser.cpp"
     break;
 
-  case 117:
-#line 676 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 117: /* expr_new: DAS_NEWT type_declaration  */
+#line 676 "src/parser/ds_parser.ypp"
+                                                   {
         (yyval.pExpression) = new ExprNew(tokAt((yylsp[-1])),TypeDeclPtr((yyvsp[0].pTypeDecl)),false);
     }
-#line 3894 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 3780 "generated/ds_parser.cpp"
     break;
 
-  case 118:
-#line 679 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 118: /* expr_new: DAS_NEWT type_declaration '(' ')'  */
+#line 679 "src/parser/ds_parser.ypp"
+                                                           {
         (yyval.pExpression) = new ExprNew(tokAt((yylsp[-3])),TypeDeclPtr((yyvsp[-2].pTypeDecl)),true);
     }
-#line 3902 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 3788 "generated/ds_parser.cpp"
     break;
 
-  case 119:
-#line 682 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 119: /* expr_new: DAS_NEWT type_declaration '(' expr_list ')'  */
+#line 682 "src/parser/ds_parser.ypp"
+                                                                                {
         auto pNew = new ExprNew(tokAt((yylsp[-4])),TypeDeclPtr((yyvsp[-3].pTypeDecl)),true);
         (yyval.pExpression) = parseFunctionArguments(pNew,(yyvsp[-1].pExpression));
     }
-#line 3911 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 3797 "generated/ds_parser.cpp"
     break;
 
-  case 120:
-#line 686 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 120: /* expr_new: DAS_NEWT make_decl  */
+#line 686 "src/parser/ds_parser.ypp"
+                                    {
         (yyval.pExpression) = new ExprAscend(tokAt((yylsp[-1])),ExpressionPtr((yyvsp[0].pExpression)));
     }
-#line 3919 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 3805 "generated/ds_parser.cpp"
     break;
 
-  case 121:
-#line 692 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprBreak(tokAt((yylsp[0]))); }
-#line 3925 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 121: /* expression_break: DAS_BREAK  */
+#line 692 "src/parser/ds_parser.ypp"
+                       { (yyval.pExpression) = new ExprBreak(tokAt((yylsp[0]))); }
+#line 3811 "generated/ds_parser.cpp"
     break;
 
-  case 122:
-#line 696 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprContinue(tokAt((yylsp[0]))); }
-#line 3931 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 122: /* expression_continue: DAS_CONTINUE  */
+#line 696 "src/parser/ds_parser.ypp"
+                          { (yyval.pExpression) = new ExprContinue(tokAt((yylsp[0]))); }
+#line 3817 "generated/ds_parser.cpp"
     break;
 
-  case 123:
-#line 700 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 123: /* expression_return: DAS_RETURN  */
+#line 700 "src/parser/ds_parser.ypp"
+                        {
         (yyval.pExpression) = new ExprReturn(tokAt((yylsp[0])),nullptr);
     }
-#line 3939 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 3825 "generated/ds_parser.cpp"
     break;
 
-  case 124:
-#line 703 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 124: /* expression_return: DAS_RETURN expr  */
+#line 703 "src/parser/ds_parser.ypp"
+                                      {
         (yyval.pExpression) = new ExprReturn(tokAt((yylsp[-1])),ExpressionPtr((yyvsp[0].pExpression)));
     }
-#line 3947 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 3833 "generated/ds_parser.cpp"
     break;
 
-  case 125:
-#line 706 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 125: /* expression_return: DAS_RETURN LARROW expr  */
+#line 706 "src/parser/ds_parser.ypp"
+                                             {
         auto pRet = new ExprReturn(tokAt((yylsp[-2])),ExpressionPtr((yyvsp[0].pExpression)));
         pRet->moveSemantics = true;
         (yyval.pExpression) = pRet;
     }
-#line 3957 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 3843 "generated/ds_parser.cpp"
     break;
 
-  case 126:
-#line 714 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 126: /* expression_try_catch: DAS_TRY expression_block DAS_CATCH expression_block  */
+#line 714 "src/parser/ds_parser.ypp"
+                                                                                       {
         (yyval.pExpression) = new ExprTryCatch(tokAt((yylsp[-3])),ExpressionPtr((yyvsp[-2].pExpression)),ExpressionPtr((yyvsp[0].pExpression)));
     }
-#line 3965 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 3851 "generated/ds_parser.cpp"
     break;
 
-  case 127:
-#line 720 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.b) = false; }
-#line 3971 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 127: /* let_scope: %empty  */
+#line 720 "src/parser/ds_parser.ypp"
+                    { (yyval.b) = false; }
+#line 3857 "generated/ds_parser.cpp"
     break;
 
-  case 128:
-#line 721 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.b) = true; }
-#line 3977 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 128: /* let_scope: DAS_IN DAS_SCOPE  */
+#line 721 "src/parser/ds_parser.ypp"
+                          { (yyval.b) = true; }
+#line 3863 "generated/ds_parser.cpp"
     break;
 
-  case 129:
-#line 725 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.b) = true; }
-#line 3983 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 129: /* kwd_let: DAS_LET  */
+#line 725 "src/parser/ds_parser.ypp"
+                 { (yyval.b) = true; }
+#line 3869 "generated/ds_parser.cpp"
     break;
 
-  case 130:
-#line 726 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.b) = false; }
-#line 3989 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 130: /* kwd_let: DAS_VAR  */
+#line 726 "src/parser/ds_parser.ypp"
+                 { (yyval.b) = false; }
+#line 3875 "generated/ds_parser.cpp"
     break;
 
-  case 131:
-#line 730 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 131: /* expression_let: kwd_let let_scope let_variable_declaration  */
+#line 730 "src/parser/ds_parser.ypp"
+                                                                  {
         auto pLet = new ExprLet();
         pLet->inScope = (yyvsp[-1].b);
         if ( (yyvsp[0].pVarDecl)->pTypeDecl ) {
@@ -4019,104 +3905,104 @@ yyreduce:
         delete (yyvsp[0].pVarDecl);
         (yyval.pExpression) = pLet;
     }
-#line 4023 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 3909 "generated/ds_parser.cpp"
     break;
 
-  case 132:
-#line 762 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 132: /* expr_cast: DAS_CAST '<' type_declaration '>' expr  */
+#line 762 "src/parser/ds_parser.ypp"
+                                                                   {
         (yyval.pExpression) = new ExprCast(tokAt((yylsp[-4])),ExpressionPtr((yyvsp[0].pExpression)),TypeDeclPtr((yyvsp[-2].pTypeDecl)));
     }
-#line 4031 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 3917 "generated/ds_parser.cpp"
     break;
 
-  case 133:
-#line 765 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 133: /* expr_cast: DAS_UPCAST '<' type_declaration '>' expr  */
+#line 765 "src/parser/ds_parser.ypp"
+                                                                     {
         auto pCast = new ExprCast(tokAt((yylsp[-4])),ExpressionPtr((yyvsp[0].pExpression)),TypeDeclPtr((yyvsp[-2].pTypeDecl)));
         pCast->upcast = true;
         (yyval.pExpression) = pCast;
     }
-#line 4041 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 3927 "generated/ds_parser.cpp"
     break;
 
-  case 134:
-#line 770 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 134: /* expr_cast: DAS_REINTERPRET '<' type_declaration '>' expr  */
+#line 770 "src/parser/ds_parser.ypp"
+                                                                          {
         auto pCast = new ExprCast(tokAt((yylsp[-4])),ExpressionPtr((yyvsp[0].pExpression)),TypeDeclPtr((yyvsp[-2].pTypeDecl)));
         pCast->reinterpret = true;
         (yyval.pExpression) = pCast;
     }
-#line 4051 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 3937 "generated/ds_parser.cpp"
     break;
 
-  case 135:
-#line 778 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 135: /* expr_type_info: DAS_TYPEINFO '(' NAME expr ')'  */
+#line 778 "src/parser/ds_parser.ypp"
+                                                            {
             (yyval.pExpression) = new ExprTypeInfo(tokAt((yylsp[-4])),*(yyvsp[-2].s),ExpressionPtr((yyvsp[-1].pExpression)));
             delete (yyvsp[-2].s);
     }
-#line 4060 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 3946 "generated/ds_parser.cpp"
     break;
 
-  case 136:
-#line 782 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 136: /* expr_type_info: DAS_TYPEINFO '(' NAME '<' NAME '>' expr ')'  */
+#line 782 "src/parser/ds_parser.ypp"
+                                                                                   {
             (yyval.pExpression) = new ExprTypeInfo(tokAt((yylsp[-7])),*(yyvsp[-5].s),ExpressionPtr((yyvsp[-1].pExpression)),*(yyvsp[-3].s));
             delete (yyvsp[-5].s);
             delete (yyvsp[-3].s);
     }
-#line 4070 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 3956 "generated/ds_parser.cpp"
     break;
 
-  case 137:
-#line 787 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 137: /* expr_type_info: DAS_TYPEINFO '(' NAME DAS_TYPE type_declaration ')'  */
+#line 787 "src/parser/ds_parser.ypp"
+                                                                              {
             (yyval.pExpression) = new ExprTypeInfo(tokAt((yylsp[-5])),*(yyvsp[-3].s),TypeDeclPtr((yyvsp[-1].pTypeDecl)));
             delete (yyvsp[-3].s);
     }
-#line 4079 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 3965 "generated/ds_parser.cpp"
     break;
 
-  case 138:
-#line 791 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 138: /* expr_type_info: DAS_TYPEINFO '(' NAME '<' NAME '>' DAS_TYPE type_declaration ')'  */
+#line 791 "src/parser/ds_parser.ypp"
+                                                                                                    {
             (yyval.pExpression) = new ExprTypeInfo(tokAt((yylsp[-8])),*(yyvsp[-6].s),TypeDeclPtr((yyvsp[-1].pTypeDecl)),*(yyvsp[-4].s));
             delete (yyvsp[-6].s);
             delete (yyvsp[-4].s);
     }
-#line 4089 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 3975 "generated/ds_parser.cpp"
     break;
 
-  case 139:
-#line 799 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 139: /* expr_list: expr  */
+#line 799 "src/parser/ds_parser.ypp"
+                      {
         (yyval.pExpression) = (yyvsp[0].pExpression);
     }
-#line 4097 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 3983 "generated/ds_parser.cpp"
     break;
 
-  case 140:
-#line 802 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 140: /* expr_list: expr_list ',' expr  */
+#line 802 "src/parser/ds_parser.ypp"
+                                            {
             (yyval.pExpression) = new ExprSequence(tokAt((yylsp[-2])),ExpressionPtr((yyvsp[-2].pExpression)),ExpressionPtr((yyvsp[0].pExpression)));
     }
-#line 4105 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 3991 "generated/ds_parser.cpp"
     break;
 
-  case 141:
-#line 808 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 141: /* expr_block: expression_block  */
+#line 808 "src/parser/ds_parser.ypp"
+                                            {
         ExprBlock * closure = (ExprBlock *) (yyvsp[0].pExpression);
         (yyval.pExpression) = new ExprMakeBlock(tokAt((yylsp[0])),ExpressionPtr((yyvsp[0].pExpression)));
         closure->returnType = make_shared<TypeDecl>(Type::autoinfer);
     }
-#line 4115 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 4001 "generated/ds_parser.cpp"
     break;
 
-  case 142:
-#line 814 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 142: /* expr_block: '$' optional_annotation_list optional_function_argument_list optional_function_type expression_block  */
+#line 814 "src/parser/ds_parser.ypp"
+                                                                                       {
         (yyval.pExpression) = new ExprMakeBlock(tokAt((yylsp[0])),ExpressionPtr((yyvsp[0].pExpression)));
         ExprBlock * closure = (ExprBlock *) (yyvsp[0].pExpression);
         closure->returnType = TypeDeclPtr((yyvsp[-1].pTypeDecl));
@@ -4163,514 +4049,514 @@ yyreduce:
             delete (yyvsp[-3].faList);
         }
     }
-#line 4167 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 4053 "generated/ds_parser.cpp"
     break;
 
-  case 143:
-#line 864 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprConstInt(tokAt((yylsp[0])),(int32_t)(yyvsp[0].i)); }
-#line 4173 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 143: /* expr_numeric_const: INTEGER  */
+#line 864 "src/parser/ds_parser.ypp"
+                                              { (yyval.pExpression) = new ExprConstInt(tokAt((yylsp[0])),(int32_t)(yyvsp[0].i)); }
+#line 4059 "generated/ds_parser.cpp"
     break;
 
-  case 144:
-#line 865 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprConstUInt(tokAt((yylsp[0])),(uint32_t)(yyvsp[0].ui)); }
-#line 4179 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 144: /* expr_numeric_const: UNSIGNED_INTEGER  */
+#line 865 "src/parser/ds_parser.ypp"
+                                              { (yyval.pExpression) = new ExprConstUInt(tokAt((yylsp[0])),(uint32_t)(yyvsp[0].ui)); }
+#line 4065 "generated/ds_parser.cpp"
     break;
 
-  case 145:
-#line 866 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprConstInt64(tokAt((yylsp[0])),(int64_t)(yyvsp[0].i64)); }
-#line 4185 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 145: /* expr_numeric_const: LONG_INTEGER  */
+#line 866 "src/parser/ds_parser.ypp"
+                                              { (yyval.pExpression) = new ExprConstInt64(tokAt((yylsp[0])),(int64_t)(yyvsp[0].i64)); }
+#line 4071 "generated/ds_parser.cpp"
     break;
 
-  case 146:
-#line 867 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprConstUInt64(tokAt((yylsp[0])),(uint64_t)(yyvsp[0].ui64)); }
-#line 4191 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 146: /* expr_numeric_const: UNSIGNED_LONG_INTEGER  */
+#line 867 "src/parser/ds_parser.ypp"
+                                              { (yyval.pExpression) = new ExprConstUInt64(tokAt((yylsp[0])),(uint64_t)(yyvsp[0].ui64)); }
+#line 4077 "generated/ds_parser.cpp"
     break;
 
-  case 147:
-#line 868 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprConstFloat(tokAt((yylsp[0])),(float)(yyvsp[0].fd)); }
-#line 4197 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 147: /* expr_numeric_const: FLOAT  */
+#line 868 "src/parser/ds_parser.ypp"
+                                              { (yyval.pExpression) = new ExprConstFloat(tokAt((yylsp[0])),(float)(yyvsp[0].fd)); }
+#line 4083 "generated/ds_parser.cpp"
     break;
 
-  case 148:
-#line 869 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprConstDouble(tokAt((yylsp[0])),(double)(yyvsp[0].d)); }
-#line 4203 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 148: /* expr_numeric_const: DOUBLE  */
+#line 869 "src/parser/ds_parser.ypp"
+                                                  { (yyval.pExpression) = new ExprConstDouble(tokAt((yylsp[0])),(double)(yyvsp[0].d)); }
+#line 4089 "generated/ds_parser.cpp"
     break;
 
-  case 149:
-#line 873 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = (yyvsp[0].pExpression); }
-#line 4209 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 149: /* expr_assign: expr  */
+#line 873 "src/parser/ds_parser.ypp"
+                                             { (yyval.pExpression) = (yyvsp[0].pExpression); }
+#line 4095 "generated/ds_parser.cpp"
     break;
 
-  case 150:
-#line 874 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprCopy(tokAt((yylsp[-1])),ExpressionPtr((yyvsp[-2].pExpression)),ExpressionPtr((yyvsp[0].pExpression))); }
-#line 4215 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 150: /* expr_assign: expr '=' expr  */
+#line 874 "src/parser/ds_parser.ypp"
+                                             { (yyval.pExpression) = new ExprCopy(tokAt((yylsp[-1])),ExpressionPtr((yyvsp[-2].pExpression)),ExpressionPtr((yyvsp[0].pExpression))); }
+#line 4101 "generated/ds_parser.cpp"
     break;
 
-  case 151:
-#line 875 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprMove(tokAt((yylsp[-1])),ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
-#line 4221 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 151: /* expr_assign: expr LARROW expr  */
+#line 875 "src/parser/ds_parser.ypp"
+                                             { (yyval.pExpression) = new ExprMove(tokAt((yylsp[-1])),ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
+#line 4107 "generated/ds_parser.cpp"
     break;
 
-  case 152:
-#line 876 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprClone(tokAt((yylsp[-1])),ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
-#line 4227 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 152: /* expr_assign: expr CLONEEQU expr  */
+#line 876 "src/parser/ds_parser.ypp"
+                                             { (yyval.pExpression) = new ExprClone(tokAt((yylsp[-1])),ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
+#line 4113 "generated/ds_parser.cpp"
     break;
 
-  case 153:
-#line 877 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"&=", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
-#line 4233 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 153: /* expr_assign: expr ANDEQU expr  */
+#line 877 "src/parser/ds_parser.ypp"
+                                             { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"&=", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
+#line 4119 "generated/ds_parser.cpp"
     break;
 
-  case 154:
-#line 878 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"|=", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
-#line 4239 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 154: /* expr_assign: expr OREQU expr  */
+#line 878 "src/parser/ds_parser.ypp"
+                                             { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"|=", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
+#line 4125 "generated/ds_parser.cpp"
     break;
 
-  case 155:
-#line 879 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"^=", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
-#line 4245 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 155: /* expr_assign: expr XOREQU expr  */
+#line 879 "src/parser/ds_parser.ypp"
+                                             { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"^=", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
+#line 4131 "generated/ds_parser.cpp"
     break;
 
-  case 156:
-#line 880 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"+=", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
-#line 4251 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 156: /* expr_assign: expr ADDEQU expr  */
+#line 880 "src/parser/ds_parser.ypp"
+                                             { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"+=", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
+#line 4137 "generated/ds_parser.cpp"
     break;
 
-  case 157:
-#line 881 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"-=", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
-#line 4257 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 157: /* expr_assign: expr SUBEQU expr  */
+#line 881 "src/parser/ds_parser.ypp"
+                                             { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"-=", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
+#line 4143 "generated/ds_parser.cpp"
     break;
 
-  case 158:
-#line 882 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"*=", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
-#line 4263 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 158: /* expr_assign: expr MULEQU expr  */
+#line 882 "src/parser/ds_parser.ypp"
+                                             { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"*=", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
+#line 4149 "generated/ds_parser.cpp"
     break;
 
-  case 159:
-#line 883 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"/=", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
-#line 4269 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 159: /* expr_assign: expr DIVEQU expr  */
+#line 883 "src/parser/ds_parser.ypp"
+                                             { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"/=", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
+#line 4155 "generated/ds_parser.cpp"
     break;
 
-  case 160:
-#line 884 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"%=", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
-#line 4275 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 160: /* expr_assign: expr MODEQU expr  */
+#line 884 "src/parser/ds_parser.ypp"
+                                             { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"%=", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
+#line 4161 "generated/ds_parser.cpp"
     break;
 
-  case 161:
-#line 885 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"<<=", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
-#line 4281 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 161: /* expr_assign: expr SHLEQU expr  */
+#line 885 "src/parser/ds_parser.ypp"
+                                             { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"<<=", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
+#line 4167 "generated/ds_parser.cpp"
     break;
 
-  case 162:
-#line 886 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),">>=", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
-#line 4287 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 162: /* expr_assign: expr SHREQU expr  */
+#line 886 "src/parser/ds_parser.ypp"
+                                             { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),">>=", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
+#line 4173 "generated/ds_parser.cpp"
     break;
 
-  case 163:
-#line 887 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"<<<=", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
-#line 4293 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 163: /* expr_assign: expr ROTLEQU expr  */
+#line 887 "src/parser/ds_parser.ypp"
+                                             { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"<<<=", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
+#line 4179 "generated/ds_parser.cpp"
     break;
 
-  case 164:
-#line 888 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),">>>=", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
-#line 4299 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 164: /* expr_assign: expr ROTREQU expr  */
+#line 888 "src/parser/ds_parser.ypp"
+                                             { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),">>>=", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
+#line 4185 "generated/ds_parser.cpp"
     break;
 
-  case 165:
-#line 892 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 165: /* expr_named_call: name_in_namespace '(' '[' make_struct_fields ']' ')'  */
+#line 892 "src/parser/ds_parser.ypp"
+                                                                         {
         auto nc = new ExprNamedCall(tokAt((yylsp[-5])),*(yyvsp[-5].s));
         nc->arguments = *(yyvsp[-2].pMakeStruct);
         delete (yyvsp[-2].pMakeStruct);
         delete (yyvsp[-5].s);
         (yyval.pExpression) = nc;
     }
-#line 4311 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 4197 "generated/ds_parser.cpp"
     break;
 
-  case 166:
-#line 903 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 166: /* expr_method_call: expr RARROW NAME '(' ')'  */
+#line 903 "src/parser/ds_parser.ypp"
+                                                         {
         auto pInvoke = makeInvokeMethod(tokAt((yylsp[-3])), (yyvsp[-4].pExpression), *(yyvsp[-2].s));
         delete (yyvsp[-2].s);
         (yyval.pExpression) = pInvoke;
     }
-#line 4321 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 4207 "generated/ds_parser.cpp"
     break;
 
-  case 167:
-#line 908 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 167: /* expr_method_call: expr RARROW NAME '(' expr_list ')'  */
+#line 908 "src/parser/ds_parser.ypp"
+                                                                              {
         auto pInvoke = makeInvokeMethod(tokAt((yylsp[-4])), (yyvsp[-5].pExpression), *(yyvsp[-3].s));
         auto callArgs = sequenceToList((yyvsp[-1].pExpression));
         pInvoke->arguments.insert ( pInvoke->arguments.end(), callArgs.begin(), callArgs.end() );
         delete (yyvsp[-3].s);
         (yyval.pExpression) = pInvoke;
     }
-#line 4333 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 4219 "generated/ds_parser.cpp"
     break;
 
-  case 168:
-#line 918 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprConstPtr(tokAt((yylsp[0])),nullptr); }
-#line 4339 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 168: /* expr: DAS_NULL  */
+#line 918 "src/parser/ds_parser.ypp"
+                                              { (yyval.pExpression) = new ExprConstPtr(tokAt((yylsp[0])),nullptr); }
+#line 4225 "generated/ds_parser.cpp"
     break;
 
-  case 169:
-#line 919 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprVar(tokAt((yylsp[0])),*(yyvsp[0].s)); delete (yyvsp[0].s); }
-#line 4345 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 169: /* expr: name_in_namespace  */
+#line 919 "src/parser/ds_parser.ypp"
+                                              { (yyval.pExpression) = new ExprVar(tokAt((yylsp[0])),*(yyvsp[0].s)); delete (yyvsp[0].s); }
+#line 4231 "generated/ds_parser.cpp"
     break;
 
-  case 170:
-#line 920 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = (yyvsp[0].pExpression); }
-#line 4351 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 170: /* expr: expr_numeric_const  */
+#line 920 "src/parser/ds_parser.ypp"
+                                              { (yyval.pExpression) = (yyvsp[0].pExpression); }
+#line 4237 "generated/ds_parser.cpp"
     break;
 
-  case 171:
-#line 921 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = (yyvsp[0].pExpression); }
-#line 4357 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 171: /* expr: string_builder  */
+#line 921 "src/parser/ds_parser.ypp"
+                                              { (yyval.pExpression) = (yyvsp[0].pExpression); }
+#line 4243 "generated/ds_parser.cpp"
     break;
 
-  case 172:
-#line 922 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = (yyvsp[0].pExpression); }
-#line 4363 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 172: /* expr: make_decl  */
+#line 922 "src/parser/ds_parser.ypp"
+                                              { (yyval.pExpression) = (yyvsp[0].pExpression); }
+#line 4249 "generated/ds_parser.cpp"
     break;
 
-  case 173:
-#line 923 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprConstBool(tokAt((yylsp[0])),true); }
-#line 4369 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 173: /* expr: DAS_TRUE  */
+#line 923 "src/parser/ds_parser.ypp"
+                                              { (yyval.pExpression) = new ExprConstBool(tokAt((yylsp[0])),true); }
+#line 4255 "generated/ds_parser.cpp"
     break;
 
-  case 174:
-#line 924 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprConstBool(tokAt((yylsp[0])),false); }
-#line 4375 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 174: /* expr: DAS_FALSE  */
+#line 924 "src/parser/ds_parser.ypp"
+                                              { (yyval.pExpression) = new ExprConstBool(tokAt((yylsp[0])),false); }
+#line 4261 "generated/ds_parser.cpp"
     break;
 
-  case 175:
-#line 925 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprOp1(tokAt((yylsp[-1])),"!",ExpressionPtr((yyvsp[0].pExpression))); }
-#line 4381 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 175: /* expr: '!' expr  */
+#line 925 "src/parser/ds_parser.ypp"
+                                              { (yyval.pExpression) = new ExprOp1(tokAt((yylsp[-1])),"!",ExpressionPtr((yyvsp[0].pExpression))); }
+#line 4267 "generated/ds_parser.cpp"
     break;
 
-  case 176:
-#line 926 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprOp1(tokAt((yylsp[-1])),"~",ExpressionPtr((yyvsp[0].pExpression))); }
-#line 4387 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 176: /* expr: '~' expr  */
+#line 926 "src/parser/ds_parser.ypp"
+                                              { (yyval.pExpression) = new ExprOp1(tokAt((yylsp[-1])),"~",ExpressionPtr((yyvsp[0].pExpression))); }
+#line 4273 "generated/ds_parser.cpp"
     break;
 
-  case 177:
-#line 927 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprOp1(tokAt((yylsp[-1])),"+",ExpressionPtr((yyvsp[0].pExpression))); }
-#line 4393 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 177: /* expr: '+' expr  */
+#line 927 "src/parser/ds_parser.ypp"
+                                                  { (yyval.pExpression) = new ExprOp1(tokAt((yylsp[-1])),"+",ExpressionPtr((yyvsp[0].pExpression))); }
+#line 4279 "generated/ds_parser.cpp"
     break;
 
-  case 178:
-#line 928 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprOp1(tokAt((yylsp[-1])),"-",ExpressionPtr((yyvsp[0].pExpression))); }
-#line 4399 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 178: /* expr: '-' expr  */
+#line 928 "src/parser/ds_parser.ypp"
+                                                  { (yyval.pExpression) = new ExprOp1(tokAt((yylsp[-1])),"-",ExpressionPtr((yyvsp[0].pExpression))); }
+#line 4285 "generated/ds_parser.cpp"
     break;
 
-  case 179:
-#line 929 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"<<", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
-#line 4405 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 179: /* expr: expr SHL expr  */
+#line 929 "src/parser/ds_parser.ypp"
+                                             { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"<<", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
+#line 4291 "generated/ds_parser.cpp"
     break;
 
-  case 180:
-#line 930 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),">>", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
-#line 4411 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 180: /* expr: expr SHR expr  */
+#line 930 "src/parser/ds_parser.ypp"
+                                             { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),">>", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
+#line 4297 "generated/ds_parser.cpp"
     break;
 
-  case 181:
-#line 931 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"<<<", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
-#line 4417 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 181: /* expr: expr ROTL expr  */
+#line 931 "src/parser/ds_parser.ypp"
+                                             { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"<<<", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
+#line 4303 "generated/ds_parser.cpp"
     break;
 
-  case 182:
-#line 932 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),">>>", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
-#line 4423 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 182: /* expr: expr ROTR expr  */
+#line 932 "src/parser/ds_parser.ypp"
+                                             { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),">>>", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
+#line 4309 "generated/ds_parser.cpp"
     break;
 
-  case 183:
-#line 933 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"+", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
-#line 4429 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 183: /* expr: expr '+' expr  */
+#line 933 "src/parser/ds_parser.ypp"
+                                             { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"+", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
+#line 4315 "generated/ds_parser.cpp"
     break;
 
-  case 184:
-#line 934 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"-", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
-#line 4435 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 184: /* expr: expr '-' expr  */
+#line 934 "src/parser/ds_parser.ypp"
+                                             { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"-", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
+#line 4321 "generated/ds_parser.cpp"
     break;
 
-  case 185:
-#line 935 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"*", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
-#line 4441 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 185: /* expr: expr '*' expr  */
+#line 935 "src/parser/ds_parser.ypp"
+                                             { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"*", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
+#line 4327 "generated/ds_parser.cpp"
     break;
 
-  case 186:
-#line 936 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"/", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
-#line 4447 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 186: /* expr: expr '/' expr  */
+#line 936 "src/parser/ds_parser.ypp"
+                                             { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"/", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
+#line 4333 "generated/ds_parser.cpp"
     break;
 
-  case 187:
-#line 937 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"%", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
-#line 4453 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 187: /* expr: expr '%' expr  */
+#line 937 "src/parser/ds_parser.ypp"
+                                             { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"%", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
+#line 4339 "generated/ds_parser.cpp"
     break;
 
-  case 188:
-#line 938 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"<", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
-#line 4459 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 188: /* expr: expr '<' expr  */
+#line 938 "src/parser/ds_parser.ypp"
+                                             { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"<", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
+#line 4345 "generated/ds_parser.cpp"
     break;
 
-  case 189:
-#line 939 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),">", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
-#line 4465 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 189: /* expr: expr '>' expr  */
+#line 939 "src/parser/ds_parser.ypp"
+                                             { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),">", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
+#line 4351 "generated/ds_parser.cpp"
     break;
 
-  case 190:
-#line 940 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"==", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
-#line 4471 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 190: /* expr: expr EQUEQU expr  */
+#line 940 "src/parser/ds_parser.ypp"
+                                             { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"==", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
+#line 4357 "generated/ds_parser.cpp"
     break;
 
-  case 191:
-#line 941 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"!=", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
-#line 4477 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 191: /* expr: expr NOTEQU expr  */
+#line 941 "src/parser/ds_parser.ypp"
+                                             { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"!=", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
+#line 4363 "generated/ds_parser.cpp"
     break;
 
-  case 192:
-#line 942 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"<=", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
-#line 4483 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 192: /* expr: expr LEEQU expr  */
+#line 942 "src/parser/ds_parser.ypp"
+                                             { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"<=", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
+#line 4369 "generated/ds_parser.cpp"
     break;
 
-  case 193:
-#line 943 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),">=", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
-#line 4489 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 193: /* expr: expr GREQU expr  */
+#line 943 "src/parser/ds_parser.ypp"
+                                             { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),">=", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
+#line 4375 "generated/ds_parser.cpp"
     break;
 
-  case 194:
-#line 944 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"&", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
-#line 4495 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 194: /* expr: expr '&' expr  */
+#line 944 "src/parser/ds_parser.ypp"
+                                             { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"&", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
+#line 4381 "generated/ds_parser.cpp"
     break;
 
-  case 195:
-#line 945 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"|", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
-#line 4501 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 195: /* expr: expr '|' expr  */
+#line 945 "src/parser/ds_parser.ypp"
+                                             { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"|", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
+#line 4387 "generated/ds_parser.cpp"
     break;
 
-  case 196:
-#line 946 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"^", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
-#line 4507 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 196: /* expr: expr '^' expr  */
+#line 946 "src/parser/ds_parser.ypp"
+                                             { (yyval.pExpression) = new ExprOp2(tokAt((yylsp[-1])),"^", ExpressionPtr((yyvsp[-2].pExpression)), ExpressionPtr((yyvsp[0].pExpression))); }
+#line 4393 "generated/ds_parser.cpp"
     break;
 
-  case 197:
-#line 947 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprOp1(tokAt((yylsp[-1])),"++", ExpressionPtr((yyvsp[0].pExpression))); }
-#line 4513 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 197: /* expr: ADDADD expr  */
+#line 947 "src/parser/ds_parser.ypp"
+                                                 { (yyval.pExpression) = new ExprOp1(tokAt((yylsp[-1])),"++", ExpressionPtr((yyvsp[0].pExpression))); }
+#line 4399 "generated/ds_parser.cpp"
     break;
 
-  case 198:
-#line 948 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprOp1(tokAt((yylsp[-1])),"--", ExpressionPtr((yyvsp[0].pExpression))); }
-#line 4519 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 198: /* expr: SUBSUB expr  */
+#line 948 "src/parser/ds_parser.ypp"
+                                                 { (yyval.pExpression) = new ExprOp1(tokAt((yylsp[-1])),"--", ExpressionPtr((yyvsp[0].pExpression))); }
+#line 4405 "generated/ds_parser.cpp"
     break;
 
-  case 199:
-#line 949 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprOp1(tokAt((yylsp[0])),"+++", ExpressionPtr((yyvsp[-1].pExpression))); }
-#line 4525 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 199: /* expr: expr ADDADD  */
+#line 949 "src/parser/ds_parser.ypp"
+                                                 { (yyval.pExpression) = new ExprOp1(tokAt((yylsp[0])),"+++", ExpressionPtr((yyvsp[-1].pExpression))); }
+#line 4411 "generated/ds_parser.cpp"
     break;
 
-  case 200:
-#line 950 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprOp1(tokAt((yylsp[0])),"---", ExpressionPtr((yyvsp[-1].pExpression))); }
-#line 4531 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 200: /* expr: expr SUBSUB  */
+#line 950 "src/parser/ds_parser.ypp"
+                                                 { (yyval.pExpression) = new ExprOp1(tokAt((yylsp[0])),"---", ExpressionPtr((yyvsp[-1].pExpression))); }
+#line 4417 "generated/ds_parser.cpp"
     break;
 
-  case 201:
-#line 951 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = (yyvsp[-1].pExpression); }
-#line 4537 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 201: /* expr: '(' expr ')'  */
+#line 951 "src/parser/ds_parser.ypp"
+                                                 { (yyval.pExpression) = (yyvsp[-1].pExpression); }
+#line 4423 "generated/ds_parser.cpp"
     break;
 
-  case 202:
-#line 952 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprAt(tokAt((yylsp[-2])), ExpressionPtr((yyvsp[-3].pExpression)), ExpressionPtr((yyvsp[-1].pExpression))); }
-#line 4543 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 202: /* expr: expr '[' expr ']'  */
+#line 952 "src/parser/ds_parser.ypp"
+                                                 { (yyval.pExpression) = new ExprAt(tokAt((yylsp[-2])), ExpressionPtr((yyvsp[-3].pExpression)), ExpressionPtr((yyvsp[-1].pExpression))); }
+#line 4429 "generated/ds_parser.cpp"
     break;
 
-  case 203:
-#line 953 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprField(tokAt((yylsp[-1])), ExpressionPtr((yyvsp[-2].pExpression)), *(yyvsp[0].s)); delete (yyvsp[0].s); }
-#line 4549 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 203: /* expr: expr '.' NAME  */
+#line 953 "src/parser/ds_parser.ypp"
+                                                 { (yyval.pExpression) = new ExprField(tokAt((yylsp[-1])), ExpressionPtr((yyvsp[-2].pExpression)), *(yyvsp[0].s)); delete (yyvsp[0].s); }
+#line 4435 "generated/ds_parser.cpp"
     break;
 
-  case 204:
-#line 954 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprSafeField(tokAt((yylsp[-1])), ExpressionPtr((yyvsp[-2].pExpression)), *(yyvsp[0].s)); delete (yyvsp[0].s); }
-#line 4555 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 204: /* expr: expr QDOT NAME  */
+#line 954 "src/parser/ds_parser.ypp"
+                                                 { (yyval.pExpression) = new ExprSafeField(tokAt((yylsp[-1])), ExpressionPtr((yyvsp[-2].pExpression)), *(yyvsp[0].s)); delete (yyvsp[0].s); }
+#line 4441 "generated/ds_parser.cpp"
     break;
 
-  case 205:
-#line 955 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprAddr(tokAt((yylsp[-1])),*(yyvsp[0].s)); delete (yyvsp[0].s); }
-#line 4561 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 205: /* expr: '@' name_in_namespace  */
+#line 955 "src/parser/ds_parser.ypp"
+                                                 { (yyval.pExpression) = new ExprAddr(tokAt((yylsp[-1])),*(yyvsp[0].s)); delete (yyvsp[0].s); }
+#line 4447 "generated/ds_parser.cpp"
     break;
 
-  case 206:
-#line 956 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 206: /* expr: name_in_namespace '(' ')'  */
+#line 956 "src/parser/ds_parser.ypp"
+                                        {
             (yyval.pExpression) = g_Program->makeCall(tokAt((yylsp[-2])),*(yyvsp[-2].s));
             delete (yyvsp[-2].s);
         }
-#line 4570 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 4456 "generated/ds_parser.cpp"
     break;
 
-  case 207:
-#line 960 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 207: /* expr: name_in_namespace '(' expr_list ')'  */
+#line 960 "src/parser/ds_parser.ypp"
+                                                             {
             (yyval.pExpression) = parseFunctionArguments(g_Program->makeCall(tokAt((yylsp[-3])),*(yyvsp[-3].s)),(yyvsp[-1].pExpression));
             delete (yyvsp[-3].s);
         }
-#line 4579 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 4465 "generated/ds_parser.cpp"
     break;
 
-  case 208:
-#line 964 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 208: /* expr: basic_type_declaration '(' ')'  */
+#line 964 "src/parser/ds_parser.ypp"
+                                             {
         (yyval.pExpression) = g_Program->makeCall(tokAt((yylsp[-2])),das_to_string((yyvsp[-2].type)));
     }
-#line 4587 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 4473 "generated/ds_parser.cpp"
     break;
 
-  case 209:
-#line 967 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 209: /* expr: basic_type_declaration '(' expr_list ')'  */
+#line 967 "src/parser/ds_parser.ypp"
+                                                                  {
             (yyval.pExpression) = parseFunctionArguments(g_Program->makeCall(tokAt((yylsp[-3])),das_to_string((yyvsp[-3].type))),(yyvsp[-1].pExpression));
         }
-#line 4595 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 4481 "generated/ds_parser.cpp"
     break;
 
-  case 210:
-#line 970 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprPtr2Ref(tokAt((yylsp[-3])),ExpressionPtr((yyvsp[-1].pExpression))); }
-#line 4601 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 210: /* expr: DAS_DEREF '(' expr ')'  */
+#line 970 "src/parser/ds_parser.ypp"
+                                                   { (yyval.pExpression) = new ExprPtr2Ref(tokAt((yylsp[-3])),ExpressionPtr((yyvsp[-1].pExpression))); }
+#line 4487 "generated/ds_parser.cpp"
     break;
 
-  case 211:
-#line 971 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprRef2Ptr(tokAt((yylsp[-3])),ExpressionPtr((yyvsp[-1].pExpression))); }
-#line 4607 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 211: /* expr: DAS_ADDR '(' expr ')'  */
+#line 971 "src/parser/ds_parser.ypp"
+                                                      { (yyval.pExpression) = new ExprRef2Ptr(tokAt((yylsp[-3])),ExpressionPtr((yyvsp[-1].pExpression))); }
+#line 4493 "generated/ds_parser.cpp"
     break;
 
-  case 212:
-#line 972 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprMakeLambda(tokAt((yylsp[-2]))); }
-#line 4613 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 212: /* expr: DAS_TLAMBDA '(' ')'  */
+#line 972 "src/parser/ds_parser.ypp"
+                                                   { (yyval.pExpression) = new ExprMakeLambda(tokAt((yylsp[-2]))); }
+#line 4499 "generated/ds_parser.cpp"
     break;
 
-  case 213:
-#line 973 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprMakeLambda(tokAt((yylsp[-3])), ExpressionPtr((yyvsp[-1].pExpression))); }
-#line 4619 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 213: /* expr: DAS_TLAMBDA '(' expr ')'  */
+#line 973 "src/parser/ds_parser.ypp"
+                                                   { (yyval.pExpression) = new ExprMakeLambda(tokAt((yylsp[-3])), ExpressionPtr((yyvsp[-1].pExpression))); }
+#line 4505 "generated/ds_parser.cpp"
     break;
 
-  case 214:
-#line 974 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = new ExprNullCoalescing(tokAt((yylsp[-1])),ExpressionPtr((yyvsp[-2].pExpression)),ExpressionPtr((yyvsp[0].pExpression))); }
-#line 4625 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 214: /* expr: expr QQ expr  */
+#line 974 "src/parser/ds_parser.ypp"
+                                                   { (yyval.pExpression) = new ExprNullCoalescing(tokAt((yylsp[-1])),ExpressionPtr((yyvsp[-2].pExpression)),ExpressionPtr((yyvsp[0].pExpression))); }
+#line 4511 "generated/ds_parser.cpp"
     break;
 
-  case 215:
-#line 975 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 215: /* expr: expr '?' expr ':' expr  */
+#line 975 "src/parser/ds_parser.ypp"
+                                                          {
             (yyval.pExpression) = new ExprOp3(tokAt((yylsp[-3])),"?",ExpressionPtr((yyvsp[-4].pExpression)),ExpressionPtr((yyvsp[-2].pExpression)),ExpressionPtr((yyvsp[0].pExpression)));
         }
-#line 4633 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 4519 "generated/ds_parser.cpp"
     break;
 
-  case 216:
-#line 978 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = (yyvsp[0].pExpression); }
-#line 4639 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 216: /* expr: expr_type_info  */
+#line 978 "src/parser/ds_parser.ypp"
+                                                { (yyval.pExpression) = (yyvsp[0].pExpression); }
+#line 4525 "generated/ds_parser.cpp"
     break;
 
-  case 217:
-#line 979 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = (yyvsp[0].pExpression); }
-#line 4645 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 217: /* expr: expr_cast  */
+#line 979 "src/parser/ds_parser.ypp"
+                                                { (yyval.pExpression) = (yyvsp[0].pExpression); }
+#line 4531 "generated/ds_parser.cpp"
     break;
 
-  case 218:
-#line 980 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = (yyvsp[0].pExpression); }
-#line 4651 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 218: /* expr: expr_new  */
+#line 980 "src/parser/ds_parser.ypp"
+                                                { (yyval.pExpression) = (yyvsp[0].pExpression); }
+#line 4537 "generated/ds_parser.cpp"
     break;
 
-  case 219:
-#line 981 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = (yyvsp[0].pExpression); }
-#line 4657 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 219: /* expr: expr_method_call  */
+#line 981 "src/parser/ds_parser.ypp"
+                                                { (yyval.pExpression) = (yyvsp[0].pExpression); }
+#line 4543 "generated/ds_parser.cpp"
     break;
 
-  case 220:
-#line 982 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = (yyvsp[0].pExpression); }
-#line 4663 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 220: /* expr: expr_named_call  */
+#line 982 "src/parser/ds_parser.ypp"
+                                                { (yyval.pExpression) = (yyvsp[0].pExpression); }
+#line 4549 "generated/ds_parser.cpp"
     break;
 
-  case 221:
-#line 983 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = (yyvsp[0].pExpression); }
-#line 4669 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 221: /* expr: expr_block  */
+#line 983 "src/parser/ds_parser.ypp"
+                                                { (yyval.pExpression) = (yyvsp[0].pExpression); }
+#line 4555 "generated/ds_parser.cpp"
     break;
 
-  case 222:
-#line 984 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 222: /* expr: expr LPIPE expr  */
+#line 984 "src/parser/ds_parser.ypp"
+                                          {
         if ( (yyvsp[-2].pExpression)->rtti_isCallLikeExpr() ) {
             auto pCall = (ExprLooksLikeCall *) (yyvsp[-2].pExpression);
             pCall->arguments.push_back(ExpressionPtr((yyvsp[0].pExpression)));
@@ -4680,12 +4566,12 @@ yyreduce:
             (yyval.pExpression) = (yyvsp[-2].pExpression);
         }
     }
-#line 4684 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 4570 "generated/ds_parser.cpp"
     break;
 
-  case 223:
-#line 994 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 223: /* expr: expr RPIPE expr  */
+#line 994 "src/parser/ds_parser.ypp"
+                                          {
         if ( (yyvsp[0].pExpression)->rtti_isCallLikeExpr() ) {
             auto pCall = (ExprLooksLikeCall *) (yyvsp[0].pExpression);
             pCall->arguments.insert(pCall->arguments.begin(),ExpressionPtr((yyvsp[-2].pExpression)));
@@ -4695,12 +4581,12 @@ yyreduce:
             (yyval.pExpression) = (yyvsp[0].pExpression);
         }
     }
-#line 4699 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 4585 "generated/ds_parser.cpp"
     break;
 
-  case 224:
-#line 1004 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 224: /* expr: name_in_namespace NAME  */
+#line 1004 "src/parser/ds_parser.ypp"
+                                       {
 		ExprConstEnumeration * resEnum = nullptr;
         auto enums = g_Program->findEnum(*(yyvsp[-1].s));
         if ( enums.size()!=1 ) {
@@ -4731,211 +4617,211 @@ yyreduce:
         delete (yyvsp[-1].s);
         delete (yyvsp[0].s);
     }
-#line 4735 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 4621 "generated/ds_parser.cpp"
     break;
 
-  case 225:
-#line 1038 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.aaList) = nullptr; }
-#line 4741 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 225: /* optional_field_annotation: %empty  */
+#line 1038 "src/parser/ds_parser.ypp"
+                                                { (yyval.aaList) = nullptr; }
+#line 4627 "generated/ds_parser.cpp"
     break;
 
-  case 226:
-#line 1039 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.aaList) = (yyvsp[-1].aaList); }
-#line 4747 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 226: /* optional_field_annotation: '[' annotation_argument_list ']'  */
+#line 1039 "src/parser/ds_parser.ypp"
+                                                { (yyval.aaList) = (yyvsp[-1].aaList); }
+#line 4633 "generated/ds_parser.cpp"
     break;
 
-  case 227:
-#line 1043 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.b) = false; }
-#line 4753 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 227: /* optional_override: %empty  */
+#line 1043 "src/parser/ds_parser.ypp"
+                    { (yyval.b) = false; }
+#line 4639 "generated/ds_parser.cpp"
     break;
 
-  case 228:
-#line 1044 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.b) = true; }
-#line 4759 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 228: /* optional_override: DAS_OVERRIDE  */
+#line 1044 "src/parser/ds_parser.ypp"
+                       { (yyval.b) = true; }
+#line 4645 "generated/ds_parser.cpp"
     break;
 
-  case 229:
-#line 1048 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 229: /* structure_variable_declaration: optional_field_annotation optional_override variable_declaration  */
+#line 1048 "src/parser/ds_parser.ypp"
+                                                                                           {
         (yyvsp[0].pVarDecl)->override = (yyvsp[-1].b);
         (yyvsp[0].pVarDecl)->annotation = (yyvsp[-2].aaList);
         (yyval.pVarDecl) = (yyvsp[0].pVarDecl);
     }
-#line 4769 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 4655 "generated/ds_parser.cpp"
     break;
 
-  case 230:
-#line 1056 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 230: /* struct_variable_declaration_list: %empty  */
+#line 1056 "src/parser/ds_parser.ypp"
+        {
         (yyval.pVarDeclList) = new vector<VariableDeclaration*>();
     }
-#line 4777 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 4663 "generated/ds_parser.cpp"
     break;
 
-  case 231:
-#line 1059 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 231: /* struct_variable_declaration_list: struct_variable_declaration_list structure_variable_declaration ';'  */
+#line 1059 "src/parser/ds_parser.ypp"
+                                                                                        {
         (yyval.pVarDeclList) = (yyvsp[-2].pVarDeclList);
         (yyvsp[-2].pVarDeclList)->push_back((yyvsp[-1].pVarDecl));
     }
-#line 4786 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 4672 "generated/ds_parser.cpp"
     break;
 
-  case 232:
-#line 1066 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pVarDecl) = (yyvsp[0].pVarDecl); (yyvsp[0].pVarDecl)->pTypeDecl->constant = true; }
-#line 4792 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 232: /* function_argument_declaration: variable_declaration  */
+#line 1066 "src/parser/ds_parser.ypp"
+                                            { (yyval.pVarDecl) = (yyvsp[0].pVarDecl); (yyvsp[0].pVarDecl)->pTypeDecl->constant = true; }
+#line 4678 "generated/ds_parser.cpp"
     break;
 
-  case 233:
-#line 1067 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pVarDecl) = (yyvsp[0].pVarDecl); (yyvsp[0].pVarDecl)->pTypeDecl->removeConstant = true; }
-#line 4798 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 233: /* function_argument_declaration: DAS_VAR variable_declaration  */
+#line 1067 "src/parser/ds_parser.ypp"
+                                            { (yyval.pVarDecl) = (yyvsp[0].pVarDecl); (yyvsp[0].pVarDecl)->pTypeDecl->removeConstant = true; }
+#line 4684 "generated/ds_parser.cpp"
     break;
 
-  case 234:
-#line 1071 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pVarDeclList) = new vector<VariableDeclaration*>(); (yyval.pVarDeclList)->push_back((yyvsp[0].pVarDecl)); }
-#line 4804 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 234: /* function_argument_list: function_argument_declaration  */
+#line 1071 "src/parser/ds_parser.ypp"
+                                                                                 { (yyval.pVarDeclList) = new vector<VariableDeclaration*>(); (yyval.pVarDeclList)->push_back((yyvsp[0].pVarDecl)); }
+#line 4690 "generated/ds_parser.cpp"
     break;
 
-  case 235:
-#line 1072 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pVarDeclList) = (yyvsp[-2].pVarDeclList); (yyvsp[-2].pVarDeclList)->push_back((yyvsp[0].pVarDecl)); }
-#line 4810 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 235: /* function_argument_list: function_argument_list ';' function_argument_declaration  */
+#line 1072 "src/parser/ds_parser.ypp"
+                                                                                 { (yyval.pVarDeclList) = (yyvsp[-2].pVarDeclList); (yyvsp[-2].pVarDeclList)->push_back((yyvsp[0].pVarDecl)); }
+#line 4696 "generated/ds_parser.cpp"
     break;
 
-  case 236:
-#line 1076 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 236: /* tuple_type: type_declaration  */
+#line 1076 "src/parser/ds_parser.ypp"
+                                    {
         (yyval.pVarDecl) = new VariableDeclaration(tokAt((yylsp[0])),nullptr,(yyvsp[0].pTypeDecl),nullptr);
     }
-#line 4818 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 4704 "generated/ds_parser.cpp"
     break;
 
-  case 237:
-#line 1082 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pVarDeclList) = new vector<VariableDeclaration*>(); (yyval.pVarDeclList)->push_back((yyvsp[0].pVarDecl)); }
-#line 4824 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 237: /* tuple_type_list: tuple_type  */
+#line 1082 "src/parser/ds_parser.ypp"
+                                                       { (yyval.pVarDeclList) = new vector<VariableDeclaration*>(); (yyval.pVarDeclList)->push_back((yyvsp[0].pVarDecl)); }
+#line 4710 "generated/ds_parser.cpp"
     break;
 
-  case 238:
-#line 1083 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pVarDeclList) = (yyvsp[-2].pVarDeclList); (yyvsp[-2].pVarDeclList)->push_back((yyvsp[0].pVarDecl)); }
-#line 4830 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 238: /* tuple_type_list: tuple_type_list ';' tuple_type  */
+#line 1083 "src/parser/ds_parser.ypp"
+                                                       { (yyval.pVarDeclList) = (yyvsp[-2].pVarDeclList); (yyvsp[-2].pVarDeclList)->push_back((yyvsp[0].pVarDecl)); }
+#line 4716 "generated/ds_parser.cpp"
     break;
 
-  case 239:
-#line 1087 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.b) = false; }
-#line 4836 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 239: /* copy_or_move: '='  */
+#line 1087 "src/parser/ds_parser.ypp"
+                    { (yyval.b) = false; }
+#line 4722 "generated/ds_parser.cpp"
     break;
 
-  case 240:
-#line 1088 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.b) = true; }
-#line 4842 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 240: /* copy_or_move: LARROW  */
+#line 1088 "src/parser/ds_parser.ypp"
+                    { (yyval.b) = true; }
+#line 4728 "generated/ds_parser.cpp"
     break;
 
-  case 241:
-#line 1092 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 241: /* variable_declaration: variable_name_list  */
+#line 1092 "src/parser/ds_parser.ypp"
+                                 {
         auto autoT = new TypeDecl(Type::autoinfer);
         (yyval.pVarDecl) = new VariableDeclaration(tokAt((yylsp[0])),(yyvsp[0].pNameList),autoT,nullptr);
     }
-#line 4851 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 4737 "generated/ds_parser.cpp"
     break;
 
-  case 242:
-#line 1096 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 242: /* variable_declaration: variable_name_list ':' type_declaration  */
+#line 1096 "src/parser/ds_parser.ypp"
+                                                                 {
         (yyval.pVarDecl) = new VariableDeclaration(tokAt((yylsp[-2])),(yyvsp[-2].pNameList),(yyvsp[0].pTypeDecl),nullptr);
     }
-#line 4859 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 4745 "generated/ds_parser.cpp"
     break;
 
-  case 243:
-#line 1099 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 243: /* variable_declaration: variable_name_list ':' type_declaration copy_or_move expr  */
+#line 1099 "src/parser/ds_parser.ypp"
+                                                                                             {
         (yyval.pVarDecl) = new VariableDeclaration(tokAt((yylsp[-4])),(yyvsp[-4].pNameList),(yyvsp[-2].pTypeDecl),(yyvsp[0].pExpression));
         (yyval.pVarDecl)->move_to_init = (yyvsp[-1].b);
     }
-#line 4868 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 4754 "generated/ds_parser.cpp"
     break;
 
-  case 244:
-#line 1103 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 244: /* variable_declaration: variable_name_list copy_or_move expr  */
+#line 1103 "src/parser/ds_parser.ypp"
+                                                              {
         auto typeDecl = new TypeDecl(Type::autoinfer);
         (yyval.pVarDecl) = new VariableDeclaration(tokAt((yylsp[-2])),(yyvsp[-2].pNameList),typeDecl,(yyvsp[0].pExpression));
         (yyval.pVarDecl)->move_to_init = (yyvsp[-1].b);
     }
-#line 4878 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 4764 "generated/ds_parser.cpp"
     break;
 
-  case 245:
-#line 1108 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 245: /* variable_declaration: variable_name_list copy_or_move expr_pipe  */
+#line 1108 "src/parser/ds_parser.ypp"
+                                                                   {
         auto typeDecl = new TypeDecl(Type::autoinfer);
         (yyval.pVarDecl) = new VariableDeclaration(tokAt((yylsp[-2])),(yyvsp[-2].pNameList),typeDecl,(yyvsp[0].pExpression));
         (yyval.pVarDecl)->move_to_init = (yyvsp[-1].b);
     }
-#line 4888 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 4774 "generated/ds_parser.cpp"
     break;
 
-  case 246:
-#line 1116 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 246: /* let_variable_declaration: variable_name_list ':' type_declaration ';'  */
+#line 1116 "src/parser/ds_parser.ypp"
+                                                                    {
         (yyval.pVarDecl) = new VariableDeclaration(tokAt((yylsp[-3])),(yyvsp[-3].pNameList),(yyvsp[-1].pTypeDecl),nullptr);
     }
-#line 4896 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 4782 "generated/ds_parser.cpp"
     break;
 
-  case 247:
-#line 1119 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 247: /* let_variable_declaration: variable_name_list ':' type_declaration copy_or_move expr ';'  */
+#line 1119 "src/parser/ds_parser.ypp"
+                                                                                                 {
         (yyval.pVarDecl) = new VariableDeclaration(tokAt((yylsp[-5])),(yyvsp[-5].pNameList),(yyvsp[-3].pTypeDecl),(yyvsp[-1].pExpression));
         (yyval.pVarDecl)->move_to_init = (yyvsp[-2].b);
     }
-#line 4905 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 4791 "generated/ds_parser.cpp"
     break;
 
-  case 248:
-#line 1123 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 248: /* let_variable_declaration: variable_name_list ':' type_declaration copy_or_move expr_pipe  */
+#line 1123 "src/parser/ds_parser.ypp"
+                                                                                                  {
         (yyval.pVarDecl) = new VariableDeclaration(tokAt((yylsp[-4])),(yyvsp[-4].pNameList),(yyvsp[-2].pTypeDecl),(yyvsp[0].pExpression));
         (yyval.pVarDecl)->move_to_init = (yyvsp[-1].b);
     }
-#line 4914 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 4800 "generated/ds_parser.cpp"
     break;
 
-  case 249:
-#line 1127 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 249: /* let_variable_declaration: variable_name_list copy_or_move expr ';'  */
+#line 1127 "src/parser/ds_parser.ypp"
+                                                                  {
         auto typeDecl = new TypeDecl(Type::autoinfer);
         (yyval.pVarDecl) = new VariableDeclaration(tokAt((yylsp[-3])),(yyvsp[-3].pNameList),typeDecl,(yyvsp[-1].pExpression));
         (yyval.pVarDecl)->move_to_init = (yyvsp[-2].b);
     }
-#line 4924 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 4810 "generated/ds_parser.cpp"
     break;
 
-  case 250:
-#line 1132 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 250: /* let_variable_declaration: variable_name_list copy_or_move expr_pipe  */
+#line 1132 "src/parser/ds_parser.ypp"
+                                                                   {
         auto typeDecl = new TypeDecl(Type::autoinfer);
         (yyval.pVarDecl) = new VariableDeclaration(tokAt((yylsp[-2])),(yyvsp[-2].pNameList),typeDecl,(yyvsp[0].pExpression));
         (yyval.pVarDecl)->move_to_init = (yyvsp[-1].b);
     }
-#line 4934 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 4820 "generated/ds_parser.cpp"
     break;
 
-  case 251:
-#line 1140 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 251: /* global_let: kwd_let '{' struct_variable_declaration_list '}'  */
+#line 1140 "src/parser/ds_parser.ypp"
+                                                               {
         for ( auto pDecl : *(yyvsp[-1].pVarDeclList) ) {
             if ( pDecl->pTypeDecl ) {
                 for ( const auto & name : *pDecl->pNameList ) {
@@ -4960,20 +4846,20 @@ yyreduce:
         }
         deleteVariableDeclarationList((yyvsp[-1].pVarDeclList));
     }
-#line 4964 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 4850 "generated/ds_parser.cpp"
     break;
 
-  case 252:
-#line 1168 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 252: /* enum_list: %empty  */
+#line 1168 "src/parser/ds_parser.ypp"
+        {
         (yyval.pEnum) = new Enumeration();
     }
-#line 4972 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 4858 "generated/ds_parser.cpp"
     break;
 
-  case 253:
-#line 1171 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 253: /* enum_list: enum_list NAME ';'  */
+#line 1171 "src/parser/ds_parser.ypp"
+                                     {
 		das_checkName(*(yyvsp[-1].s),tokAt((yylsp[-1])));
         if ( !(yyvsp[-2].pEnum)->add(*(yyvsp[-1].s)) ) {
             das_yyerror("enumeration alread declared " + *(yyvsp[-1].s), tokAt((yylsp[-1])),
@@ -4982,12 +4868,12 @@ yyreduce:
         delete (yyvsp[-1].s);
         (yyval.pEnum) = (yyvsp[-2].pEnum);
     }
-#line 4986 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 4872 "generated/ds_parser.cpp"
     break;
 
-  case 254:
-#line 1180 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 254: /* enum_list: enum_list NAME '=' INTEGER ';'  */
+#line 1180 "src/parser/ds_parser.ypp"
+                                                        {
 		das_checkName(*(yyvsp[-3].s),tokAt((yylsp[-3])));
         if ( !(yyvsp[-4].pEnum)->add(*(yyvsp[-3].s),(yyvsp[-1].i)) ) {
             das_yyerror("enumeration value alread declared " + *(yyvsp[-3].s), tokAt((yylsp[-3])),
@@ -4996,12 +4882,12 @@ yyreduce:
         delete (yyvsp[-3].s);
         (yyval.pEnum) = (yyvsp[-4].pEnum);
     }
-#line 5000 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 4886 "generated/ds_parser.cpp"
     break;
 
-  case 255:
-#line 1192 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 255: /* alias_declaration: DAS_TYPEDEF NAME '=' type_declaration  */
+#line 1192 "src/parser/ds_parser.ypp"
+                                                                {
 		das_checkName(*(yyvsp[-2].s),tokAt((yylsp[-2])));
         (yyvsp[0].pTypeDecl)->alias = *(yyvsp[-2].s);
         if ( !g_Program->addAlias(TypeDeclPtr((yyvsp[0].pTypeDecl))) ) {
@@ -5010,12 +4896,12 @@ yyreduce:
         }
         delete (yyvsp[-2].s);
     }
-#line 5014 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 4900 "generated/ds_parser.cpp"
     break;
 
-  case 256:
-#line 1204 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 256: /* enum_declaration: DAS_ENUM NAME '{' enum_list '}'  */
+#line 1204 "src/parser/ds_parser.ypp"
+                                                       {
 		das_checkName(*(yyvsp[-3].s),tokAt((yylsp[-3])));
         auto pEnum = EnumerationPtr((yyvsp[-1].pEnum));
         pEnum->at = tokAt((yylsp[-4]));
@@ -5026,24 +4912,24 @@ yyreduce:
         }
 		delete (yyvsp[-3].s);
     }
-#line 5030 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 4916 "generated/ds_parser.cpp"
     break;
 
-  case 257:
-#line 1218 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.s) = nullptr; }
-#line 5036 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 257: /* optional_structure_parent: %empty  */
+#line 1218 "src/parser/ds_parser.ypp"
+                                        { (yyval.s) = nullptr; }
+#line 4922 "generated/ds_parser.cpp"
     break;
 
-  case 258:
-#line 1219 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.s) = (yyvsp[0].s); }
-#line 5042 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 258: /* optional_structure_parent: ':' name_in_namespace  */
+#line 1219 "src/parser/ds_parser.ypp"
+                                        { (yyval.s) = (yyvsp[0].s); }
+#line 4928 "generated/ds_parser.cpp"
     break;
 
-  case 259:
-#line 1223 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 259: /* structure_name: NAME optional_structure_parent  */
+#line 1223 "src/parser/ds_parser.ypp"
+                                                   {
 		das_checkName(*(yyvsp[-1].s),tokAt((yylsp[-1])));
         StructurePtr pStruct;
         if ( (yyvsp[0].s) ) {
@@ -5079,12 +4965,12 @@ yyreduce:
         }
         delete (yyvsp[-1].s);
     }
-#line 5083 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 4969 "generated/ds_parser.cpp"
     break;
 
-  case 260:
-#line 1262 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 260: /* structure_declaration: optional_annotation_list DAS_STRUCT structure_name '{' struct_variable_declaration_list '}'  */
+#line 1262 "src/parser/ds_parser.ypp"
+                                                                                                                       {
         if ( (yyvsp[-3].pStructure) ) {
             auto pStruct = (yyvsp[-3].pStructure)->shared_from_this();
             pStruct->at = tokAt((yylsp[-4]));
@@ -5147,230 +5033,230 @@ yyreduce:
         }
         deleteVariableDeclarationList((yyvsp[-1].pVarDeclList));
     }
-#line 5151 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 5037 "generated/ds_parser.cpp"
     break;
 
-  case 261:
-#line 1328 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 261: /* variable_name_list: NAME  */
+#line 1328 "src/parser/ds_parser.ypp"
+                    {
 		das_checkName(*(yyvsp[0].s),tokAt((yylsp[0])));
         auto pSL = new vector<string>();
         pSL->push_back(*(yyvsp[0].s));
         (yyval.pNameList) = pSL;
         delete (yyvsp[0].s);
     }
-#line 5163 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 5049 "generated/ds_parser.cpp"
     break;
 
-  case 262:
-#line 1335 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 262: /* variable_name_list: variable_name_list ',' NAME  */
+#line 1335 "src/parser/ds_parser.ypp"
+                                                {
 		das_checkName(*(yyvsp[0].s),tokAt((yylsp[0])));
         (yyvsp[-2].pNameList)->push_back(*(yyvsp[0].s));
         (yyval.pNameList) = (yyvsp[-2].pNameList);
         delete (yyvsp[0].s);
     }
-#line 5174 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 5060 "generated/ds_parser.cpp"
     break;
 
-  case 263:
-#line 1344 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.type) = Type::tBool; }
-#line 5180 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 263: /* basic_type_declaration: DAS_TBOOL  */
+#line 1344 "src/parser/ds_parser.ypp"
+                        { (yyval.type) = Type::tBool; }
+#line 5066 "generated/ds_parser.cpp"
     break;
 
-  case 264:
-#line 1345 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.type) = Type::tString; }
-#line 5186 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 264: /* basic_type_declaration: DAS_TSTRING  */
+#line 1345 "src/parser/ds_parser.ypp"
+                        { (yyval.type) = Type::tString; }
+#line 5072 "generated/ds_parser.cpp"
     break;
 
-  case 265:
-#line 1346 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.type) = Type::tInt; }
-#line 5192 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 265: /* basic_type_declaration: DAS_TINT  */
+#line 1346 "src/parser/ds_parser.ypp"
+                        { (yyval.type) = Type::tInt; }
+#line 5078 "generated/ds_parser.cpp"
     break;
 
-  case 266:
-#line 1347 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.type) = Type::tInt8; }
-#line 5198 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 266: /* basic_type_declaration: DAS_TINT8  */
+#line 1347 "src/parser/ds_parser.ypp"
+                        { (yyval.type) = Type::tInt8; }
+#line 5084 "generated/ds_parser.cpp"
     break;
 
-  case 267:
-#line 1348 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.type) = Type::tInt16; }
-#line 5204 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 267: /* basic_type_declaration: DAS_TINT16  */
+#line 1348 "src/parser/ds_parser.ypp"
+                        { (yyval.type) = Type::tInt16; }
+#line 5090 "generated/ds_parser.cpp"
     break;
 
-  case 268:
-#line 1349 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.type) = Type::tInt64; }
-#line 5210 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 268: /* basic_type_declaration: DAS_TINT64  */
+#line 1349 "src/parser/ds_parser.ypp"
+                        { (yyval.type) = Type::tInt64; }
+#line 5096 "generated/ds_parser.cpp"
     break;
 
-  case 269:
-#line 1350 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.type) = Type::tInt2; }
-#line 5216 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 269: /* basic_type_declaration: DAS_TINT2  */
+#line 1350 "src/parser/ds_parser.ypp"
+                        { (yyval.type) = Type::tInt2; }
+#line 5102 "generated/ds_parser.cpp"
     break;
 
-  case 270:
-#line 1351 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.type) = Type::tInt3; }
-#line 5222 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 270: /* basic_type_declaration: DAS_TINT3  */
+#line 1351 "src/parser/ds_parser.ypp"
+                        { (yyval.type) = Type::tInt3; }
+#line 5108 "generated/ds_parser.cpp"
     break;
 
-  case 271:
-#line 1352 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.type) = Type::tInt4; }
-#line 5228 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 271: /* basic_type_declaration: DAS_TINT4  */
+#line 1352 "src/parser/ds_parser.ypp"
+                        { (yyval.type) = Type::tInt4; }
+#line 5114 "generated/ds_parser.cpp"
     break;
 
-  case 272:
-#line 1353 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.type) = Type::tUInt; }
-#line 5234 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 272: /* basic_type_declaration: DAS_TUINT  */
+#line 1353 "src/parser/ds_parser.ypp"
+                        { (yyval.type) = Type::tUInt; }
+#line 5120 "generated/ds_parser.cpp"
     break;
 
-  case 273:
-#line 1354 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.type) = Type::tUInt8; }
-#line 5240 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 273: /* basic_type_declaration: DAS_TUINT8  */
+#line 1354 "src/parser/ds_parser.ypp"
+                        { (yyval.type) = Type::tUInt8; }
+#line 5126 "generated/ds_parser.cpp"
     break;
 
-  case 274:
-#line 1355 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.type) = Type::tUInt16; }
-#line 5246 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 274: /* basic_type_declaration: DAS_TUINT16  */
+#line 1355 "src/parser/ds_parser.ypp"
+                        { (yyval.type) = Type::tUInt16; }
+#line 5132 "generated/ds_parser.cpp"
     break;
 
-  case 275:
-#line 1356 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.type) = Type::tUInt64; }
-#line 5252 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 275: /* basic_type_declaration: DAS_TUINT64  */
+#line 1356 "src/parser/ds_parser.ypp"
+                        { (yyval.type) = Type::tUInt64; }
+#line 5138 "generated/ds_parser.cpp"
     break;
 
-  case 276:
-#line 1357 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.type) = Type::tUInt2; }
-#line 5258 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 276: /* basic_type_declaration: DAS_TUINT2  */
+#line 1357 "src/parser/ds_parser.ypp"
+                        { (yyval.type) = Type::tUInt2; }
+#line 5144 "generated/ds_parser.cpp"
     break;
 
-  case 277:
-#line 1358 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.type) = Type::tUInt3; }
-#line 5264 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 277: /* basic_type_declaration: DAS_TUINT3  */
+#line 1358 "src/parser/ds_parser.ypp"
+                        { (yyval.type) = Type::tUInt3; }
+#line 5150 "generated/ds_parser.cpp"
     break;
 
-  case 278:
-#line 1359 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.type) = Type::tUInt4; }
-#line 5270 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 278: /* basic_type_declaration: DAS_TUINT4  */
+#line 1359 "src/parser/ds_parser.ypp"
+                        { (yyval.type) = Type::tUInt4; }
+#line 5156 "generated/ds_parser.cpp"
     break;
 
-  case 279:
-#line 1360 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.type) = Type::tFloat; }
-#line 5276 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 279: /* basic_type_declaration: DAS_TFLOAT  */
+#line 1360 "src/parser/ds_parser.ypp"
+                        { (yyval.type) = Type::tFloat; }
+#line 5162 "generated/ds_parser.cpp"
     break;
 
-  case 280:
-#line 1361 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.type) = Type::tFloat2; }
-#line 5282 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 280: /* basic_type_declaration: DAS_TFLOAT2  */
+#line 1361 "src/parser/ds_parser.ypp"
+                        { (yyval.type) = Type::tFloat2; }
+#line 5168 "generated/ds_parser.cpp"
     break;
 
-  case 281:
-#line 1362 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.type) = Type::tFloat3; }
-#line 5288 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 281: /* basic_type_declaration: DAS_TFLOAT3  */
+#line 1362 "src/parser/ds_parser.ypp"
+                        { (yyval.type) = Type::tFloat3; }
+#line 5174 "generated/ds_parser.cpp"
     break;
 
-  case 282:
-#line 1363 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.type) = Type::tFloat4; }
-#line 5294 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 282: /* basic_type_declaration: DAS_TFLOAT4  */
+#line 1363 "src/parser/ds_parser.ypp"
+                        { (yyval.type) = Type::tFloat4; }
+#line 5180 "generated/ds_parser.cpp"
     break;
 
-  case 283:
-#line 1364 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.type) = Type::tVoid; }
-#line 5300 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 283: /* basic_type_declaration: DAS_TVOID  */
+#line 1364 "src/parser/ds_parser.ypp"
+                        { (yyval.type) = Type::tVoid; }
+#line 5186 "generated/ds_parser.cpp"
     break;
 
-  case 284:
-#line 1365 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.type) = Type::tRange; }
-#line 5306 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 284: /* basic_type_declaration: DAS_TRANGE  */
+#line 1365 "src/parser/ds_parser.ypp"
+                        { (yyval.type) = Type::tRange; }
+#line 5192 "generated/ds_parser.cpp"
     break;
 
-  case 285:
-#line 1366 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.type) = Type::tURange; }
-#line 5312 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 285: /* basic_type_declaration: DAS_TURANGE  */
+#line 1366 "src/parser/ds_parser.ypp"
+                        { (yyval.type) = Type::tURange; }
+#line 5198 "generated/ds_parser.cpp"
     break;
 
-  case 286:
-#line 1367 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.type) = Type::tDouble; }
-#line 5318 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 286: /* basic_type_declaration: DAS_TDOUBLE  */
+#line 1367 "src/parser/ds_parser.ypp"
+                        { (yyval.type) = Type::tDouble; }
+#line 5204 "generated/ds_parser.cpp"
     break;
 
-  case 287:
-#line 1371 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 287: /* structure_type_declaration: name_in_namespace  */
+#line 1371 "src/parser/ds_parser.ypp"
+                                 {
         (yyval.pTypeDecl) = g_Program->makeTypeDeclaration(tokAt((yylsp[0])),*(yyvsp[0].s));
         if ( !(yyval.pTypeDecl) ) {
             (yyval.pTypeDecl) = new TypeDecl(Type::tVoid);
         }
         delete (yyvsp[0].s);
     }
-#line 5330 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 5216 "generated/ds_parser.cpp"
     break;
 
-  case 288:
-#line 1381 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 288: /* auto_type_declaration: DAS_TAUTO  */
+#line 1381 "src/parser/ds_parser.ypp"
+                       {
         (yyval.pTypeDecl) = new TypeDecl(Type::autoinfer);
         (yyval.pTypeDecl)->at = tokAt((yylsp[0]));
     }
-#line 5339 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 5225 "generated/ds_parser.cpp"
     break;
 
-  case 289:
-#line 1385 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 289: /* auto_type_declaration: DAS_TAUTO '(' NAME ')'  */
+#line 1385 "src/parser/ds_parser.ypp"
+                                            {
 		das_checkName(*(yyvsp[-1].s),tokAt((yylsp[-1])));
         (yyval.pTypeDecl) = new TypeDecl(Type::autoinfer);
         (yyval.pTypeDecl)->at = tokAt((yylsp[-3]));
         (yyval.pTypeDecl)->alias = *(yyvsp[-1].s);
         delete (yyvsp[-1].s);
     }
-#line 5351 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 5237 "generated/ds_parser.cpp"
     break;
 
-  case 290:
-#line 1395 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pTypeDecl) = new TypeDecl((yyvsp[0].type)); (yyval.pTypeDecl)->at = tokAt((yylsp[0])); }
-#line 5357 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 290: /* type_declaration: basic_type_declaration  */
+#line 1395 "src/parser/ds_parser.ypp"
+                                                            { (yyval.pTypeDecl) = new TypeDecl((yyvsp[0].type)); (yyval.pTypeDecl)->at = tokAt((yylsp[0])); }
+#line 5243 "generated/ds_parser.cpp"
     break;
 
-  case 291:
-#line 1396 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pTypeDecl) = (yyvsp[0].pTypeDecl); }
-#line 5363 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 291: /* type_declaration: auto_type_declaration  */
+#line 1396 "src/parser/ds_parser.ypp"
+                                                            { (yyval.pTypeDecl) = (yyvsp[0].pTypeDecl); }
+#line 5249 "generated/ds_parser.cpp"
     break;
 
-  case 292:
-#line 1397 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pTypeDecl) = (yyvsp[0].pTypeDecl); }
-#line 5369 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 292: /* type_declaration: structure_type_declaration  */
+#line 1397 "src/parser/ds_parser.ypp"
+                                                            { (yyval.pTypeDecl) = (yyvsp[0].pTypeDecl); }
+#line 5255 "generated/ds_parser.cpp"
     break;
 
-  case 293:
-#line 1398 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 293: /* type_declaration: type_declaration '[' expr ']'  */
+#line 1398 "src/parser/ds_parser.ypp"
+                                                         {
         int32_t dI = TypeDecl::dimConst;
         if ( (yyvsp[-1].pExpression)->rtti_isConstant() ) {                // note: this shortcut is here so we don't get extra infer pass on every array
             auto cI = (ExprConst *) (yyvsp[-1].pExpression);
@@ -5383,133 +5269,148 @@ yyreduce:
         (yyvsp[-3].pTypeDecl)->dimExpr.push_back(ExpressionPtr((yyvsp[-1].pExpression)));
         (yyval.pTypeDecl) = (yyvsp[-3].pTypeDecl);
     }
-#line 5387 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 5273 "generated/ds_parser.cpp"
     break;
 
-  case 294:
-#line 1411 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 294: /* type_declaration: type_declaration '[' ']'  */
+#line 1411 "src/parser/ds_parser.ypp"
+                                           {
         (yyvsp[-2].pTypeDecl)->dim.push_back(TypeDecl::dimAuto);
         (yyvsp[-2].pTypeDecl)->dimExpr.push_back(nullptr);
         (yyval.pTypeDecl) = (yyvsp[-2].pTypeDecl);
     }
-#line 5397 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 5283 "generated/ds_parser.cpp"
     break;
 
-  case 295:
-#line 1416 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 295: /* type_declaration: type_declaration DAS_CONST  */
+#line 1416 "src/parser/ds_parser.ypp"
+                                             {
         (yyvsp[-1].pTypeDecl)->constant = true;
         (yyvsp[-1].pTypeDecl)->removeConstant = false;
         (yyval.pTypeDecl) = (yyvsp[-1].pTypeDecl);
     }
-#line 5407 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 5293 "generated/ds_parser.cpp"
     break;
 
-  case 296:
-#line 1421 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 296: /* type_declaration: type_declaration DAS_DELETE DAS_CONST  */
+#line 1421 "src/parser/ds_parser.ypp"
+                                                        {
         (yyvsp[-2].pTypeDecl)->constant = false;
         (yyvsp[-2].pTypeDecl)->removeConstant = true;
         (yyval.pTypeDecl) = (yyvsp[-2].pTypeDecl);
     }
-#line 5417 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 5303 "generated/ds_parser.cpp"
     break;
 
-  case 297:
-#line 1426 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 297: /* type_declaration: type_declaration '&'  */
+#line 1426 "src/parser/ds_parser.ypp"
+                                       {
         (yyvsp[-1].pTypeDecl)->ref = true;
         (yyvsp[-1].pTypeDecl)->removeRef = false;
         (yyval.pTypeDecl) = (yyvsp[-1].pTypeDecl);
     }
-#line 5427 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 5313 "generated/ds_parser.cpp"
     break;
 
-  case 298:
-#line 1431 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 298: /* type_declaration: type_declaration DAS_DELETE '&'  */
+#line 1431 "src/parser/ds_parser.ypp"
+                                                  {
         (yyvsp[-2].pTypeDecl)->ref = false;
         (yyvsp[-2].pTypeDecl)->removeRef = true;
         (yyval.pTypeDecl) = (yyvsp[-2].pTypeDecl);
     }
-#line 5437 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 5323 "generated/ds_parser.cpp"
     break;
 
-  case 299:
-#line 1436 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 299: /* type_declaration: type_declaration DAS_DELETE DAS_CONST '&'  */
+#line 1436 "src/parser/ds_parser.ypp"
+                                                            {
         (yyvsp[-3].pTypeDecl)->constant = false;
         (yyvsp[-3].pTypeDecl)->removeConstant = true;
         (yyvsp[-3].pTypeDecl)->ref = false;
         (yyvsp[-3].pTypeDecl)->removeRef = true;
         (yyval.pTypeDecl) = (yyvsp[-3].pTypeDecl);
     }
-#line 5449 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 5335 "generated/ds_parser.cpp"
     break;
 
-  case 300:
-#line 1443 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 300: /* type_declaration: type_declaration '?'  */
+#line 1443 "src/parser/ds_parser.ypp"
+                                       {
         (yyval.pTypeDecl) = new TypeDecl(Type::tPointer);
         (yyval.pTypeDecl)->firstType = TypeDeclPtr((yyvsp[-1].pTypeDecl));
     }
-#line 5458 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 5344 "generated/ds_parser.cpp"
     break;
 
-  case 301:
-#line 1447 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 301: /* type_declaration: DAS_ARRAY '<' type_declaration '>'  */
+#line 1447 "src/parser/ds_parser.ypp"
+                                                          {
         (yyval.pTypeDecl) = new TypeDecl(Type::tArray);
         (yyval.pTypeDecl)->at = tokAt((yylsp[-3]));
         (yyval.pTypeDecl)->firstType = TypeDeclPtr((yyvsp[-1].pTypeDecl));
     }
-#line 5468 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 5354 "generated/ds_parser.cpp"
     break;
 
-  case 302:
-#line 1452 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 302: /* type_declaration: NAME '<' type_declaration '>'  */
+#line 1452 "src/parser/ds_parser.ypp"
+                                                      {
+        if ( *(yyvsp[-3].s)!="slice" ) {
+            das_yyerror("unknown type " + *(yyvsp[-3].s) + "<...>, only slice<type> is supported",tokAt((yylsp[-3])),
+                CompilationError::type_not_found);
+        }
+        (yyval.pTypeDecl) = new TypeDecl(Type::tSlice);
+        (yyval.pTypeDecl)->at = tokAt((yylsp[-3]));
+        (yyval.pTypeDecl)->firstType = TypeDeclPtr((yyvsp[-1].pTypeDecl));
+        delete (yyvsp[-3].s);
+    }
+#line 5369 "generated/ds_parser.cpp"
+    break;
+
+  case 303: /* type_declaration: DAS_TABLE '<' type_declaration ',' type_declaration '>'  */
+#line 1462 "src/parser/ds_parser.ypp"
+                                                                                                 {
         (yyval.pTypeDecl) = new TypeDecl(Type::tTable);
         (yyval.pTypeDecl)->at = tokAt((yylsp[-5]));
         (yyval.pTypeDecl)->firstType = TypeDeclPtr((yyvsp[-3].pTypeDecl));
         (yyval.pTypeDecl)->secondType = TypeDeclPtr((yyvsp[-1].pTypeDecl));
     }
-#line 5479 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 5380 "generated/ds_parser.cpp"
     break;
 
-  case 303:
-#line 1458 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 304: /* type_declaration: DAS_ITERATOR '<' type_declaration '>'  */
+#line 1468 "src/parser/ds_parser.ypp"
+                                                               {
         (yyval.pTypeDecl) = new TypeDecl(Type::tIterator);
         (yyval.pTypeDecl)->at = tokAt((yylsp[-3]));
         (yyval.pTypeDecl)->firstType = TypeDeclPtr((yyvsp[-1].pTypeDecl));
     }
-#line 5489 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 5390 "generated/ds_parser.cpp"
     break;
 
-  case 304:
-#line 1463 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 305: /* type_declaration: DAS_TBLOCK  */
+#line 1473 "src/parser/ds_parser.ypp"
+                        {
         (yyval.pTypeDecl) = new TypeDecl(Type::tBlock);
         (yyval.pTypeDecl)->at = tokAt((yylsp[0]));
     }
-#line 5498 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 5399 "generated/ds_parser.cpp"
     break;
 
-  case 305:
-#line 1467 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 306: /* type_declaration: DAS_TBLOCK '<' type_declaration '>'  */
+#line 1477 "src/parser/ds_parser.ypp"
+                                                            {
         (yyval.pTypeDecl) = new TypeDecl(Type::tBlock);
         (yyval.pTypeDecl)->at = tokAt((yylsp[-3]));
         (yyval.pTypeDecl)->firstType = TypeDeclPtr((yyvsp[-1].pTypeDecl));
     }
-#line 5508 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 5409 "generated/ds_parser.cpp"
     break;
 
-  case 306:
-#line 1472 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 307: /* type_declaration: DAS_TBLOCK '<' optional_function_argument_list optional_function_type '>'  */
+#line 1482 "src/parser/ds_parser.ypp"
+                                                                                                     {
         (yyval.pTypeDecl) = new TypeDecl(Type::tBlock);
         (yyval.pTypeDecl)->at = tokAt((yylsp[-4]));
         (yyval.pTypeDecl)->firstType = TypeDeclPtr((yyvsp[-1].pTypeDecl));
@@ -5518,31 +5419,31 @@ yyreduce:
             deleteVariableDeclarationList((yyvsp[-2].pVarDeclList));
         }
     }
-#line 5522 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 5423 "generated/ds_parser.cpp"
     break;
 
-  case 307:
-#line 1481 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 308: /* type_declaration: DAS_TFUNCTION  */
+#line 1491 "src/parser/ds_parser.ypp"
+                           {
         (yyval.pTypeDecl) = new TypeDecl(Type::tFunction);
         (yyval.pTypeDecl)->at = tokAt((yylsp[0]));
     }
-#line 5531 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 5432 "generated/ds_parser.cpp"
     break;
 
-  case 308:
-#line 1485 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 309: /* type_declaration: DAS_TFUNCTION '<' type_declaration '>'  */
+#line 1495 "src/parser/ds_parser.ypp"
+                                                               {
         (yyval.pTypeDecl) = new TypeDecl(Type::tFunction);
         (yyval.pTypeDecl)->at = tokAt((yylsp[-3]));
         (yyval.pTypeDecl)->firstType = TypeDeclPtr((yyvsp[-1].pTypeDecl));
     }
-#line 5541 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 5442 "generated/ds_parser.cpp"
     break;
 
-  case 309:
-#line 1490 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 310: /* type_declaration: DAS_TFUNCTION '<' optional_function_argument_list optional_function_type '>'  */
+#line 1500 "src/parser/ds_parser.ypp"
+                                                                                                        {
         (yyval.pTypeDecl) = new TypeDecl(Type::tFunction);
         (yyval.pTypeDecl)->at = tokAt((yylsp[-4]));
         (yyval.pTypeDecl)->firstType = TypeDeclPtr((yyvsp[-1].pTypeDecl));
@@ -5551,31 +5452,31 @@ yyreduce:
             deleteVariableDeclarationList((yyvsp[-2].pVarDeclList));
         }
     }
-#line 5555 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 5456 "generated/ds_parser.cpp"
     break;
 
-  case 310:
-#line 1499 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 311: /* type_declaration: DAS_TLAMBDA  */
+#line 1509 "src/parser/ds_parser.ypp"
+                         {
         (yyval.pTypeDecl) = new TypeDecl(Type::tLambda);
         (yyval.pTypeDecl)->at = tokAt((yylsp[0]));
     }
-#line 5564 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 5465 "generated/ds_parser.cpp"
     break;
 
-  case 311:
-#line 1503 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 312: /* type_declaration: DAS_TLAMBDA '<' type_declaration '>'  */
+#line 1513 "src/parser/ds_parser.ypp"
+                                                             {
         (yyval.pTypeDecl) = new TypeDecl(Type::tLambda);
         (yyval.pTypeDecl)->at = tokAt((yylsp[-3]));
         (yyval.pTypeDecl)->firstType = TypeDeclPtr((yyvsp[-1].pTypeDecl));
     }
-#line 5574 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 5475 "generated/ds_parser.cpp"
     break;
 
-  case 312:
-#line 1508 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 313: /* type_declaration: DAS_TLAMBDA '<' optional_function_argument_list optional_function_type '>'  */
+#line 1518 "src/parser/ds_parser.ypp"
+                                                                                                      {
         (yyval.pTypeDecl) = new TypeDecl(Type::tLambda);
         (yyval.pTypeDecl)->at = tokAt((yylsp[-4]));
         (yyval.pTypeDecl)->firstType = TypeDeclPtr((yyvsp[-1].pTypeDecl));
@@ -5584,112 +5485,112 @@ yyreduce:
             deleteVariableDeclarationList((yyvsp[-2].pVarDeclList));
         }
     }
-#line 5588 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 5489 "generated/ds_parser.cpp"
     break;
 
-  case 313:
-#line 1517 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 314: /* type_declaration: DAS_TTUPLE '<' tuple_type_list '>'  */
+#line 1527 "src/parser/ds_parser.ypp"
+                                                      {
         (yyval.pTypeDecl) = new TypeDecl(Type::tTuple);
         (yyval.pTypeDecl)->at = tokAt((yylsp[-3]));
         varDeclToTypeDecl((yyval.pTypeDecl), (yyvsp[-1].pVarDeclList));
         deleteVariableDeclarationList((yyvsp[-1].pVarDeclList));
     }
-#line 5599 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 5500 "generated/ds_parser.cpp"
     break;
 
-  case 314:
-#line 1526 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = (yyvsp[0].pExpression); }
-#line 5605 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 315: /* make_decl: make_struct_decl  */
+#line 1536 "src/parser/ds_parser.ypp"
+                                 { (yyval.pExpression) = (yyvsp[0].pExpression); }
+#line 5506 "generated/ds_parser.cpp"
     break;
 
-  case 315:
-#line 1527 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = (yyvsp[0].pExpression); }
-#line 5611 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 316: /* make_decl: make_dim_decl  */
+#line 1537 "src/parser/ds_parser.ypp"
+                                 { (yyval.pExpression) = (yyvsp[0].pExpression); }
+#line 5512 "generated/ds_parser.cpp"
     break;
 
-  case 316:
-#line 1528 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = (yyvsp[0].pExpression); }
-#line 5617 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 317: /* make_decl: array_comprehension  */
+#line 1538 "src/parser/ds_parser.ypp"
+                                 { (yyval.pExpression) = (yyvsp[0].pExpression); }
+#line 5518 "generated/ds_parser.cpp"
     break;
 
-  case 317:
-#line 1532 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 318: /* make_struct_fields: NAME copy_or_move expr  */
+#line 1542 "src/parser/ds_parser.ypp"
+                                               {
         auto mfd = make_shared<MakeFieldDecl>(tokAt((yylsp[-2])),*(yyvsp[-2].s),ExpressionPtr((yyvsp[0].pExpression)),(yyvsp[-1].b));
         delete (yyvsp[-2].s);
         auto msd = new MakeStruct();
         msd->push_back(mfd);
         (yyval.pMakeStruct) = msd;
     }
-#line 5629 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 5530 "generated/ds_parser.cpp"
     break;
 
-  case 318:
-#line 1539 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 319: /* make_struct_fields: make_struct_fields ',' NAME copy_or_move expr  */
+#line 1549 "src/parser/ds_parser.ypp"
+                                                                           {
         auto mfd = make_shared<MakeFieldDecl>(tokAt((yylsp[-2])),*(yyvsp[-2].s),ExpressionPtr((yyvsp[0].pExpression)),(yyvsp[-1].b));
         delete (yyvsp[-2].s);
         ((MakeStruct *)(yyvsp[-4].pMakeStruct))->push_back(mfd);
         (yyval.pMakeStruct) = (yyvsp[-4].pMakeStruct);
     }
-#line 5640 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 5541 "generated/ds_parser.cpp"
     break;
 
-  case 319:
-#line 1548 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 320: /* make_struct_dim: make_struct_fields  */
+#line 1558 "src/parser/ds_parser.ypp"
+                                {
         auto msd = new ExprMakeStructure();
         msd->structs.push_back(MakeStructPtr((yyvsp[0].pMakeStruct)));
         (yyval.pExpression) = msd;
     }
-#line 5650 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 5551 "generated/ds_parser.cpp"
     break;
 
-  case 320:
-#line 1553 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 321: /* make_struct_dim: make_struct_dim ';' make_struct_fields  */
+#line 1563 "src/parser/ds_parser.ypp"
+                                                         {
         ((ExprMakeStructure *) (yyvsp[-2].pExpression))->structs.push_back(MakeStructPtr((yyvsp[0].pMakeStruct)));
         (yyval.pExpression) = (yyvsp[-2].pExpression);
     }
-#line 5659 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 5560 "generated/ds_parser.cpp"
     break;
 
-  case 321:
-#line 1560 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 322: /* make_struct_decl: '[' '[' type_declaration make_struct_dim ']' ']'  */
+#line 1570 "src/parser/ds_parser.ypp"
+                                                                        {
         ((ExprMakeStructure *)(yyvsp[-2].pExpression))->makeType = TypeDeclPtr((yyvsp[-3].pTypeDecl));
         (yyvsp[-2].pExpression)->at = tokAt((yylsp[-5]));
         (yyval.pExpression) = (yyvsp[-2].pExpression);
     }
-#line 5669 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 5570 "generated/ds_parser.cpp"
     break;
 
-  case 322:
-#line 1565 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 323: /* make_struct_decl: '[' '[' type_declaration '(' ')' make_struct_dim ']' ']'  */
+#line 1575 "src/parser/ds_parser.ypp"
+                                                                                {
         ((ExprMakeStructure *)(yyvsp[-2].pExpression))->makeType = TypeDeclPtr((yyvsp[-5].pTypeDecl));
         ((ExprMakeStructure *)(yyvsp[-2].pExpression))->useInitializer = true;
         (yyvsp[-2].pExpression)->at = tokAt((yylsp[-7]));
         (yyval.pExpression) = (yyvsp[-2].pExpression);
     }
-#line 5680 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 5581 "generated/ds_parser.cpp"
     break;
 
-  case 323:
-#line 1574 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 324: /* make_tuple: expr  */
+#line 1584 "src/parser/ds_parser.ypp"
+                  {
         (yyval.pExpression) = (yyvsp[0].pExpression);
     }
-#line 5688 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 5589 "generated/ds_parser.cpp"
     break;
 
-  case 324:
-#line 1577 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 325: /* make_tuple: make_tuple ',' expr  */
+#line 1587 "src/parser/ds_parser.ypp"
+                                      {
         ExprMakeTuple * mt;
         if ( (yyvsp[-2].pExpression)->rtti_isMakeTuple() ) {
             mt = static_cast<ExprMakeTuple *>((yyvsp[-2].pExpression));
@@ -5700,53 +5601,53 @@ yyreduce:
         mt->values.push_back(ExpressionPtr((yyvsp[0].pExpression)));
         (yyval.pExpression) = mt;
     }
-#line 5704 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 5605 "generated/ds_parser.cpp"
     break;
 
-  case 325:
-#line 1591 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 326: /* make_dim: make_tuple  */
+#line 1601 "src/parser/ds_parser.ypp"
+                        {
         auto mka = new ExprMakeArray();
         mka->values.push_back(ExpressionPtr((yyvsp[0].pExpression)));
         (yyval.pExpression) = mka;
     }
-#line 5714 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 5615 "generated/ds_parser.cpp"
     break;
 
-  case 326:
-#line 1596 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 327: /* make_dim: make_dim ';' make_tuple  */
+#line 1606 "src/parser/ds_parser.ypp"
+                                          {
         ((ExprMakeArray *) (yyvsp[-2].pExpression))->values.push_back(ExpressionPtr((yyvsp[0].pExpression)));
         (yyval.pExpression) = (yyvsp[-2].pExpression);
     }
-#line 5723 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 5624 "generated/ds_parser.cpp"
     break;
 
-  case 327:
-#line 1603 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 328: /* make_dim_decl: '[' '[' type_declaration make_dim ']' ']'  */
+#line 1613 "src/parser/ds_parser.ypp"
+                                                                 {
        ((ExprMakeArray *)(yyvsp[-2].pExpression))->makeType = TypeDeclPtr((yyvsp[-3].pTypeDecl));
        (yyvsp[-2].pExpression)->at = tokAt((yylsp[-5]));
        (yyval.pExpression) = (yyvsp[-2].pExpression);
     }
-#line 5733 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 5634 "generated/ds_parser.cpp"
     break;
 
-  case 328:
-#line 1611 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = nullptr; }
-#line 5739 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 329: /* array_comprehension_where: %empty  */
+#line 1621 "src/parser/ds_parser.ypp"
+                                    { (yyval.pExpression) = nullptr; }
+#line 5640 "generated/ds_parser.cpp"
     break;
 
-  case 329:
-#line 1612 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    { (yyval.pExpression) = (yyvsp[0].pExpression); }
-#line 5745 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+  case 330: /* array_comprehension_where: ';' DAS_WHERE expr  */
+#line 1622 "src/parser/ds_parser.ypp"
+                                    { (yyval.pExpression) = (yyvsp[0].pExpression); }
+#line 5646 "generated/ds_parser.cpp"
     break;
 
-  case 330:
-#line 1616 "src/parser/ds_parser.ypp" /* yacc.c:1645  */
-    {
+  case 331: /* array_comprehension: '[' '[' DAS_FOR variable_name_list DAS_IN expr_list ';' expr array_comprehension_where ']' ']'  */
+#line 1626 "src/parser/ds_parser.ypp"
+                                                                                                                                          {
         auto pFor = make_shared<ExprFor>(tokAt((yylsp[-8])));
         pFor->iterators = *(yyvsp[-7].pNameList);
         delete (yyvsp[-7].pNameList);
@@ -5759,11 +5660,12 @@ yyreduce:
         }
         (yyval.pExpression) = pAC;
     }
-#line 5763 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 5664 "generated/ds_parser.cpp"
     break;
 
 
-#line 5767 "C:/Users/Boris/Work/yzg/generated/ds_parser.cpp" /* yacc.c:1645  */
+#line 5668 "generated/ds_parser.cpp"
+
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
@@ -5777,11 +5679,10 @@ yyreduce:
      case of YYERROR or YYBACKUP, subsequent parser actions might lead
      to an incorrect destructor call or verbose syntax error message
      before the lookahead is translated.  */
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
   *++yylsp = yyloc;
@@ -5806,66 +5707,31 @@ yyreduce:
 yyerrlab:
   /* Make sure we have latest lookahead translation.  See comments at
      user semantic actions for why this is necessary.  */
-  yytoken = yychar == YYEMPTY ? YYEMPTY : YYTRANSLATE (yychar);
-
+  yytoken = yychar == DAS_YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
       yyerror (YY_("syntax error"));
-#else
-# define YYSYNTAX_ERROR yysyntax_error (&yymsg_alloc, &yymsg, \
-                                        yyssp, yytoken)
-      {
-        char const *yymsgp = YY_("syntax error");
-        int yysyntax_error_status;
-        yysyntax_error_status = YYSYNTAX_ERROR;
-        if (yysyntax_error_status == 0)
-          yymsgp = yymsg;
-        else if (yysyntax_error_status == 1)
-          {
-            if (yymsg != yymsgbuf)
-              YYSTACK_FREE (yymsg);
-            yymsg = (char *) YYSTACK_ALLOC (yymsg_alloc);
-            if (!yymsg)
-              {
-                yymsg = yymsgbuf;
-                yymsg_alloc = sizeof yymsgbuf;
-                yysyntax_error_status = 2;
-              }
-            else
-              {
-                yysyntax_error_status = YYSYNTAX_ERROR;
-                yymsgp = yymsg;
-              }
-          }
-        yyerror (yymsgp);
-        if (yysyntax_error_status == 2)
-          goto yyexhaustedlab;
-      }
-# undef YYSYNTAX_ERROR
-#endif
     }
 
   yyerror_range[1] = yylloc;
-
   if (yyerrstatus == 3)
     {
       /* If just tried and failed to reuse lookahead token after an
          error, discard it.  */
 
-      if (yychar <= YYEOF)
+      if (yychar <= DAS_YYEOF)
         {
           /* Return failure if at end of input.  */
-          if (yychar == YYEOF)
+          if (yychar == DAS_YYEOF)
             YYABORT;
         }
       else
         {
           yydestruct ("Error: discarding",
                       yytoken, &yylval, &yylloc);
-          yychar = YYEMPTY;
+          yychar = DAS_YYEMPTY;
         }
     }
 
@@ -5878,12 +5744,11 @@ yyerrlab:
 | yyerrorlab -- error raised explicitly by YYERROR.  |
 `---------------------------------------------------*/
 yyerrorlab:
-
-  /* Pacify compilers like GCC when the user code never invokes
-     YYERROR and the label yyerrorlab therefore never appears in user
-     code.  */
-  if (/*CONSTCOND*/ 0)
-     goto yyerrorlab;
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
 
   /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
@@ -5900,13 +5765,14 @@ yyerrorlab:
 yyerrlab1:
   yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
       if (!yypact_value_is_default (yyn))
         {
-          yyn += YYTERROR;
-          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
             {
               yyn = yytable[yyn];
               if (0 < yyn)
@@ -5920,7 +5786,7 @@ yyerrlab1:
 
       yyerror_range[1] = *yylsp;
       yydestruct ("Error: popping",
-                  yystos[yystate], yyvsp, yylsp);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, yylsp);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
@@ -5931,13 +5797,11 @@ yyerrlab1:
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 
   yyerror_range[2] = yylloc;
-  /* Using YYLLOC is tempting, but would change the location of
-     the lookahead.  YYLOC is available though.  */
-  YYLLOC_DEFAULT (yyloc, yyerror_range, 2);
-  *++yylsp = yyloc;
+  ++yylsp;
+  YYLLOC_DEFAULT (*yylsp, yyerror_range, 2);
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -5948,27 +5812,31 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
 /*-----------------------------------.
 | yyabortlab -- YYABORT comes here.  |
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
 
-#if !defined yyoverflow || YYERROR_VERBOSE
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
   yyerror (YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
 
-yyreturn:
-  if (yychar != YYEMPTY)
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != DAS_YYEMPTY)
     {
       /* Make sure we have latest lookahead translation.  See comments at
          user semantic actions for why this is necessary.  */
@@ -5983,20 +5851,18 @@ yyreturn:
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-                  yystos[*yyssp], yyvsp, yylsp);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, yylsp);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
   if (yyss != yyssa)
     YYSTACK_FREE (yyss);
 #endif
-#if YYERROR_VERBOSE
-  if (yymsg != yymsgbuf)
-    YYSTACK_FREE (yymsg);
-#endif
+
   return yyresult;
 }
-#line 1631 "src/parser/ds_parser.ypp" /* yacc.c:1903  */
+
+#line 1641 "src/parser/ds_parser.ypp"
 
 
 void das_checkName(const string & name, const LineInfo &at) {
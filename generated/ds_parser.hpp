@@ -1,8 +1,9 @@
-/* A Bison parser, made by GNU Bison 3.2.2.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison interface for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2015, 2018 Free Software Foundation, Inc.
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
@@ -15,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -30,11 +31,12 @@
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
-/* Undocumented macros, especially those whose name start with YY_,
-   are private implementation details.  Do not rely on them.  */
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
 
-#ifndef YY_DAS_YY_C_USERS_BORIS_WORK_YZG_GENERATED_DS_PARSER_HPP_INCLUDED
-# define YY_DAS_YY_C_USERS_BORIS_WORK_YZG_GENERATED_DS_PARSER_HPP_INCLUDED
+#ifndef YY_DAS_YY_GENERATED_DS_PARSER_HPP_INCLUDED
+# define YY_DAS_YY_GENERATED_DS_PARSER_HPP_INCLUDED
 /* Debug traces.  */
 #ifndef DAS_YYDEBUG
 # if defined YYDEBUG
@@ -51,7 +53,7 @@
 extern int das_yydebug;
 #endif
 /* "%code requires" blocks.  */
-#line 2 "src/parser/ds_parser.ypp" /* yacc.c:1906  */
+#line 2 "src/parser/ds_parser.ypp"
 
 	#include "daScript/misc/platform.h"
 	#include "daScript/ast/ast.h"
@@ -92,143 +94,147 @@ extern int das_yydebug;
     
     Annotation * findAnnotation ( const string & name, const LineInfo & at );
 
-#line 96 "C:/Users/Boris/Work/yzg/generated/ds_parser.hpp" /* yacc.c:1906  */
+#line 98 "generated/ds_parser.hpp"
 
-/* Token type.  */
+/* Token kinds.  */
 #ifndef DAS_YYTOKENTYPE
 # define DAS_YYTOKENTYPE
   enum das_yytokentype
   {
-    LEXER_ERROR = 258,
-    DAS_STRUCT = 259,
-    DAS_LET = 260,
-    DAS_DEF = 261,
-    DAS_WHILE = 262,
-    DAS_IF = 263,
-    DAS_ELSE = 264,
-    DAS_FOR = 265,
-    DAS_CATCH = 266,
-    DAS_TRUE = 267,
-    DAS_FALSE = 268,
-    DAS_NEWT = 269,
-    DAS_TYPEINFO = 270,
-    DAS_TYPE = 271,
-    DAS_IN = 272,
-    DAS_ELIF = 273,
-    DAS_ARRAY = 274,
-    DAS_RETURN = 275,
-    DAS_NULL = 276,
-    DAS_BREAK = 277,
-    DAS_TRY = 278,
-    DAS_OPTIONS = 279,
-    DAS_TABLE = 280,
-    DAS_EXPECT = 281,
-    DAS_CONST = 282,
-    DAS_REQUIRE = 283,
-    DAS_OPERATOR = 284,
-    DAS_ENUM = 285,
-    DAS_FINALLY = 286,
-    DAS_DELETE = 287,
-    DAS_DEREF = 288,
-    DAS_SCOPE = 289,
-    DAS_TYPEDEF = 290,
-    DAS_WITH = 291,
-    DAS_CAST = 292,
-    DAS_OVERRIDE = 293,
-    DAS_UPCAST = 294,
-    DAS_ITERATOR = 295,
-    DAS_VAR = 296,
-    DAS_ADDR = 297,
-    DAS_CONTINUE = 298,
-    DAS_WHERE = 299,
-    DAS_REINTERPRET = 300,
-    DAS_TBOOL = 301,
-    DAS_TVOID = 302,
-    DAS_TSTRING = 303,
-    DAS_TAUTO = 304,
-    DAS_TINT = 305,
-    DAS_TINT2 = 306,
-    DAS_TINT3 = 307,
-    DAS_TINT4 = 308,
-    DAS_TUINT = 309,
-    DAS_TUINT2 = 310,
-    DAS_TUINT3 = 311,
-    DAS_TUINT4 = 312,
-    DAS_TFLOAT = 313,
-    DAS_TFLOAT2 = 314,
-    DAS_TFLOAT3 = 315,
-    DAS_TFLOAT4 = 316,
-    DAS_TRANGE = 317,
-    DAS_TURANGE = 318,
-    DAS_TBLOCK = 319,
-    DAS_TINT64 = 320,
-    DAS_TUINT64 = 321,
-    DAS_TDOUBLE = 322,
-    DAS_TFUNCTION = 323,
-    DAS_TLAMBDA = 324,
-    DAS_TINT8 = 325,
-    DAS_TUINT8 = 326,
-    DAS_TINT16 = 327,
-    DAS_TUINT16 = 328,
-    DAS_TTUPLE = 329,
-    ADDEQU = 330,
-    SUBEQU = 331,
-    DIVEQU = 332,
-    MULEQU = 333,
-    MODEQU = 334,
-    ANDEQU = 335,
-    OREQU = 336,
-    XOREQU = 337,
-    SHL = 338,
-    SHR = 339,
-    ADDADD = 340,
-    SUBSUB = 341,
-    LEEQU = 342,
-    SHLEQU = 343,
-    SHREQU = 344,
-    GREQU = 345,
-    EQUEQU = 346,
-    NOTEQU = 347,
-    RARROW = 348,
-    LARROW = 349,
-    QQ = 350,
-    QDOT = 351,
-    LPIPE = 352,
-    LBPIPE = 353,
-    RPIPE = 354,
-    CLONEEQU = 355,
-    ROTL = 356,
-    ROTR = 357,
-    ROTLEQU = 358,
-    ROTREQU = 359,
-    INTEGER = 360,
-    LONG_INTEGER = 361,
-    UNSIGNED_INTEGER = 362,
-    UNSIGNED_LONG_INTEGER = 363,
-    FLOAT = 364,
-    DOUBLE = 365,
-    NAME = 366,
-    BEGIN_STRING = 367,
-    STRING_CHARACTER = 368,
-    END_STRING = 369,
-    BEGIN_STRING_EXPR = 370,
-    END_STRING_EXPR = 371,
-    UNARY_MINUS = 372,
-    UNARY_PLUS = 373,
-    PRE_INC = 374,
-    PRE_DEC = 375,
-    POST_INC = 376,
-    POST_DEC = 377,
-    COLCOL = 378
+    DAS_YYEMPTY = -2,
+    DAS_YYEOF = 0,                 /* "end of file"  */
+    DAS_YYerror = 256,             /* error  */
+    DAS_YYUNDEF = 257,             /* "invalid token"  */
+    LEXER_ERROR = 258,             /* LEXER_ERROR  */
+    DAS_STRUCT = 259,              /* DAS_STRUCT  */
+    DAS_LET = 260,                 /* DAS_LET  */
+    DAS_DEF = 261,                 /* DAS_DEF  */
+    DAS_WHILE = 262,               /* DAS_WHILE  */
+    DAS_IF = 263,                  /* DAS_IF  */
+    DAS_ELSE = 264,                /* DAS_ELSE  */
+    DAS_FOR = 265,                 /* DAS_FOR  */
+    DAS_CATCH = 266,               /* DAS_CATCH  */
+    DAS_TRUE = 267,                /* DAS_TRUE  */
+    DAS_FALSE = 268,               /* DAS_FALSE  */
+    DAS_NEWT = 269,                /* DAS_NEWT  */
+    DAS_TYPEINFO = 270,            /* DAS_TYPEINFO  */
+    DAS_TYPE = 271,                /* DAS_TYPE  */
+    DAS_IN = 272,                  /* DAS_IN  */
+    DAS_ELIF = 273,                /* DAS_ELIF  */
+    DAS_ARRAY = 274,               /* DAS_ARRAY  */
+    DAS_RETURN = 275,              /* DAS_RETURN  */
+    DAS_NULL = 276,                /* DAS_NULL  */
+    DAS_BREAK = 277,               /* DAS_BREAK  */
+    DAS_TRY = 278,                 /* DAS_TRY  */
+    DAS_OPTIONS = 279,             /* DAS_OPTIONS  */
+    DAS_TABLE = 280,               /* DAS_TABLE  */
+    DAS_EXPECT = 281,              /* DAS_EXPECT  */
+    DAS_CONST = 282,               /* DAS_CONST  */
+    DAS_REQUIRE = 283,             /* DAS_REQUIRE  */
+    DAS_OPERATOR = 284,            /* DAS_OPERATOR  */
+    DAS_ENUM = 285,                /* DAS_ENUM  */
+    DAS_FINALLY = 286,             /* DAS_FINALLY  */
+    DAS_DELETE = 287,              /* DAS_DELETE  */
+    DAS_DEREF = 288,               /* DAS_DEREF  */
+    DAS_SCOPE = 289,               /* DAS_SCOPE  */
+    DAS_TYPEDEF = 290,             /* DAS_TYPEDEF  */
+    DAS_WITH = 291,                /* DAS_WITH  */
+    DAS_CAST = 292,                /* DAS_CAST  */
+    DAS_OVERRIDE = 293,            /* DAS_OVERRIDE  */
+    DAS_UPCAST = 294,              /* DAS_UPCAST  */
+    DAS_ITERATOR = 295,            /* DAS_ITERATOR  */
+    DAS_VAR = 296,                 /* DAS_VAR  */
+    DAS_ADDR = 297,                /* DAS_ADDR  */
+    DAS_CONTINUE = 298,            /* DAS_CONTINUE  */
+    DAS_WHERE = 299,               /* DAS_WHERE  */
+    DAS_REINTERPRET = 300,         /* DAS_REINTERPRET  */
+    DAS_TBOOL = 301,               /* DAS_TBOOL  */
+    DAS_TVOID = 302,               /* DAS_TVOID  */
+    DAS_TSTRING = 303,             /* DAS_TSTRING  */
+    DAS_TAUTO = 304,               /* DAS_TAUTO  */
+    DAS_TINT = 305,                /* DAS_TINT  */
+    DAS_TINT2 = 306,               /* DAS_TINT2  */
+    DAS_TINT3 = 307,               /* DAS_TINT3  */
+    DAS_TINT4 = 308,               /* DAS_TINT4  */
+    DAS_TUINT = 309,               /* DAS_TUINT  */
+    DAS_TUINT2 = 310,              /* DAS_TUINT2  */
+    DAS_TUINT3 = 311,              /* DAS_TUINT3  */
+    DAS_TUINT4 = 312,              /* DAS_TUINT4  */
+    DAS_TFLOAT = 313,              /* DAS_TFLOAT  */
+    DAS_TFLOAT2 = 314,             /* DAS_TFLOAT2  */
+    DAS_TFLOAT3 = 315,             /* DAS_TFLOAT3  */
+    DAS_TFLOAT4 = 316,             /* DAS_TFLOAT4  */
+    DAS_TRANGE = 317,              /* DAS_TRANGE  */
+    DAS_TURANGE = 318,             /* DAS_TURANGE  */
+    DAS_TBLOCK = 319,              /* DAS_TBLOCK  */
+    DAS_TINT64 = 320,              /* DAS_TINT64  */
+    DAS_TUINT64 = 321,             /* DAS_TUINT64  */
+    DAS_TDOUBLE = 322,             /* DAS_TDOUBLE  */
+    DAS_TFUNCTION = 323,           /* DAS_TFUNCTION  */
+    DAS_TLAMBDA = 324,             /* DAS_TLAMBDA  */
+    DAS_TINT8 = 325,               /* DAS_TINT8  */
+    DAS_TUINT8 = 326,              /* DAS_TUINT8  */
+    DAS_TINT16 = 327,              /* DAS_TINT16  */
+    DAS_TUINT16 = 328,             /* DAS_TUINT16  */
+    DAS_TTUPLE = 329,              /* DAS_TTUPLE  */
+    ADDEQU = 330,                  /* ADDEQU  */
+    SUBEQU = 331,                  /* SUBEQU  */
+    DIVEQU = 332,                  /* DIVEQU  */
+    MULEQU = 333,                  /* MULEQU  */
+    MODEQU = 334,                  /* MODEQU  */
+    ANDEQU = 335,                  /* ANDEQU  */
+    OREQU = 336,                   /* OREQU  */
+    XOREQU = 337,                  /* XOREQU  */
+    SHL = 338,                     /* SHL  */
+    SHR = 339,                     /* SHR  */
+    ADDADD = 340,                  /* ADDADD  */
+    SUBSUB = 341,                  /* SUBSUB  */
+    LEEQU = 342,                   /* LEEQU  */
+    SHLEQU = 343,                  /* SHLEQU  */
+    SHREQU = 344,                  /* SHREQU  */
+    GREQU = 345,                   /* GREQU  */
+    EQUEQU = 346,                  /* EQUEQU  */
+    NOTEQU = 347,                  /* NOTEQU  */
+    RARROW = 348,                  /* RARROW  */
+    LARROW = 349,                  /* LARROW  */
+    QQ = 350,                      /* QQ  */
+    QDOT = 351,                    /* QDOT  */
+    LPIPE = 352,                   /* LPIPE  */
+    LBPIPE = 353,                  /* LBPIPE  */
+    RPIPE = 354,                   /* RPIPE  */
+    CLONEEQU = 355,                /* CLONEEQU  */
+    ROTL = 356,                    /* ROTL  */
+    ROTR = 357,                    /* ROTR  */
+    ROTLEQU = 358,                 /* ROTLEQU  */
+    ROTREQU = 359,                 /* ROTREQU  */
+    INTEGER = 360,                 /* INTEGER  */
+    LONG_INTEGER = 361,            /* LONG_INTEGER  */
+    UNSIGNED_INTEGER = 362,        /* UNSIGNED_INTEGER  */
+    UNSIGNED_LONG_INTEGER = 363,   /* UNSIGNED_LONG_INTEGER  */
+    FLOAT = 364,                   /* FLOAT  */
+    DOUBLE = 365,                  /* DOUBLE  */
+    NAME = 366,                    /* NAME  */
+    BEGIN_STRING = 367,            /* BEGIN_STRING  */
+    STRING_CHARACTER = 368,        /* STRING_CHARACTER  */
+    END_STRING = 369,              /* END_STRING  */
+    BEGIN_STRING_EXPR = 370,       /* BEGIN_STRING_EXPR  */
+    END_STRING_EXPR = 371,         /* END_STRING_EXPR  */
+    UNARY_MINUS = 372,             /* UNARY_MINUS  */
+    UNARY_PLUS = 373,              /* UNARY_PLUS  */
+    PRE_INC = 374,                 /* PRE_INC  */
+    PRE_DEC = 375,                 /* PRE_DEC  */
+    POST_INC = 376,                /* POST_INC  */
+    POST_DEC = 377,                /* POST_DEC  */
+    COLCOL = 378                   /* COLCOL  */
   };
+  typedef enum das_yytokentype das_yytoken_kind_t;
 #endif
 
 /* Value type.  */
 #if ! defined DAS_YYSTYPE && ! defined DAS_YYSTYPE_IS_DECLARED
-
 union DAS_YYSTYPE
 {
-#line 67 "src/parser/ds_parser.ypp" /* yacc.c:1906  */
+#line 67 "src/parser/ds_parser.ypp"
 
     char                            ch;
     bool                            b;
@@ -253,9 +259,9 @@ union DAS_YYSTYPE
     Enumeration *                   pEnum;
     Structure *                     pStructure;
 
-#line 257 "C:/Users/Boris/Work/yzg/generated/ds_parser.hpp" /* yacc.c:1906  */
-};
+#line 263 "generated/ds_parser.hpp"
 
+};
 typedef union DAS_YYSTYPE DAS_YYSTYPE;
 # define DAS_YYSTYPE_IS_TRIVIAL 1
 # define DAS_YYSTYPE_IS_DECLARED 1
@@ -278,6 +284,8 @@ struct DAS_YYLTYPE
 
 extern DAS_YYSTYPE das_yylval;
 extern DAS_YYLTYPE das_yylloc;
+
 int das_yyparse (void);
 
-#endif /* !YY_DAS_YY_C_USERS_BORIS_WORK_YZG_GENERATED_DS_PARSER_HPP_INCLUDED  */
+
+#endif /* !YY_DAS_YY_GENERATED_DS_PARSER_HPP_INCLUDED  */
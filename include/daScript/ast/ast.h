@@ -10,6 +10,7 @@
 #include "daScript/ast/compilation_errors.h"
 #include "daScript/ast/ast_typedecl.h"
 #include "daScript/simulate/aot_library.h"
+#include "daScript/simulate/simulate_image.h"
 
 namespace das
 {
@@ -295,6 +296,7 @@ namespace das
         virtual bool rtti_isStringConstant() const { return false; }
         virtual bool rtti_isCall() const { return false; }
         virtual bool rtti_isInvoke() const { return false; }
+        virtual bool rtti_isIterAdapter() const { return false; }
         virtual bool rtti_isCallLikeExpr() const { return false; }
         virtual bool rtti_isLet() const { return false; }
         virtual bool rtti_isReturn() const { return false; }
@@ -446,6 +448,8 @@ namespace das
                 bool    noAot : 1;
                 bool    aotHybrid : 1;
                 bool    aotTemplate : 1;
+                bool    inlineCall : 1;
+                bool    noInline : 1;
             };
             uint32_t flags = 0;
         };
@@ -509,6 +513,7 @@ namespace das
         EnumerationPtr findEnum ( const string & name ) const;
         ExprCallFactory * findCall ( const string & name ) const;
         bool compileBuiltinModule ( const string & name, unsigned char * str, unsigned int str_len );//will replace last symbol to 0
+        static void compileBuiltinModules();
         static Module * require ( const string & name );
         static void Shutdown();
         static TypeAnnotation * resolveAnnotation ( TypeInfo * info );
@@ -541,9 +546,18 @@ namespace das
         string  name;
         bool    builtIn = false;
     private:
+        bool compileBuiltinSource ( const string & name, unsigned char * str, unsigned int str_len );
+    private:
+        struct BuiltinSource {
+            string          name;
+            unsigned char * str;
+            unsigned int    length;
+        };
         Module * next = nullptr;
         static Module * modules;
+        static bool compilingBuiltinModules;
         unique_ptr<FileInfo>    ownFileInfo;
+        vector<BuiltinSource>   builtinSources;
     };
 
     #define REGISTER_MODULE(ClassName) \
@@ -616,6 +630,26 @@ namespace das
         map<string,EnumInfo *>          emn2e;
     };
 
+    // functions, which optimization round visits, and the ones it changed
+    struct OptimizationWorklist {
+        set<Function *>     functions;              // functions to visit, if not 'all'
+        bool                all = true;
+        set<Function *>     changed;
+        bool                changedOutside = false; // something outside of the functions changed, i.e. global variable
+    };
+
+    // program, prepared for the sharded AOT. see Program::aotCppPrepare
+    class BlockVariableCollector;
+    struct AotCppPrepared {
+        vector<Function *>                  functions;  // functions which get generated
+        vector<Module *>                    modules;    // script modules, which are generated with this program. calls to them are direct
+        map<Function *,vector<Function *>>  calls;      // functions of this module, which each function calls directly
+        map<Function *,string>              noAotReasons;   // functions, which stay interpreted, and why
+        shared_ptr<BlockVariableCollector>  collector;
+        bool                                prototypes = true;  // if false, header has no function prototypes and each shard declares what it calls
+    };
+    typedef shared_ptr<AotCppPrepared> AotCppPreparedPtr;
+
     class Program : public enable_shared_from_this<Program> {
     public:
         Program();
@@ -638,11 +672,12 @@ namespace das
         void inferTypes(TextWriter & logs);
         void lint();
         void checkSideEffects();
-        bool optimizationRefFolding();
-        bool optimizationConstFolding();
-        bool optimizationBlockFolding();
-        bool optimizationCondFolding();
-        bool optimizationUnused(TextWriter & logs);
+        bool optimizationRefFolding(OptimizationWorklist * work = nullptr);
+        bool optimizationConstFolding(OptimizationWorklist * work = nullptr);
+        bool optimizationBlockFolding(OptimizationWorklist * work = nullptr);
+        bool optimizationCondFolding(OptimizationWorklist * work = nullptr);
+        bool optimizationUnused(TextWriter & logs, OptimizationWorklist * work = nullptr);
+        bool inlineFunctions(TextWriter & logs);
         void fusion ( Context & context, TextWriter & logs );
         void buildAccessFlags(TextWriter & logs);
         bool verifyAndFoldContracts();
@@ -651,9 +686,15 @@ namespace das
         void clearSymbolUse();
         void markOrRemoveUnusedSymbols(bool forceAll = false);
         void allocateStack(TextWriter & logs);
+        void allocateIndices(TextWriter & logs);
         string dotGraph();
         bool simulate ( Context & context, TextWriter & logs );
+        void simulateForFolding ( Context & context );
+        void simulateFunctionForFolding ( Context & context, Function * fn );
         void linkCppAot ( Context & context, AotLibrary & aotLib, TextWriter & logs );
+        // AOT factory of each function by its index in the context, or empty one if there is no valid AOT
+        vector<AotFactory> findCppAot ( Context & context, AotLibrary & aotLib, TextWriter & logs );
+        bool makeImage ( Context & context, ContextImage & image, TextWriter & logs );
         void error ( const string & str, const LineInfo & at, CompilationError cerr = CompilationError::unspecified );
         bool failed() const { return failToCompile; }
         static ExpressionPtr makeConst ( const LineInfo & at, const TypeDeclPtr & type, vec4f value );
@@ -662,9 +703,21 @@ namespace das
         StructurePtr visitStructure(Visitor & vis, Structure *);
         EnumerationPtr visitEnumeration(Visitor & vis, Enumeration *);
         void visit(Visitor & vis, bool visitGenerics = false);
+        void visitGlobals(Visitor & vis);
         void setPrintFlags();
         void aotCpp ( Context & context, TextWriter & logs );
-        void registerAotCpp ( TextWriter & logs, Context & context, bool headers = true );
+        void aotCpp ( const AotCppPreparedPtr & prepared, TextWriter & logs );
+        // AOT, split between several files. prepare is not thread safe,
+        // functions can be generated in parallel as long as each function goes to one shard only
+        AotCppPreparedPtr aotCppPrepare ( Context & context, bool wholeProject = false );
+        void aotCppHeader ( const AotCppPreparedPtr & prepared, TextWriter & logs );
+        void aotCppInitScript ( const AotCppPreparedPtr & prepared, TextWriter & logs );
+        void aotCppFunctions ( const AotCppPreparedPtr & prepared, const vector<Function *> & functions, TextWriter & logs );
+        void aotCppPrototypes ( const AotCppPreparedPtr & prepared, const vector<Function *> & functions, TextWriter & logs );
+        void registerAotCpp ( TextWriter & logs, Context & context, bool headers = true, const AotCppPreparedPtr & prepared = nullptr );
+        void registerAotCppFunctions ( TextWriter & logs, const vector<Function *> & functions );
+        // functions, which fall back to the interpreter, and why
+        void aotCppReport ( const AotCppPreparedPtr & prepared, TextWriter & logs );
         void buildMNLookup ( Context & context, TextWriter & logs );
         void buildADLookup ( Context & context, TextWriter & logs );
     public:
@@ -690,6 +743,7 @@ namespace das
         vector<Error>               errors;
         bool                        failToCompile = false;
         uint32_t                    globalInitStackSize = 0;
+        map<string,ExpressionPtr>   foldingCache;   // results of calls, folded at compilation time. nullptr if it did not fold
     public:
         map<CompilationError,int>   expectErrors;
     public:
@@ -699,8 +753,29 @@ namespace das
     // this one works for single module only
     ProgramPtr parseDaScript ( const string & fileName, const FileAccessPtr & access, TextWriter & logs, ModuleGroup & libGroup, bool exportAll = false );
 
+    // programs, compiled from the same sources with the same options, are the same.
+    //  cache keeps them, along with the modules they require and the files they were compiled from
+    class ProgramCache {
+    public:
+        ProgramPtr find ( uint64_t key );
+        void add ( uint64_t key, const ProgramPtr & program, unique_ptr<ModuleGroup> && group, const FileAccessPtr & access );
+        void clear() { programs.clear(); }
+    public:
+        uint32_t    hits = 0;
+        uint32_t    misses = 0;
+    protected:
+        struct CachedProgram {
+            unique_ptr<ModuleGroup> group;
+            FileAccessPtr           access;
+            ProgramPtr              program;
+        };
+        map<uint64_t,CachedProgram> programs;
+    };
+
     // this one collectes dependencies and compiles with modules
-    ProgramPtr compileDaScript ( const string & fileName, const FileAccessPtr & access, TextWriter & logs, ModuleGroup & libGroup, bool exportAll = false );
+    //  with the cache, required modules are compiled into the cache, and not into the libGroup
+    ProgramPtr compileDaScript ( const string & fileName, const FileAccessPtr & access, TextWriter & logs, ModuleGroup & libGroup,
+                                bool exportAll = false, ProgramCache * cache = nullptr );
 
 
     // note: this has sifnificant performance implications
@@ -513,6 +513,7 @@ namespace das
         virtual ExpressionPtr clone( const ExpressionPtr & expr = nullptr ) const override;
         virtual SimNode * simulate (Context & context) const override;
         virtual ExpressionPtr visit(Visitor & vis) override;
+        bool isScalar() const;
         vector<ExpressionPtr>   elements;
     };
 
@@ -628,6 +629,16 @@ namespace das
         virtual SimNode * simulate (Context & context) const override;
     };
 
+    // map, filter, take, skip, zip, enumerate
+    //  only valid as a for loop source, where the parser fuses them into the loop (see generateFusedFor)
+    struct ExprIterAdapter : ExprLikeCall<ExprIterAdapter> {
+        ExprIterAdapter () = default;
+        ExprIterAdapter ( const LineInfo & a, const string & name ) : ExprLikeCall<ExprIterAdapter>(a, name) {}
+        virtual ExpressionPtr clone( const ExpressionPtr & expr = nullptr ) const override;
+        virtual SimNode * simulate (Context & context) const override;
+        virtual bool rtti_isIterAdapter() const override { return true; }
+    };
+
     template <typename It, typename SimNodeT, bool first>
     struct ExprTableKeysOrValues : ExprLooksLikeCall {
         ExprTableKeysOrValues() = default;
@@ -60,5 +60,22 @@ namespace das {
     */
     struct ExprArrayComprehension;
     ExpressionPtr generateComprehension ( ExprArrayComprehension * expr );
-}
 
+    /*
+         for loop over iterator adapters, i.e. for x,i in take(filter(src,pred),n),range(0,10)
+         {
+             let __take_n : int = n
+             var __take_i = 0
+             for x,i in src,range(0,10)
+                 if !invoke(pred,x)
+                     continue
+                 if __take_i >= __take_n
+                     break
+                 __take_i ++
+                 ...body...
+         }
+         returns expr itself, when there is nothing to fuse
+    */
+    struct ExprFor;
+    Expression * generateFusedFor ( ExprFor * expr );
+}
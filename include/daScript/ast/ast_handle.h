@@ -305,6 +305,25 @@ namespace das
                 }
             }
         };
+        struct SimNode_StdVectorSlice : SimNode {
+            using TT = OT;
+            SimNode_StdVectorSlice ( const LineInfo & at, SimNode * rv, SimNode * rng )
+                : SimNode(at), value(rv), index(rng) {}
+            virtual SimNode * visit ( SimVisitor & vis ) override {
+                V_BEGIN();
+                V_OP_TT(StdVectorSlice);
+                V_SUB(value);
+                V_SUB(index);
+                V_END();
+            }
+            virtual vec4f eval ( Context & context ) override {
+                auto pValue = (VectorType *) value->evalPtr(context);
+                range r = cast<range>::to(index->eval(context));
+                return cast<Slice>::from(slice_make(context, (char *) pValue->data(),
+                    uint32_t(pValue->size()), uint32_t(sizeof(OT)), r.from, r.to));
+            }
+            SimNode * value, * index;
+        };
         struct VectorIterator : Iterator {
             VectorIterator  ( VectorType * ar ) : array(ar) {}
             virtual bool first ( Context &, char * _value ) override {
@@ -337,7 +356,9 @@ namespace das
         virtual size_t getSizeOf() const override { return sizeof(VectorType); }
         virtual size_t getAlignOf() const override { return alignof(VectorType); }
         virtual bool isRefType() const override { return true; }
-        virtual bool isIndexable ( const TypeDeclPtr & indexType ) const override { return indexType->isIndex(); }
+        virtual bool isIndexable ( const TypeDeclPtr & indexType ) const override {
+            return indexType->isIndex() || indexType->isSimpleType(Type::tRange);
+        }
         virtual bool isIterable ( ) const override { return true; }
         virtual bool canMove() const override { return false; }
         virtual bool canCopy() const override { return false; }
@@ -360,7 +381,13 @@ namespace das
                 ss << "." << fieldName << " /*undefined */";
             }
         }
-        virtual TypeDeclPtr makeIndexType ( const ExpressionPtr &, const ExpressionPtr & ) const override {
+        virtual TypeDeclPtr makeIndexType ( const ExpressionPtr &, const ExpressionPtr & idx ) const override {
+            if ( idx->type->isSimpleType(Type::tRange) ) {
+                auto sliceType = make_shared<TypeDecl>(Type::tSlice);
+                sliceType->firstType = make_shared<TypeDecl>(*vecType);
+                sliceType->firstType->ref = false;
+                return sliceType;
+            }
             return make_shared<TypeDecl>(*vecType);
         }
         virtual TypeDeclPtr makeIteratorType ( const ExpressionPtr & ) const override {
@@ -368,6 +395,11 @@ namespace das
         }
         virtual SimNode * simulateGetAt ( Context & context, const LineInfo & at, const TypeDeclPtr &,
                                          const ExpressionPtr & rv, const ExpressionPtr & idx, uint32_t ofs ) const override {
+            if ( idx->type->isSimpleType(Type::tRange) ) {
+                return context.code->makeNode<SimNode_StdVectorSlice>(at,
+                                                                      rv->simulate(context),
+                                                                      idx->simulate(context));
+            }
             return context.code->makeNode<SimNode_AtStdVector>(at,
                                                                rv->simulate(context),
                                                                idx->simulate(context),
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_library.h"
+
+#include <thread>
+#include <atomic>
+
+namespace das {
+
+    struct SimNode_JitCallCounter;
+
+    struct CppJitOptions {
+        string          compiler = "c++ -std=c++14 -O2 -msse4.1 -fPIC -shared -w";
+        vector<string>  includePaths;               // daScript include, and includes of the modules with AOT
+        string          tempPath = "/tmp";          // generated C++, compiled shared objects, and compiler logs go here
+        uint64_t        hotCalls = 1000;            // function is compiled, once it is called this many times
+    };
+
+    // JIT via the system C++ compiler
+    //  functions of the program, which are called often, are generated as AOT C++ and compiled into the shared object
+    //  in the background thread. shared object is then loaded, and its functions are linked into the context.
+    //  host calls update at the safe point, i.e. between Context::eval calls. host executable has to export daScript symbols
+    //  when destroyed, interpreted code of the functions is restored, so the context can outlive the JIT
+    class CppJit {
+    public:
+        CppJit ( const ProgramPtr & prog, Context & ctx, const CppJitOptions & opt );
+        CppJit ( const CppJit & ) = delete;
+        CppJit & operator = ( const CppJit & ) = delete;
+        ~CppJit();
+        // starts compilation of the hot functions, links the ones which are compiled. returns true if any code changed
+        bool update ( TextWriter & logs );
+        // waits for the compilation in flight, and links it
+        bool flush ( TextWriter & logs );
+        bool busy() const { return worker.joinable(); }
+        int jitFunctions() const { return totalJit; }
+    protected:
+        bool startCompile ( TextWriter & logs );
+        bool finishCompile ( TextWriter & logs );
+        void profile ( bool enable );
+    protected:
+        enum class JitState : uint8_t { interpreted, profiled, compiling, compiled, failed };
+        ProgramPtr                          program;
+        Context &                           context;
+        CppJitOptions                       options;
+        vector<Function *>                  functions;  // by SimFunction index
+        vector<SimNode *>                   original;
+        vector<SimNode_JitCallCounter *>    counters;
+        vector<JitState>                    state;
+        vector<unique_ptr<AotSharedLibrary>> libraries;
+        thread                              worker;
+        atomic<bool>                        compiled;
+        bool                                compiledOk = false;
+        string                              libraryName;
+        string                              logName;
+        int                                 generation = 0;
+        int                                 totalJit = 0;
+    };
+}
+
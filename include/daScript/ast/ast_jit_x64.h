@@ -0,0 +1,37 @@
+#pragma once
+
+#include "daScript/ast/ast.h"
+
+namespace das {
+
+    // in-process JIT of the numeric leaf functions into x86-64 machine code, no external compiler is involved
+    //  functions, which only operate on int, bool, float and float2..float4 arguments and locals, with branches and loops,
+    //  and call nothing but built-in arithmetic, are lowered to machine code. code of such function is replaced with
+    //  the node, which calls the machine code. anything else stays interpreted
+    //  when destroyed, interpreted code of the functions is restored
+    class JitX64 {
+    public:
+        JitX64 ( const ProgramPtr & prog, Context & ctx );
+        JitX64 ( const JitX64 & ) = delete;
+        JitX64 & operator = ( const JitX64 & ) = delete;
+        ~JitX64();
+        // false on anything but x86-64
+        static bool supported();
+        // compiles all the functions it can, returns how many. verbose logs why other functions stay interpreted
+        int compile ( TextWriter & logs, bool verbose = false );
+        // compiles one function by its index in the context
+        bool compile ( int fnIndex, TextWriter & logs, bool verbose = false );
+        bool compiled ( int fnIndex ) const;
+        int jitFunctions() const { return totalJit; }
+    protected:
+        enum class JitState : uint8_t { interpreted, compiled, failed };
+        ProgramPtr                  program;
+        Context &                   context;
+        vector<Function *>          functions;  // by SimFunction index
+        vector<SimNode *>           original;
+        vector<JitState>            state;
+        vector<pair<void *,size_t>> memory;
+        int                         totalJit = 0;
+    };
+}
+
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_jit_x64.h"
+
+namespace das {
+
+    struct SimNode_TierCounter;
+
+    // tiers, in order of promotion. tiered_functions(tier) builtin reports how many functions are at each
+    enum class ExecutionTier : uint8_t { interpreted, fused, aot, jit, total };
+
+    struct TieringOptions {
+        uint64_t        fuseAt = 100;               // calls and loop iterations, after which the function is fused
+        uint64_t        nativeAt = 10000;           // calls and loop iterations, after which AOT or native JIT is linked
+        AotLibrary *    aotLib = nullptr;           // AOT functions to link, if any
+        bool            nativeJit = true;           // JitX64 for the functions without AOT
+    };
+
+    // tiered execution. functions start with the code from the simulate, calls and loop iterations are counted
+    //  once function is hot enough, it is fused, and later on gets AOT or native JIT code, whichever is available
+    //  simulate with the 'options fusion=false' to start with the unfused code. otherwise functions start fused
+    //  host calls update at the safe point, i.e. between Context::eval calls
+    //  when destroyed, counters are removed and native JIT code is unlinked. fused and AOT code stays
+    class TieredExecution {
+    public:
+        TieredExecution ( const ProgramPtr & prog, Context & ctx, const TieringOptions & opt );
+        TieredExecution ( const TieredExecution & ) = delete;
+        TieredExecution & operator = ( const TieredExecution & ) = delete;
+        ~TieredExecution();
+        // promotes functions, which are hot enough. returns how many
+        int update ( TextWriter & logs );
+        ExecutionTier tier ( int fnIndex ) const { return functions[fnIndex].tier; }
+        uint64_t hotness ( int fnIndex ) const;
+        int promotions() const { return totalPromotions; }
+    protected:
+        struct TieredFunction {
+            ExecutionTier           tier = ExecutionTier::interpreted;
+            bool                    final = false;  // nothing left to promote to
+            AotFactory              aot;
+            SimNode_TierCounter *   counter = nullptr;
+            uint64_t                loops = 0;
+        };
+        void instrument ( int fnIndex );
+        void strip ( int fnIndex );
+        void promote ( int fnIndex, TextWriter & logs );
+        void updateStats();
+    protected:
+        ProgramPtr                  program;
+        Context &                   context;
+        TieringOptions              options;
+        vector<TieredFunction>      functions;  // by SimFunction index
+        set<SimNode *>              loopCounters;
+        unique_ptr<JitX64>          jit;
+        int                         totalPromotions = 0;
+    };
+}
+
@@ -55,6 +55,7 @@ namespace das {
         bool isGoodFunctionType() const;
         bool isGoodLambdaType() const;
         bool isGoodTupleType() const;
+        bool isGoodSliceType() const;
         bool isVoid() const;
         bool isRef() const;
         bool isRefType() const;
@@ -164,6 +165,7 @@ namespace das {
     template<> struct ToBasicType<Func>         { enum { type = Type::tFunction }; };
     template<> struct ToBasicType<Lambda>       { enum { type = Type::tLambda }; };
     template<> struct ToBasicType<Tuple>        { enum { type = Type::tTuple }; };
+    template<> struct ToBasicType<Slice>        { enum { type = Type::tSlice }; };
     template<> struct ToBasicType<Context *>    { enum { type = Type::fakeContext }; };
     template<> struct ToBasicType<vec4f>        { enum { type = Type::anyArgument }; };
 
@@ -155,6 +155,7 @@ namespace das {
         VISIT_EXPR(ExprAssert)
         VISIT_EXPR(ExprStaticAssert)
         VISIT_EXPR(ExprDebug)
+        VISIT_EXPR(ExprIterAdapter)
         VISIT_EXPR(ExprInvoke)
         VISIT_EXPR(ExprErase)
         VISIT_EXPR(ExprFind)
@@ -230,18 +231,24 @@ namespace das {
     class OptVisitor : public Visitor {
     public:
         bool didAnything () const { return anyFolding; }
+        // visit only functions from the worklist, and report which ones changed
+        void setWorklist ( OptimizationWorklist * work ) { worklist = work; }
+        virtual bool canVisitFunction ( Function * fun ) override;
     protected:
         void reportFolding();
     private:
-        bool anyFolding = false;
+        bool                    anyFolding = false;
+        OptimizationWorklist *  worklist = nullptr;
+        Function *              visitingFunction = nullptr;
     };
 
     class FoldingVisitor : public OptVisitor {
     public:
         FoldingVisitor( const ProgramPtr & prog ) : program(prog) {}
     protected:
-        Context         ctx;
-        ProgramPtr      program;
+        Context                     ctx;
+        ProgramPtr                  program;
+        shared_ptr<NodeAllocator>   evalCode = make_shared<NodeAllocator>();    // nodes of the expression being folded
     protected:
         vec4f eval ( Expression * expr, bool & failed );
         ExpressionPtr evalAndFold ( Expression * expr );
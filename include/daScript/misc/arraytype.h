@@ -65,6 +65,19 @@ namespace das
         uint32_t    lock;
     };
 
+    struct Slice {                  // non-owning view, does not lock or keep the source alive
+        char *      data;
+        uint32_t    size;
+        uint32_t    stride;
+        __forceinline bool operator == ( const Slice & b ) const {
+            return data==b.data && size==b.size && stride==b.stride;
+        }
+        __forceinline bool operator != ( const Slice & b ) const {
+            return data!=b.data || size!=b.size || stride!=b.stride;
+        }
+    };
+    static_assert(sizeof(Slice)<=sizeof(vec4f), "has to be castable");
+
     class Context;
 
     void array_lock ( Context & context, Array & arr );
@@ -73,6 +86,8 @@ namespace das
     void array_resize ( Context & context, Array & arr, uint32_t newSize, uint32_t stride, bool zero );
     void array_clear ( Context & context, Array & arr );
 
+    Slice slice_make ( Context & context, char * data, uint32_t size, uint32_t stride, int32_t from, int32_t to );
+
     struct Table : Array {
         char *      keys;
         uint32_t *  hashes;
@@ -0,0 +1,31 @@
+#pragma once
+
+namespace das {
+
+    // number to text. buffer has to fit the longest result (see DAS_NUMBER_BUFFER_SIZE),
+    // result is not zero terminated. functions return number of characters written
+    #define DAS_NUMBER_BUFFER_SIZE  32
+
+    int fmt_uint64 ( char * buf, uint64_t value );
+    int fmt_int64 ( char * buf, int64_t value );
+    // shortest representation, which reads back to the same value (Grisu2).
+    //  layout follows %g, only with as many digits as it takes: 0.1, 1e+20, 123456789
+    int fmt_double ( char * buf, double value );
+    int fmt_float ( char * buf, float value );
+
+    __forceinline int fmt_number ( char * buf, int32_t value )  { return fmt_int64(buf, value); }
+    __forceinline int fmt_number ( char * buf, uint32_t value ) { return fmt_uint64(buf, value); }
+    __forceinline int fmt_number ( char * buf, int64_t value )  { return fmt_int64(buf, value); }
+    __forceinline int fmt_number ( char * buf, uint64_t value ) { return fmt_uint64(buf, value); }
+    __forceinline int fmt_number ( char * buf, float value )    { return fmt_float(buf, value); }
+    __forceinline int fmt_number ( char * buf, double value )   { return fmt_double(buf, value); }
+
+    // text to number. parse the number at the beginning of [str,end), leading white space is skipped
+    // return pointer past the last character of the number, or nullptr if there is no number or it's out of range
+    const char * parse_int64 ( const char * str, const char * end, int64_t & value );
+    const char * parse_uint64 ( const char * str, const char * end, uint64_t & value );
+    const char * parse_int32 ( const char * str, const char * end, int32_t & value );
+    const char * parse_uint32 ( const char * str, const char * end, uint32_t & value );
+    const char * parse_double ( const char * str, const char * end, double & value );
+    const char * parse_float ( const char * str, const char * end, float & value );
+}
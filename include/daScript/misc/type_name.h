@@ -38,4 +38,5 @@ namespace das {
     template <> struct typeName<Func>     { static string name() { return "Func"; } };
     template <> struct typeName<Lambda>   { static string name() { return "Lambda"; } };
     template <> struct typeName<Block>    { static string name() { return "Block"; } };
+    template <> struct typeName<Slice>    { static string name() { return "Slice"; } };
 }
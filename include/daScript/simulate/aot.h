@@ -11,6 +11,7 @@
 #include "daScript/simulate/bin_serializer.h"
 #include "daScript/simulate/runtime_table.h"
 #include "daScript/simulate/interop.h"
+#include "daScript/misc/string_convert.h"
 
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic push
@@ -308,6 +309,57 @@ namespace das {
     template <typename TT>
     struct das_index<const TT *> : das_index<TT *> {};
 
+    template <typename TT>
+    struct TSlice : Slice {
+        TSlice() { data = nullptr; size = 0; stride = sizeof(TT); }
+        TSlice( const Slice & that ) { *(Slice *)this = that; }
+        __forceinline TT & operator [] ( int32_t index ) const {
+            return *(TT *)(data + index*stride);
+        }
+        __forceinline TT & operator () ( int32_t index, Context * __context__ ) const {
+            uint32_t idx = uint32_t(index);
+            if ( idx>=size ) __context__->throw_error("slice index out of range");
+            return *(TT *)(data + idx*stride);
+        }
+        __forceinline TT & operator () ( uint32_t idx, Context * __context__ ) const {
+            if ( idx>=size ) __context__->throw_error("slice index out of range");
+            return *(TT *)(data + idx*stride);
+        }
+        __forceinline TSlice<TT> operator () ( const range & r, Context * __context__ ) const {
+            return slice_make(*__context__, data, size, stride, r.from, r.to);
+        }
+    };
+
+    template <typename TT>
+    struct cast<TSlice<TT>> {
+        static __forceinline TSlice<TT> to ( vec4f x )          { return TSlice<TT>(cast<Slice>::to(x)); }
+        static __forceinline vec4f from ( const TSlice<TT> & x ) { return cast<Slice>::from(x); }
+    };
+
+    template <typename TT>
+    struct das_index<TSlice<TT>> {
+        template <typename IndexType>
+        static __forceinline auto at ( const TSlice<TT> & value, IndexType index, Context * __context__ ) -> decltype(value(index,__context__)) {
+            return value(index,__context__);
+        }
+    };
+
+    template <typename TT>
+    struct das_index<vector<TT>> {
+        static __forceinline TT & at ( vector<TT> & value, int32_t index, Context * __context__ ) {
+            uint32_t idx = uint32_t(index);
+            if ( idx>=value.size() ) __context__->throw_error("std::vector index out of range");
+            return value[idx];
+        }
+        static __forceinline TT & at ( vector<TT> & value, uint32_t idx, Context * __context__ ) {
+            if ( idx>=value.size() ) __context__->throw_error("std::vector index out of range");
+            return value[idx];
+        }
+        static __forceinline TSlice<TT> at ( vector<TT> & value, const range & r, Context * __context__ ) {
+            return slice_make(*__context__, (char *) value.data(), uint32_t(value.size()), uint32_t(sizeof(TT)), r.from, r.to);
+        }
+    };
+
     template <typename TT, uint32_t size>
     struct TDim {
         enum { capacity = size };
@@ -336,6 +388,12 @@ namespace das {
             if ( idx>=size ) __context__->throw_error("index out of range");
             return data[idx];
         }
+        __forceinline TSlice<TT> operator () ( const range & r, Context * __context__ ) {
+            return slice_make(*__context__, (char *) data, size, uint32_t(sizeof(TT)), r.from, r.to);
+        }
+        __forceinline TSlice<const TT> operator () ( const range & r, Context * __context__ ) const {
+            return slice_make(*__context__, (char *) data, size, uint32_t(sizeof(TT)), r.from, r.to);
+        }
     };
 
     template <typename TT>
@@ -375,6 +433,12 @@ namespace das {
             if ( idx>=size ) __context__->throw_error("index out of range");
             return ((TT *)data)[idx];
         }
+        __forceinline TSlice<TT> operator () ( const range & r, Context * __context__ ) {
+            return slice_make(*__context__, data, size, uint32_t(sizeof(TT)), r.from, r.to);
+        }
+        __forceinline TSlice<const TT> operator () ( const range & r, Context * __context__ ) const {
+            return slice_make(*__context__, data, size, uint32_t(sizeof(TT)), r.from, r.to);
+        }
     };
 
     template <typename TK, typename TV>
@@ -539,6 +603,26 @@ namespace das {
         TT *            array_end;
     };
 
+    template <typename TT>
+    struct das_iterator<TSlice<TT>> {
+        __forceinline das_iterator(const TSlice<TT> & r) : that(r) {
+            slice_end = that.data + that.size*that.stride;
+        }
+        __forceinline bool first ( Context *, TT * & i ) {
+            i = (TT *) that.data;
+            return that.data!=slice_end;
+        }
+        __forceinline bool next  ( Context *, TT * & i ) {
+            i = (TT *)(((char *)i) + that.stride);
+            return ((char *)i)!=slice_end;
+        }
+        __forceinline void close ( Context *, TT * & i ) {
+            i = nullptr;
+        }
+        TSlice<TT>  that;
+        char *      slice_end;
+    };
+
     template <typename TT>
     struct das_new {
         static __forceinline TT * make ( Context * __context__ ) {
@@ -837,11 +921,11 @@ namespace das {
 
     template <typename TT>
     __forceinline char * das_lexical_cast ( TT x, Context * __context__ ) {
-        StringBuilderWriter writer(__context__->heap);
-        writer << x;
-        auto pStr = writer.c_str();
+        char buf[DAS_NUMBER_BUFFER_SIZE];
+        int len = fmt_number(buf, x);
+        auto pStr = __context__->heap.allocateString(buf, uint32_t(len));
         if ( !pStr ) {
-            __context__->throw_error("can't allocate string builder result, out of heap");
+            __context__->throw_error("can't cast to string, out of heap");
         }
         return pStr;
     }
@@ -859,6 +943,10 @@ namespace das {
         return pStr;
     }
 
+    __forceinline char * das_string_builder_scalar ( Context * __context__, const SimNode_AotInteropBase & node ) {
+        return string_builder_scalar(*__context__, node.argumentValues, node.types, node.nArguments);
+    }
+
     struct das_stack_prologue {
         __forceinline das_stack_prologue ( Context * __context__, uint32_t stackSize, int32_t line )
             : context(__context__) {
@@ -1013,6 +1101,10 @@ namespace das {
             vec4f result = __context__->invoke(blk, arguments, nullptr);
             return cast<ResType>::to(result);
         }
+        template <typename BLK, typename ...ArgType>
+        static __forceinline ResType invoke ( Context *, const BLK & blk, ArgType ...arg ) {
+            return blk(arg...);
+        }
         // cmres
         static __forceinline ResType invoke_cmres ( Context * __context__, const Block & blk ) {
             ResType result;
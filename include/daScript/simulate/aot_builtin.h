@@ -13,10 +13,12 @@ namespace das {
     uint32_t heap_bytes_allocated ( Context * context );
     uint32_t heap_high_watermark ( Context * context );
     int32_t heap_depth ( Context * context );
+    int32_t tiered_functions ( int32_t tier, Context * context );
     void builtin_table_lock ( Table & arr, Context * context );
     void builtin_table_unlock ( Table & arr, Context * context );
     int builtin_array_size ( const Array & arr );
     int builtin_array_capacity ( const Array & arr );
+    int builtin_slice_size ( Slice slice );
     void builtin_array_resize ( Array & pArray, int newSize, int stride, Context * context );
     void builtin_array_reserve ( Array & pArray, int newSize, int stride, Context * context );
     int builtin_array_push ( Array & pArray, int index, int stride, Context * context );
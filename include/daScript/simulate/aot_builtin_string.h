@@ -2,6 +2,58 @@
 
 namespace das {
 
+    // non-owning view of a part of the string. it does not allocate, and it is only valid
+    // while the string it points to is alive. use string(view) to make a heap copy
+    struct StringView {
+        const char *    data;
+        uint32_t        length;
+        StringView() = default;
+        StringView(const char * d, uint32_t l) : data(d), length(l) {}
+        StringView(const StringView &) = default;
+        StringView & operator = ( const StringView & ) = default;
+    };
+
+    template <>
+    struct cast <StringView> {
+        static __forceinline StringView to ( vec4f x )          { union { StringView t; vec4f vec; } T; T.vec = x; return T.t; }
+        static __forceinline vec4f from ( StringView x )        { union { StringView t; vec4f vec; } T; T.vec = v_zero(); T.t = x; return T.vec; }
+    };
+
+    // calls fn(StringView) for each part of str between occurrences of delim
+    template <typename TT>
+    void string_view_split ( StringView str, StringView delim, TT && fn ) {
+        if ( !str.length ) return;
+        if ( !delim.length ) {
+            fn(str);
+            return;
+        }
+        const char * at = str.data;
+        const char * end = str.data + str.length;
+        for ( const char * t = at; t + delim.length <= end; ) {
+            if ( memcmp(t, delim.data, delim.length)==0 ) {
+                fn(StringView(at, uint32_t(t-at)));
+                t += delim.length;
+                at = t;
+            } else {
+                t ++;
+            }
+        }
+        fn(StringView(at, uint32_t(end-at)));
+    }
+
+    // calls fn(StringView) for each non-empty run of characters, which are not in delims
+    template <typename TT>
+    void string_view_tokenize ( StringView str, StringView delims, TT && fn ) {
+        const char * t = str.data;
+        const char * end = str.data + str.length;
+        while ( t != end ) {
+            while ( t != end && memchr(delims.data, *t, delims.length) ) t++;
+            const char * at = t;
+            while ( t != end && !memchr(delims.data, *t, delims.length) ) t++;
+            if ( t != at ) fn(StringView(at, uint32_t(t-at)));
+        }
+    }
+
     char * builtin_build_string ( const TBlock<void,StringBuilderWriter> & block, Context * context );
     vec4f builtin_write_string ( Context & context, SimNode_CallBase * call, vec4f * args );
 
@@ -23,6 +75,11 @@ namespace das {
     unsigned string_to_uint ( const char *str, Context * context );
     int string_to_int ( const char *str, Context * context );
     float string_to_float ( const char *str, Context * context );
+    double string_to_double ( const char *str, Context * context );
+    unsigned string_view_to_uint ( StringView str, Context * context );
+    int string_view_to_int ( StringView str, Context * context );
+    float string_view_to_float ( StringView str, Context * context );
+    double string_view_to_double ( StringView str, Context * context );
     float fast_to_float ( const char *str );
     int fast_to_int ( const char *str );
     char * to_das_string(const string & str, Context * ctx);
@@ -30,20 +87,67 @@ namespace das {
     void peek_das_string(const string & str, const TBlock<void,char *> & block, Context * context);
     char * string_repeat ( const char * str, int count, Context * context );
 
+    // string_view
+    StringView builtin_string_view ( const char * str, Context * context );
+    StringView builtin_string_view_slice1 ( StringView str, int start, int end );
+    StringView builtin_string_view_slice2 ( StringView str, int start );
+    StringView builtin_string_slice_view1 ( const char * str, int start, int end, Context * context );
+    StringView builtin_string_slice_view2 ( const char * str, int start, Context * context );
+    StringView builtin_string_view_strip ( StringView str );
+    StringView builtin_string_view_strip_left ( StringView str );
+    StringView builtin_string_view_strip_right ( StringView str );
+    StringView builtin_string_strip_view ( const char * str, Context * context );
+    StringView builtin_string_strip_left_view ( const char * str, Context * context );
+    StringView builtin_string_strip_right_view ( const char * str, Context * context );
+    int32_t builtin_string_view_length ( StringView str );
+    int32_t builtin_string_view_character_at ( StringView str, int32_t index, Context * context );
+    bool builtin_string_view_startswith ( StringView str, const char * cmp, Context * context );
+    bool builtin_string_view_endswith ( StringView str, const char * cmp, Context * context );
+    int32_t builtin_string_view_find ( StringView str, const char * substr, Context * context );
+    bool builtin_string_view_equ ( StringView a, StringView b );
+    bool builtin_string_view_nequ ( StringView a, StringView b );
+    bool builtin_string_view_equ_str ( StringView a, const char * b );
+    bool builtin_string_view_nequ_str ( StringView a, const char * b );
+    char * builtin_string_view_to_string ( StringView str, Context * context );
+    void builtin_string_split ( const char * str, const char * delim, const TBlock<void,StringView> & block, Context * context );
+    void builtin_string_view_split ( StringView str, const char * delim, const TBlock<void,StringView> & block, Context * context );
+    void builtin_string_tokenize ( const char * str, const char * delims, const TBlock<void,StringView> & block, Context * context );
+    void builtin_string_view_tokenize ( StringView str, const char * delims, const TBlock<void,StringView> & block, Context * context );
+
+    template <typename TT>
+    void builtin_string_split_T ( const char * str, const char * delim, TT && block, Context * context ) {
+        string_view_split(builtin_string_view(str,context), builtin_string_view(delim,context), block);
+    }
+
+    template <typename TT>
+    void builtin_string_view_split_T ( StringView str, const char * delim, TT && block, Context * context ) {
+        string_view_split(str, builtin_string_view(delim,context), block);
+    }
+
+    template <typename TT>
+    void builtin_string_tokenize_T ( const char * str, const char * delims, TT && block, Context * context ) {
+        string_view_tokenize(builtin_string_view(str,context), builtin_string_view(delims,context), block);
+    }
+
+    template <typename TT>
+    void builtin_string_view_tokenize_T ( StringView str, const char * delims, TT && block, Context * context ) {
+        string_view_tokenize(str, builtin_string_view(delims,context), block);
+    }
+
     __forceinline void das_clone ( string & dst, const string & src ) { dst = src; }
 
     template <typename TT>
     __forceinline char * format ( const char * fmt, TT value, Context * context ) {
         char buf[256];
-        snprintf(buf, 256, fmt, value);
-        return context->heap.allocateString(buf, uint32_t(strlen(buf)));
+        int len = snprintf(buf, 256, fmt, value);
+        return len>0 ? context->heap.allocateString(buf, uint32_t(len<256 ? len : 255)) : nullptr;
     }
 
     template <typename TT>
     void format_and_write ( StringBuilderWriter & writer, const char * fmt, TT value  ) {
         char buf[256];
-        snprintf(buf, 256, fmt, value);
-        writer.writeStr(buf, strlen(buf));
+        int len = snprintf(buf, 256, fmt, value);
+        if ( len>0 ) writer.writeStr(buf, len<256 ? len : 255);
     }
 
     template <typename TT>
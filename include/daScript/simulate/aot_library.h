@@ -4,14 +4,42 @@
 
 namespace das {
     typedef function<SimNode * (Context &)> AotFactory;
-    typedef map<uint64_t,AotFactory> AotLibrary;
+
+    // direct AOT call to the function of another module is only valid, if that function did not change
+    struct AotDependency {
+        uint32_t    mangledNameHash;
+        uint64_t    semanticHash;
+    };
+
+    struct AotLibrary : map<uint64_t,AotFactory> {
+        map<uint64_t,vector<AotDependency>> dependencies;   // semantic hash of the function -> functions it calls directly
+    };
 
     struct AotListBase {
         AotListBase();
+        virtual ~AotListBase();
         static void registerAot ( AotLibrary & lib );
         virtual void registerAotFunctions ( AotLibrary & lib ) = 0;
         AotListBase * tail = nullptr;
         static AotListBase * head;
     };
+
+    // AOT functions from the shared object, which is built from the dasAot output
+    //  the host executable has to export daScript symbols, so that the AotListBase of the shared object registers here
+    //  factories, and nodes which they make, have their code in the shared object.
+    //  it has to stay loaded while the AotLibrary and the contexts use them
+    class AotSharedLibrary {
+    public:
+        AotSharedLibrary() = default;
+        AotSharedLibrary ( const AotSharedLibrary & ) = delete;
+        AotSharedLibrary & operator = ( const AotSharedLibrary & ) = delete;
+        ~AotSharedLibrary() { unload(); }
+        // loads the shared object, and registers its AOT functions into the library
+        bool load ( const string & fileName, AotLibrary & lib, TextWriter & logs );
+        void unload();
+        bool loaded() const { return handle!=nullptr; }
+    protected:
+        void * handle = nullptr;
+    };
 }
 
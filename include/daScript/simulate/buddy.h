@@ -14,6 +14,8 @@ public:
     uint32_t    calcUsed() const;
     uint32_t    getInitialSize() const;
     uint32_t    getChunksCount() const;
+    template <typename TT>
+    void        forEachChunk ( TT && closure ) const;//closure(data,used) for the initial chunk, then for the rest
 protected:
     struct Chunk//sizeof(Chunk) == (12) in 32 bit, and (16) in 64 bit.
     {
@@ -121,6 +123,14 @@ inline void BuddyAllocator::allocateChunk(uint32_t size)
 
 inline uint32_t BuddyAllocator::getChunksCount() const {return (uint32_t)chunks.size() + 1;}
 
+template <typename TT>
+inline void BuddyAllocator::forEachChunk ( TT && closure ) const
+{
+    closure(initial.data, initial.used);
+    for (auto &c : chunks)
+        closure(c.data, c.used);
+}
+
 inline char *BuddyAllocator::allocateNonEmpty ( uint32_t size )
 {
     if (initial.getFree() >= size)
@@ -160,6 +160,12 @@ namespace das
         static __forceinline vec4f from ( const Lambda x )   { union { vec4f v; Lambda t; } A; A.t = x; return A.v; }
     };
 
+    template <>
+    struct cast <Slice> {
+        static __forceinline Slice to ( vec4f x )            { union { vec4f v; Slice t; } A; A.v = x; return A.t; }
+        static __forceinline vec4f from ( const Slice & x )  { union { vec4f v; Slice t; } A; A.t = x; return A.v; }
+    };
+
     template <typename TT>
     struct cast_fVec {
         static __forceinline TT to ( vec4f x ) {
@@ -43,7 +43,8 @@ namespace das
         tArray,
         tTable,
         tBlock,
-        tTuple
+        tTuple,
+        tSlice
     };
 
     struct StructInfo;
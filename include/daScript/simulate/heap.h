@@ -31,11 +31,19 @@ namespace das {
         }
         uint32_t buddyHighWatermark() const{return buddy.calcUsed();}
         uint32_t buddyChunksCount() const{return buddy.getChunksCount();}
+        template <typename TT>
+        void forEachChunk ( TT && closure ) const {
+            buddy.forEachChunk(closure);
+            for ( auto & it : bigAllocations ) {
+                closure(it.first, it.second);
+            }
+        }
     protected:
         BuddyAllocator          buddy;
         map<char *,uint32_t>    bigAllocations;
         uint32_t                bigAllocationThreshold = 64*1024;
         uint32_t                bytesTotal = 0;
+        bool                    zeroMemory = false;
     };
 
     class StackAllocator {
@@ -120,7 +128,8 @@ namespace das {
 
     class NodeAllocator : public HeapAllocator {
     public:
-        NodeAllocator() = default;
+        // nodes are allocated zeroed, so that the padding is the same from one simulation to another (see ContextImage)
+        NodeAllocator() { zeroMemory = true; }
 
         template<typename TT, typename... Params>
         __forceinline TT * makeNode(Params... args) {
@@ -173,6 +182,7 @@ namespace das {
             case Type::tFunction:       return makeNode<NodeType<Func>>(args...);
             case Type::tLambda:         return makeNode<NodeType<Lambda>>(args...);
             case Type::tDouble:         return makeNode<NodeType<double>>(args...);
+            case Type::tSlice:          return makeNode<NodeType<Slice>>(args...);
             default:
                 DAS_ASSERTF(0, "we should not even be here. we are calling makeValueNode on an uspported baseType."
                               "likely new by-value builtin type been added.");
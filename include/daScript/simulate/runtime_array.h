@@ -414,6 +414,242 @@ namespace das
         }
     };
 
+    // SLICE
+
+    struct SimNode_ArraySlice : SimNode {
+        SimNode_ArraySlice ( const LineInfo & at, SimNode * ll, SimNode * rr, uint32_t sz )
+            : SimNode(at), l(ll), r(rr), stride(sz) {}
+        virtual SimNode * visit ( SimVisitor & vis ) override;
+        virtual vec4f eval ( Context & context ) override;
+        SimNode * l, * r;
+        uint32_t stride;
+    };
+
+    struct SimNode_FixedArraySlice : SimNode {
+        SimNode_FixedArraySlice ( const LineInfo & at, SimNode * ll, SimNode * rr, uint32_t sz, uint32_t st )
+            : SimNode(at), l(ll), r(rr), size(sz), stride(st) {}
+        virtual SimNode * visit ( SimVisitor & vis ) override;
+        virtual vec4f eval ( Context & context ) override;
+        SimNode * l, * r;
+        uint32_t size, stride;
+    };
+
+    struct SimNode_SliceSlice : SimNode {
+        SimNode_SliceSlice ( const LineInfo & at, SimNode * ll, SimNode * rr )
+            : SimNode(at), l(ll), r(rr) {}
+        virtual SimNode * visit ( SimVisitor & vis ) override;
+        virtual vec4f eval ( Context & context ) override;
+        SimNode * l, * r;
+    };
+
+    struct SimNode_SliceAt : SimNode {
+        DAS_PTR_NODE;
+        SimNode_SliceAt ( const LineInfo & at, SimNode * ll, SimNode * rr, uint32_t o )
+            : SimNode(at), l(ll), r(rr), offset(o) {}
+        virtual SimNode * visit ( SimVisitor & vis ) override;
+        __forceinline char * compute ( Context & context ) {
+            Slice slice = cast<Slice>::to(l->eval(context));
+            uint32_t idx = cast<uint32_t>::to(r->eval(context));
+            if ( idx >= slice.size ) {
+                context.throw_error_at(debugInfo,"slice index out of range");
+                return nullptr;
+            } else {
+                return slice.data + idx*slice.stride + offset;
+            }
+        }
+        SimNode * l, * r;
+        uint32_t offset;
+    };
+
+    template <typename TT>
+    struct SimNode_SliceAtR2V : SimNode_SliceAt {
+        SimNode_SliceAtR2V ( const LineInfo & at, SimNode * rv, SimNode * idx, uint32_t o )
+            : SimNode_SliceAt(at,rv,idx,o) {}
+        SimNode * visit ( SimVisitor & vis ) override {
+            V_BEGIN();
+            V_OP_TT(SliceAtR2V);
+            V_SUB(l);
+            V_SUB(r);
+            V_ARG(offset);
+            V_END();
+        }
+        virtual vec4f eval ( Context & context ) override {
+            TT * pR = (TT *) compute(context);
+            return cast<TT>::from(*pR);
+        }
+#define EVAL_NODE(TYPE,CTYPE)                                       \
+        virtual CTYPE eval##TYPE ( Context & context ) override {   \
+            return *(CTYPE *)compute(context);                      \
+        }
+        DAS_EVAL_NODE
+#undef EVAL_NODE
+    };
+
+    struct SimNode_SliceIterator : SimNode {
+        SimNode_SliceIterator ( const LineInfo & at, SimNode * s )
+            : SimNode(at), source(s) { }
+        virtual SimNode * visit ( SimVisitor & vis ) override;
+        virtual vec4f eval ( Context & context ) override;
+        SimNode *   source;
+    };
+
+    // FOR
+    template <int totalCount>
+    struct SimNode_ForSlice : SimNode_ForBase {
+        SimNode_ForSlice ( const LineInfo & at ) : SimNode_ForBase(at) {}
+        virtual SimNode * visit ( SimVisitor & vis ) override {
+            return visitFor(vis, totalCount, "ForSlice");
+        }
+        virtual vec4f eval ( Context & context ) override {
+            char * __restrict ph[totalCount];
+            uint32_t pst[totalCount];
+            uint32_t szz = UINT_MAX;
+            for ( int t=0; t!=totalCount; ++t ) {
+                Slice slice = cast<Slice>::to(sources[t]->eval(context));
+                ph[t]  = slice.data;
+                pst[t] = slice.stride;
+                szz = das::min(szz, slice.size);
+            }
+            char ** __restrict pi[totalCount];
+            for ( int t=0; t!=totalCount; ++t ) {
+                pi[t] = (char **)(context.stack.sp() + stackTop[t]);
+            }
+            SimNode ** __restrict tail = list + total;
+            for (uint32_t i = 0; i != szz; ++i) {
+                for (int t = 0; t != totalCount; ++t) {
+                    *pi[t] = ph[t];
+                    ph[t] += pst[t];
+                }
+                for (SimNode ** __restrict body = list; body!=tail; ++body) {
+                    (*body)->eval(context);
+                    context.stopFlags &= ~EvalFlags::stopForContinue;
+                    if (context.stopFlags) goto loopend;
+                }
+            }
+        loopend:;
+            evalFinal(context);
+            context.stopFlags &= ~EvalFlags::stopForBreak;
+            return v_zero();
+        }
+    };
+
+    template <>
+    struct SimNode_ForSlice<0> : SimNode_ForBase {
+        SimNode_ForSlice ( const LineInfo & at ) : SimNode_ForBase(at) {}
+        virtual SimNode * visit ( SimVisitor & vis ) override {
+            V_BEGIN_CR();
+            V_OP(ForSlice_0);
+            V_FINAL();
+            V_END();
+        }
+        virtual vec4f eval ( Context & context ) override {
+            evalFinal(context);
+            return v_zero();
+        }
+    };
+
+    template <>
+    struct SimNode_ForSlice<1> : SimNode_ForBase {
+        SimNode_ForSlice ( const LineInfo & at ) : SimNode_ForBase(at) {}
+        virtual SimNode * visit ( SimVisitor & vis ) override {
+            return visitFor(vis, 1, "ForSlice");
+        }
+        virtual vec4f eval ( Context & context ) override {
+            Slice slice = cast<Slice>::to(sources[0]->eval(context));
+            char * __restrict ph = slice.data;
+            char ** __restrict pi = (char **)(context.stack.sp() + stackTop[0]);
+            auto stride = slice.stride;
+            SimNode ** __restrict tail = list + total;
+            for (uint32_t i = 0; i != slice.size; ++i) {
+                *pi = ph;
+                ph += stride;
+                for (SimNode ** __restrict body = list; body!=tail; ++body) {
+                    (*body)->eval(context);
+                    context.stopFlags &= ~EvalFlags::stopForContinue;
+                    if (context.stopFlags) goto loopend;
+                }
+            }
+        loopend:;
+            evalFinal(context);
+            context.stopFlags &= ~EvalFlags::stopForBreak;
+            return v_zero();
+        }
+    };
+
+    template <int totalCount>
+    struct SimNode_ForSlice1 : SimNode_ForBase {
+        SimNode_ForSlice1 ( const LineInfo & at ) : SimNode_ForBase(at) {}
+        virtual SimNode * visit ( SimVisitor & vis ) override {
+            return visitFor(vis, totalCount, "ForSlice1");
+        }
+        virtual vec4f eval ( Context & context ) override {
+            char * __restrict ph[totalCount];
+            uint32_t pst[totalCount];
+            uint32_t szz = UINT_MAX;
+            for ( int t=0; t!=totalCount; ++t ) {
+                Slice slice = cast<Slice>::to(sources[t]->eval(context));
+                ph[t]  = slice.data;
+                pst[t] = slice.stride;
+                szz = das::min(szz, slice.size);
+            }
+            char ** __restrict pi[totalCount];
+            for ( int t=0; t!=totalCount; ++t ) {
+                pi[t] = (char **)(context.stack.sp() + stackTop[t]);
+            }
+            SimNode * __restrict body = list[0];
+            for (uint32_t i = 0; i != szz && !context.stopFlags; ++i) {
+                for (int t = 0; t != totalCount; ++t) {
+                    *pi[t] = ph[t];
+                    ph[t] += pst[t];
+                }
+                body->eval(context);
+                context.stopFlags &= ~EvalFlags::stopForContinue;
+            }
+            evalFinal(context);
+            context.stopFlags &= ~EvalFlags::stopForBreak;
+            return v_zero();
+        }
+    };
+
+    template <>
+    struct SimNode_ForSlice1<0> : SimNode_ForBase {
+        SimNode_ForSlice1 ( const LineInfo & at ) : SimNode_ForBase(at) {}
+        virtual SimNode * visit ( SimVisitor & vis ) override {
+            V_BEGIN_CR();
+            V_OP(ForSlice1_0);
+            V_FINAL();
+            V_END();
+        }
+        virtual vec4f eval ( Context & context ) override {
+            evalFinal(context);
+            return v_zero();
+        }
+    };
+
+    template <>
+    struct SimNode_ForSlice1<1> : SimNode_ForBase {
+        SimNode_ForSlice1 ( const LineInfo & at ) : SimNode_ForBase(at) {}
+        virtual SimNode * visit ( SimVisitor & vis ) override {
+            return visitFor(vis, 1, "ForSlice1");
+        }
+        virtual vec4f eval ( Context & context ) override {
+            Slice slice = cast<Slice>::to(sources[0]->eval(context));
+            char * __restrict ph = slice.data;
+            char ** __restrict pi = (char **)(context.stack.sp() + stackTop[0]);
+            auto stride = slice.stride;
+            SimNode * __restrict body = list[0];
+            for (uint32_t i = 0; i != slice.size && !context.stopFlags; ++i) {
+                *pi = ph;
+                ph += stride;
+                body->eval(context);
+                context.stopFlags &= ~EvalFlags::stopForContinue;
+            }
+            evalFinal(context);
+            context.stopFlags &= ~EvalFlags::stopForBreak;
+            return v_zero();
+        }
+    };
+
     struct SimNode_DeleteArray : SimNode_Delete {
         SimNode_DeleteArray ( const LineInfo & a, SimNode * s, uint32_t t, uint32_t st )
             : SimNode_Delete(a,s,t), stride(st) {}
@@ -6,5 +6,10 @@ namespace das
 {
     // profile(count,category,block) -> float time in sec
     float builtin_profile ( int32_t count, const char * category, const Block & block, Context * context );
+
+    // function profile dump is text, one function per line: calls, inclusive time in usec, and mangled name
+    //  lines, which start with //, are comments
+    void writeFunctionProfile ( TextWriter & tw, const vector<FunctionProfile> & profile );
+    bool readFunctionProfile ( const string & text, vector<FunctionProfile> & profile );
 }
 
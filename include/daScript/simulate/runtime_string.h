@@ -6,12 +6,15 @@
 namespace das
 {
     class Context;
+    struct TypeInfo;
 
     string unescapeString ( const string & input, bool * error );
     string escapeString ( const string & input );
     string to_string_ex ( double dnum );
     string to_string_ex ( float dnum );
     string reportError ( const struct LineInfo & li, const string & message, CompilationError erc = CompilationError::unspecified );
+    // string builder for arguments which are all scalars or strings (see ExprStringBuilder::isScalar)
+    char * string_builder_scalar ( Context & context, const vec4f * args, TypeInfo ** types, int nArgs );
     string reportError ( const char * st, const char * fileName, int row, int col, const string & message, CompilationError erc = CompilationError::unspecified );
 }
 
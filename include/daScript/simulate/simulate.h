@@ -59,6 +59,15 @@ namespace das
         };
     };
 
+    // call counter and inclusive time of the function
+    struct FunctionProfile {
+        string      mangledName;
+        uint64_t    calls = 0;
+        uint64_t    usec = 0;
+    };
+
+    struct SimNode_ProfileFunction;
+
     struct SimNode {
         SimNode ( const LineInfo & at ) : debugInfo(at) {}
         virtual vec4f eval ( Context & ) = 0;
@@ -133,6 +142,7 @@ namespace das
         friend struct SimNode_GetGlobal;
         friend struct SimNode_TryCatch;
         friend class Program;
+        friend class ContextImage;
     public:
         Context();
         Context(const Context &);
@@ -395,6 +405,14 @@ namespace das
             return exception;
         }
 
+        // per function call counters and inclusive time. while enabled, code of each function is wrapped
+        //  time is measured on one of each sampleEvery outermost calls. recursive calls are counted, but not timed
+        //  code is shared between the copies of the context, so are the counters
+        void profileFunctions ( bool enable, uint32_t sampleEvery = 1 );
+        bool profilingFunctions() const { return !profiledFunctions.empty(); }
+        void resetFunctionProfile();
+        void getFunctionProfile ( vector<FunctionProfile> & profile ) const;
+
     public:
         uint64_t *                      annotationData = nullptr;
         HeapAllocator                   heap;
@@ -403,6 +421,7 @@ namespace das
         shared_ptr<DebugInfoAllocator>  debugInfo;
         StackAllocator                  stack;
         uint32_t                        insideContext = 0;
+        vector<int32_t>                 functionsPerTier;   // while TieredExecution runs the context, empty otherwise
     public:
         vec4f *         abiThisBlockArg;
         vec4f *         abiArg;
@@ -421,6 +440,7 @@ namespace das
         int totalVariables = 0;
         int totalFunctions = 0;
         SimNode * aotInitScript = nullptr;
+        vector<SimNode_ProfileFunction *> profiledFunctions;
     public:
         uint32_t *  tabMnLookup = nullptr;
         uint32_t    tabMnMask = 0;
@@ -492,6 +512,17 @@ namespace das
     template <>
     struct EvalTT<bool> { static __forceinline bool eval ( Context & context, SimNode * node ) {
         return node->evalBool(context); }};
+    template <>
+    struct EvalTT<char *> { static __forceinline char * eval ( Context & context, SimNode * node ) {
+        return node->evalPtr(context); }};
+
+    // result of the call, as the type it was returned with
+    template <typename TT>
+    struct AbiResult { static __forceinline TT get ( Context & context ) {
+        return *(TT *)&context.abiResult(); }};
+    template <>
+    struct AbiResult<bool> { static __forceinline bool get ( Context & context ) {
+        return cast<bool>::to(context.abiResult()); }};
 
     // FUNCTION CALL
     struct SimNode_CallBase : SimNode {
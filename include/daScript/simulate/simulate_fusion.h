@@ -38,6 +38,9 @@ namespace das {
     void resetFusionEngine();
     void createFusionEngine();
 
+    // fuses code of one function, until there is nothing left to fuse. returns true if anything was fused
+    bool fusion ( Context & context, SimFunction * fn, TextWriter & logs );
+
     // fusion engine subsections
     // misc (note, misc before everything)
     void createFusionEngine_misc_copy_reference();
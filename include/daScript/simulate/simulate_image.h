@@ -0,0 +1,34 @@
+#pragma once
+
+#include "daScript/simulate/simulate.h"
+
+namespace das {
+
+    class Module;
+    struct Annotation;
+
+    // relocatable snapshot of the simulated context
+    //  code and debug info arenas are stored as is, pointers between them are stored as offsets and patched on load
+    //  pointers into the executable (node vtables, functions, literals) are stored relative to its base,
+    //  so the image can only be instantiated by the exact same executable which produced it
+    //  file infos, modules and type annotations are stored by name
+    class ContextImage {
+    public:
+        struct Symbols {
+            vector<Module *>        modules;
+            vector<Annotation *>    annotations;
+        };
+    public:
+        // a and b are two separate simulations of the same program
+        bool build ( Context & a, Context & b, const Symbols & symbols, TextWriter & logs );
+        // replaces code and debug info of the freshly created context with the one from the image, then runs init script
+        bool instantiate ( Context & context, TextWriter & logs ) const;
+        bool save ( const string & fileName ) const;
+        bool load ( const string & fileName );
+        uint32_t size() const { return uint32_t(data.size()); }
+        bool empty() const { return data.empty(); }
+    protected:
+        vector<uint8_t> data;
+    };
+}
+
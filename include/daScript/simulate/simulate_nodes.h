@@ -3,6 +3,7 @@
 #include "simulate.h"
 
 #include "daScript/simulate/simulate_visit_op.h"
+#include "daScript/misc/string_convert.h"
 
 namespace das {
 
@@ -335,6 +336,65 @@ SIM_NODE_AT_VECTOR(Float, float)
 #undef  EVAL_NODE
     };
 
+    // FUNCTION CALL, where all the arguments are int, float, or pointer
+    //  arguments are evaluated via typed eval, and stored into the argument block as is.
+    //  typed eval of the result reads it from the abiResult, so the value does not go through vec4f
+    template <int argCount, typename ArgT>
+    struct SimNode_CallScalar : SimNode_CallBase {
+        SimNode_CallScalar ( const LineInfo & at ) : SimNode_CallBase(at) {}
+        virtual SimNode * visit ( SimVisitor & vis ) override;
+        __forceinline void evalScalarArgs ( Context & context, vec4f * argValues ) {
+                                    *(ArgT *)(argValues+0) = EvalTT<ArgT>::eval(context, arguments[0]);
+            for ( int i=1; i!=argCount && !context.stopFlags; ++i ) {
+                *(ArgT *)(argValues+i) = EvalTT<ArgT>::eval(context, arguments[i]);
+            }
+        }
+        virtual vec4f eval ( Context & context ) override {
+            vec4f argValues[argCount];
+            evalScalarArgs(context, argValues);
+            return context.call(fnPtr, argValues, debugInfo.line);
+        }
+#define EVAL_NODE(TYPE,CTYPE)\
+        virtual CTYPE eval##TYPE ( Context & context ) override {                               \
+                vec4f argValues[argCount];                                                      \
+                evalScalarArgs(context, argValues);                                             \
+                context.call(fnPtr, argValues, debugInfo.line);                                 \
+                return AbiResult<CTYPE>::get(context);                                          \
+        }
+        DAS_EVAL_NODE
+#undef  EVAL_NODE
+    };
+
+    // FAST CALL, where all the arguments are int, float, or pointer
+    template <int argCount, typename ArgT>
+    struct SimNode_FastCallScalar : SimNode_CallScalar<argCount,ArgT> {
+        SimNode_FastCallScalar ( const LineInfo & at ) : SimNode_CallScalar<argCount,ArgT>(at) {}
+        virtual SimNode * visit ( SimVisitor & vis ) override;
+        virtual vec4f eval ( Context & context ) override {
+            vec4f argValues[argCount];
+            this->evalScalarArgs(context, argValues);
+            auto aa = context.abiArg;
+            context.abiArg = argValues;
+            auto res = this->fnPtr->code->eval(context);
+            context.stopFlags &= ~(EvalFlags::stopForReturn | EvalFlags::stopForBreak | EvalFlags::stopForContinue);
+            context.abiArg = aa;
+            return res;
+        }
+#define EVAL_NODE(TYPE,CTYPE)\
+        virtual CTYPE eval##TYPE ( Context & context ) override {                               \
+                vec4f argValues[argCount];                                                      \
+                this->evalScalarArgs(context, argValues);                                       \
+                auto aa = context.abiArg;                                                       \
+                context.abiArg = argValues;                                                     \
+                auto res = EvalTT<CTYPE>::eval(context, this->fnPtr->code);                     \
+                context.stopFlags &= ~(EvalFlags::stopForReturn | EvalFlags::stopForBreak | EvalFlags::stopForContinue); \
+                context.abiArg = aa;                                                            \
+                return res;                                                                     \
+        }
+        DAS_EVAL_NODE
+#undef  EVAL_NODE
+    };
+
     // FUNCTION CALL with copy-or-move-on-return
     template <int argCount>
     struct SimNode_CallAndCopyOrMove : SimNode_CallBase {
@@ -545,6 +605,13 @@ SIM_NODE_AT_VECTOR(Float, float)
         virtual vec4f eval ( Context & context ) override;
     };
 
+    // StringBuilder, where all arguments are scalars or strings
+    struct SimNode_StringBuilderScalar : SimNode_StringBuilder {
+        SimNode_StringBuilderScalar ( const LineInfo & at ) : SimNode_StringBuilder(at) {}
+        virtual SimNode * visit ( SimVisitor & vis ) override;
+        virtual vec4f eval ( Context & context ) override;
+    };
+
     // CAST
     template <typename CastTo, typename CastFrom>
     struct SimNode_Cast : SimNode_CallBase {
@@ -564,8 +631,9 @@ SIM_NODE_AT_VECTOR(Float, float)
         virtual SimNode * visit ( SimVisitor & vis ) override;
         virtual vec4f eval ( Context & context ) override {
             vec4f res = arguments[0]->eval(context);
-            auto str = to_string ( cast<CastFrom>::to(res) );
-            auto cpy = context.heap.allocateString(str);
+            char buf[DAS_NUMBER_BUFFER_SIZE];
+            int len = fmt_number(buf, cast<CastFrom>::to(res));
+            auto cpy = context.heap.allocateString(buf, uint32_t(len));
             if ( !cpy ) {
                 context.throw_error_at(debugInfo,"can't cast to string, out of heap");
                 return v_zero();
@@ -984,6 +1052,19 @@ SIM_NODE_AT_VECTOR(Float, float)
         SimNode * subexpr;
     };
 
+    // return of the int, float, or pointer, which is stored into the abiResult as is
+    template <typename TT>
+    struct SimNode_ReturnScalar : SimNode_Return {
+        SimNode_ReturnScalar ( const LineInfo & at, SimNode * s )
+            : SimNode_Return(at,s) {}
+        virtual SimNode * visit ( SimVisitor & vis ) override;
+        virtual vec4f eval ( Context & context ) override {
+            *(TT *)&context.abiResult() = EvalTT<TT>::eval(context, subexpr);
+            context.stopFlags |= EvalFlags::stopForReturn;
+            return v_zero();
+        }
+    };
+
     struct SimNode_ReturnConst : SimNode {
         SimNode_ReturnConst ( const LineInfo & at, vec4f v )
             : SimNode(at), value(v) {}
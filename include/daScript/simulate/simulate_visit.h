@@ -50,6 +50,30 @@ namespace das {
         V_END();
     }
 
+    template <int argCount, typename ArgT>
+    SimNode * SimNode_CallScalar<argCount,ArgT>::visit ( SimVisitor & vis ) {
+        V_BEGIN();
+        vis.op("CallScalar", sizeof(ArgT), typeName<ArgT>::name());
+        V_CALL();
+        V_END();
+    }
+
+    template <int argCount, typename ArgT>
+    SimNode * SimNode_FastCallScalar<argCount,ArgT>::visit ( SimVisitor & vis ) {
+        V_BEGIN();
+        vis.op("FastCallScalar", sizeof(ArgT), typeName<ArgT>::name());
+        this->visitCall(vis);
+        V_END();
+    }
+
+    template <typename TT>
+    SimNode * SimNode_ReturnScalar<TT>::visit ( SimVisitor & vis ) {
+        V_BEGIN();
+        V_OP_TT(ReturnScalar);
+        V_SUB(subexpr);
+        V_END();
+    }
+
     template <int argCount>
     SimNode * SimNode_CallAndCopyOrMove<argCount>::visit ( SimVisitor & vis ) {
         V_BEGIN();
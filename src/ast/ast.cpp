@@ -3,6 +3,10 @@
 #include "daScript/ast/ast.h"
 #include "daScript/ast/ast_visitor.h"
 
+extern void * os_load_shared_library ( const char * fileName );
+extern void os_unload_shared_library ( void * handle );
+extern const char * os_shared_library_error ();
+
 namespace das {
 
     // AOT
@@ -14,6 +18,16 @@ namespace das {
         head = this;
     }
 
+    // lists of the unloaded shared objects leave
+    AotListBase::~AotListBase() {
+        for ( auto it = &head; *it; it = &(*it)->tail ) {
+            if ( *it==this ) {
+                *it = tail;
+                break;
+            }
+        }
+    }
+
     void AotListBase::registerAot ( AotLibrary & lib ) {
         auto it = head;
         while ( it ) {
@@ -22,6 +36,38 @@ namespace das {
         }
     }
 
+    bool AotSharedLibrary::load ( const string & fileName, AotLibrary & lib, TextWriter & logs ) {
+        if ( handle ) {
+            logs << "AOT library is already loaded\n";
+            return false;
+        }
+        // static AOT lists of the shared object go to the head of the list
+        auto before = AotListBase::head;
+        handle = os_load_shared_library(fileName.c_str());
+        if ( !handle ) {
+            logs << "can't load AOT library " << fileName << ", " << os_shared_library_error() << "\n";
+            return false;
+        }
+        int count = 0;
+        for ( auto it = AotListBase::head; it && it!=before; it = it->tail ) {
+            it->registerAotFunctions(lib);
+            count ++;
+        }
+        if ( !count ) {
+            logs << fileName << " has no AOT functions, or they are not registered with this executable\n";
+            unload();
+            return false;
+        }
+        return true;
+    }
+
+    void AotSharedLibrary::unload() {
+        if ( handle ) {
+            os_unload_shared_library(handle);
+            handle = nullptr;
+        }
+    }
+
     // annotations
 
     string Annotation::getMangledName() const {
@@ -535,6 +581,14 @@ namespace das {
         return cexpr;
     }
 
+    // ExprIterAdapter
+
+    ExpressionPtr ExprIterAdapter::clone( const ExpressionPtr & expr ) const {
+        auto cexpr = clonePtr<ExprIterAdapter>(expr);
+        ExprLooksLikeCall::clone(cexpr);
+        return cexpr;
+    }
+
     // ExprMakeLambda
 
     ExprMakeLambda::ExprMakeLambda ( const LineInfo & a, const ExpressionPtr & b )
@@ -868,6 +922,7 @@ namespace das {
         auto cexpr = clonePtr<ExprSwizzle>(expr);
         Expression::clone(cexpr);
         cexpr->mask = mask;
+        cexpr->fields = fields;
         cexpr->value = value->clone();
         return cexpr;
     }
@@ -887,6 +942,7 @@ namespace das {
         cexpr->value = value->clone();
         cexpr->field = field;
         cexpr->tupleIndex = tupleIndex;
+        cexpr->annotation = annotation;
         return cexpr;
     }
 
@@ -927,6 +983,25 @@ namespace das {
         return vis.visit(this);
     }
 
+    // all elements are strings or scalars, which string_builder_scalar can format
+    bool ExprStringBuilder::isScalar() const {
+        for ( auto & elem : elements ) {
+            auto & elemT = elem->type;
+            if ( !elemT || elemT->dim.size() ) return false;
+            switch ( elemT->baseType ) {
+                case Type::tString:
+                case Type::tBool:
+                case Type::tInt8:   case Type::tInt16:  case Type::tInt:    case Type::tInt64:
+                case Type::tUInt8:  case Type::tUInt16: case Type::tUInt:   case Type::tUInt64:
+                case Type::tFloat:  case Type::tDouble:
+                    break;
+                default:
+                    return false;
+            }
+        }
+        return true;
+    }
+
     ExpressionPtr ExprStringBuilder::clone( const ExpressionPtr & expr  ) const {
         auto cexpr = clonePtr<ExprStringBuilder>(expr);
         Expression::clone(cexpr);
@@ -965,9 +1040,9 @@ namespace das {
             return nullptr;
         }
         auto cexpr = static_pointer_cast<ExprOp>(expr);
+        Expression::clone(cexpr);
         cexpr->op = op;
         cexpr->func = func;
-        cexpr->at = at;
         return cexpr;
     }
 
@@ -1793,6 +1868,26 @@ namespace das {
         // real things
         vis.preVisitProgramBody(this);
         // globals
+        visitGlobals(vis);
+        // generics
+        if ( visitGenerics ) {
+            for ( auto & fn : thisModule->generics ) {
+                if ( !fn.second->builtIn ) {
+                    fn.second = fn.second->visit(vis);
+                }
+            }
+        }
+        // functions
+        for ( auto & fn : thisModule->functions ) {
+            if ( !fn.second->builtIn ) {
+                if ( vis.canVisitFunction(fn.second.get()) ) {
+                    fn.second = fn.second->visit(vis);
+                }
+            }
+        }
+    }
+
+    void Program::visitGlobals(Visitor & vis) {
         vis.preVisitGlobalLetBody(this);
         for ( auto & it : thisModule->globals ) {
             auto & var = it.second;
@@ -1810,46 +1905,116 @@ namespace das {
             var = vis.visitGlobalLet(var);
         }
         vis.visitGlobalLetBody(this);
-        // generics
-        if ( visitGenerics ) {
-            for ( auto & fn : thisModule->generics ) {
-                if ( !fn.second->builtIn ) {
-                    fn.second = fn.second->visit(vis);
-                }
+    }
+
+    extern "C" int64_t ref_time_ticks ();
+    extern "C" int get_time_usec (int64_t reft);
+
+    // side effects and global variable access, which optimizations of the round relied on
+    struct OptimizationFlags {
+        map<Function *,uint32_t>    sideEffects;
+        map<Variable *,uint32_t>    globalAccess;
+    };
+
+    static void collectOptimizationFlags ( Module * thisModule, OptimizationFlags & flags ) {
+        flags.sideEffects.clear();
+        flags.globalAccess.clear();
+        for ( auto & it : thisModule->functions ) {
+            flags.sideEffects[it.second.get()] = it.second->sideEffectFlags;
+        }
+        for ( auto & it : thisModule->globals ) {
+            flags.globalAccess[it.second.get()] = it.second->access_flags;
+        }
+    }
+
+    // functions, which need to be optimized again after the round.
+    //  these are the ones which changed or changed side effects, and the ones which call them or use globals with changed access
+    static void nextOptimizationWorklist ( Module * thisModule, OptimizationWorklist & work, const OptimizationFlags & flags ) {
+        set<Variable *> changedGlobals;
+        for ( auto & it : thisModule->globals ) {
+            auto itF = flags.globalAccess.find(it.second.get());
+            if ( itF==flags.globalAccess.end() || itF->second!=it.second->access_flags ) {
+                changedGlobals.insert(it.second.get());
             }
         }
-        // functions
-        for ( auto & fn : thisModule->functions ) {
-            if ( !fn.second->builtIn ) {
-                if ( vis.canVisitFunction(fn.second.get()) ) {
-                    fn.second = fn.second->visit(vis);
+        for ( auto & it : thisModule->functions ) {
+            auto itF = flags.sideEffects.find(it.second.get());
+            if ( itF==flags.sideEffects.end() || itF->second!=it.second->sideEffectFlags ) {
+                work.changed.insert(it.second.get());
+            }
+        }
+        work.all = work.changedOutside;
+        work.functions.clear();
+        if ( !work.all ) {
+            for ( auto & it : thisModule->functions ) {
+                auto fn = it.second.get();
+                bool dirty = work.changed.count(fn) != 0;
+                for ( auto dep = fn->useFunctions.begin(); !dirty && dep != fn->useFunctions.end(); ++dep ) {
+                    dirty = work.changed.count(*dep) != 0;
+                }
+                for ( auto gv = fn->useGlobalVariables.begin(); !dirty && gv != fn->useGlobalVariables.end(); ++gv ) {
+                    dirty = changedGlobals.count(*gv) != 0;
+                }
+                if ( dirty ) {
+                    work.functions.insert(fn);
                 }
             }
         }
+        work.changed.clear();
+        work.changedOutside = false;
     }
 
     void Program::optimize(TextWriter & logs) {
         const bool log = options.getOption("logOptimizationPasses",false);
+        const bool logTime = options.getOption("logOptimizationTime",false);
         bool any, last;
         if (log) {
             logs << *this << "\n";
         }
+        // small functions are inlined before anything else, so that the passes below fold them into the callers
+        if ( options.getOption("inline",true) ) {
+            inlineFunctions(logs);
+        }
+        // first round optimizes everything, next ones only what was affected by the previous round
+        OptimizationWorklist work;
+        OptimizationFlags flags;
+        int round = 0;
+        int passTime[6] = {};
+        auto totalTime0 = ref_time_ticks();
+        int64_t time0 = 0;
+        #define TIME_PASS(index,pass) \
+            time0 = ref_time_ticks(); last = pass; passTime[index] += get_time_usec(time0);
         do {
             if ( log ) logs << "OPTIMIZE:\n" << *this;
+            if ( logTime ) {
+                logs << "optimization round " << round << ": "
+                    << (work.all ? int(thisModule->functions.size()) : int(work.functions.size())) << " functions\n";
+            }
             any = false;
-            last = optimizationRefFolding();    if ( failed() ) break;  any |= last;
+            TIME_PASS(0, optimizationRefFolding(&work));    if ( failed() ) break;  any |= last;
             if ( log ) logs << "REF FOLDING: " << (last ? "optimized" : "nothing") << "\n" << *this;
-            last = optimizationUnused(logs);    if ( failed() ) break;  any |= last;
+            TIME_PASS(1, optimizationUnused(logs, &work));  if ( failed() ) break;  any |= last;
+            collectOptimizationFlags(thisModule.get(), flags);
             if ( log ) logs << "REMOVE UNUSED:" << (last ? "optimized" : "nothing") << "\n" << *this;
-            last = optimizationConstFolding();  if ( failed() ) break;  any |= last;
+            TIME_PASS(2, optimizationConstFolding(&work));  if ( failed() ) break;  any |= last;
             if ( log ) logs << "CONST FOLDING:" << (last ? "optimized" : "nothing") << "\n" << *this;
-            last = optimizationCondFolding();  if ( failed() ) break;  any |= last;
+            TIME_PASS(3, optimizationCondFolding(&work));   if ( failed() ) break;  any |= last;
             if ( log ) logs << "COND FOLDING:" << (last ? "optimized" : "nothing") << "\n" << *this;
-            last = optimizationBlockFolding();  if ( failed() ) break;  any |= last;
+            TIME_PASS(4, optimizationBlockFolding(&work));  if ( failed() ) break;  any |= last;
             if ( log ) logs << "BLOCK FOLDING:" << (last ? "optimized" : "nothing") << "\n" << *this;
             // this is here again for a reason
-            last = optimizationUnused(logs);    if ( failed() ) break;  any |= last;
+            TIME_PASS(5, optimizationUnused(logs, &work));  if ( failed() ) break;  any |= last;
             if ( log ) logs << "REMOVE UNUSED:" << (last ? "optimized" : "nothing") << "\n" << *this;
+            nextOptimizationWorklist(thisModule.get(), work, flags);
+            round ++;
         } while ( any );
+        #undef TIME_PASS
+        if ( logTime ) {
+            const char * passNames[6] = { "ref folding", "remove unused", "const folding", "cond folding", "block folding", "remove unused again" };
+            for ( int i=0; i!=6; ++i ) {
+                logs << "\t" << passNames[i] << " took " << (passTime[i] / 1000000.) << "\n";
+            }
+            logs << "optimization took " << (get_time_usec(totalTime0) / 1000000.) << ", " << round << " rounds\n";
+        }
     }
 }
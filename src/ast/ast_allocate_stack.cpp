@@ -454,7 +454,11 @@ namespace das {
         // allocate stack for the rest of them
         AllocateStack context(shared_from_this(), logs);
         visit(context);
-        // allocate used variables and functions indices
+        allocateIndices(logs);
+    }
+
+    // allocate used variables and functions indices
+    void Program::allocateIndices(TextWriter & logs) {
         totalVariables = 0;
         totalFunctions = 0;
         auto log = options.getOption("logStack");
@@ -47,6 +47,7 @@ namespace das {
         {   Type::tFunction,    "tFunction"},
         {   Type::tLambda,      "tLambda"},
         {   Type::tTuple,       "tTuple"},
+        {   Type::tSlice,       "tSlice"},
         {   Type::tHandle,      "tHandle"}
     };
 
@@ -163,6 +164,12 @@ namespace das {
             } else {
                 stream << "Array";
             }
+        } else if ( baseType==Type::tSlice ) {
+            if ( type->firstType ) {
+                stream << "TSlice<" << describeCppType(type->firstType) << ">";
+            } else {
+                stream << "Slice";
+            }
         } else if ( baseType==Type::tTable ) {
             if ( type->firstType && type->secondType ) {
                 stream << "TTable<" << describeCppType(type->firstType) << "," << describeCppType(type->secondType) << ">";
@@ -248,20 +255,53 @@ namespace das {
         return stream.str();
     }
 
+    // collects direct calls to the AOT functions of this module, and of the modules which are generated with it
+    class AotCallCollector : public Visitor {
+    public:
+        AotCallCollector( Module * m, const vector<Module *> & mods ) : thisModule(m), modules(mods) {}
+        vector<Function *>  calls;
+    protected:
+        Module * thisModule;
+        const vector<Module *> & modules;
+    protected:
+        virtual void preVisit ( ExprCall * call ) override {
+            Visitor::preVisit(call);
+            auto fn = call->func;
+            if ( fn && !fn->builtIn && !fn->noAot && !fn->aotHybrid
+                    && (fn->module==thisModule || find(modules.begin(), modules.end(), fn->module)!=modules.end()) ) {
+                if ( find(calls.begin(), calls.end(), fn)==calls.end() ) {
+                    calls.push_back(fn);
+                }
+            }
+        }
+    };
+
     class NoAotMarker : public Visitor {
     public:
-        NoAotMarker() {}
+        NoAotMarker( map<Function *,string> & r ) : reasons(r) {}
     protected:
         Function * func = nullptr;
+        map<Function *,string> & reasons;
     protected:
+        void markNoAot ( TypeDecl * type ) {
+            if ( func && !type->canAot() ) {
+                func->noAot = true;
+                if ( reasons.find(func)==reasons.end() ) {
+                    reasons[func] = "type " + type->describe() + " can't be AOT";
+                }
+            }
+        }
         // type
         virtual void preVisit ( TypeDecl * type ) override {
-            if ( func && !type->canAot() ) func->noAot = true;
+            markNoAot(type);
         }
         // function
         virtual void preVisit ( Function * f ) override {
             func = f;
             Visitor::preVisit(f);
+            if ( f->noAot && !f->builtIn && reasons.find(f)==reasons.end() ) {
+                reasons[f] = "marked [noaot]";
+            }
         }
         virtual FunctionPtr visit ( Function * that ) override {
             auto res = Visitor::visit(that);
@@ -271,7 +311,7 @@ namespace das {
         // any expression
         virtual void preVisitExpression ( Expression * expr ) override {
             Visitor::preVisitExpression(expr);
-            if ( func && expr->type && !expr->type->canAot() ) func->noAot = true;
+            if ( expr->type ) markNoAot(expr->type.get());
         }
         // looks like call
         virtual void preVisit ( ExprLooksLikeCall * call ) override {
@@ -570,6 +610,15 @@ namespace das {
         }
     }
 
+    // functions of the other modules, which are generated with the program, are in the namespace of the module
+    string aotFuncQualifiedName ( Function * func, Module * thisModule ) {
+        if ( func->module && func->module!=thisModule ) {
+            return aotModuleName(func->module) + "::" + aotFuncName(func);
+        } else {
+            return aotFuncName(func);
+        }
+    }
+
     class BlockVariableCollector : public Visitor {
     public:
         BlockVariableCollector() {}
@@ -712,12 +761,17 @@ namespace das {
 
     class CppAot : public Visitor {
     public:
-        CppAot ( const ProgramPtr & prog, BlockVariableCollector & cl ) : program(prog), collector(cl) {
+        CppAot ( const ProgramPtr & prog, const AotCppPrepared & prep, bool sh = false )
+            : program(prog), collector(*prep.collector), directModules(prep.modules), sharded(sh) {
             helper.rtti = program->options.getOption("rtti",false);
         }
         string str() const {
-            return "\n" + helper.str() + sti.str()  + stg.str() + ss.str();
+            return "\n" + debugInfoStr() + ss.str();
         };
+        string debugInfoStr() const {
+            return helper.str() + sti.str()  + stg.str();
+        }
+        bool isSharded() const { return sharded; }
     public:
         TextWriter                  ss, sti, stg;
     protected:
@@ -727,6 +781,8 @@ namespace das {
         AotDebugInfoHelper          helper;
         ProgramPtr                  program;
         BlockVariableCollector &    collector;
+        vector<Module *>            directModules;      // calls to the functions of these modules are direct
+        bool                        sharded = false;    // functions are not inline, they are called from other files
         set<string>                 aotPrefix;
     protected:
         void newLine () {
@@ -790,7 +846,7 @@ namespace das {
             for ( auto & fnI : prog->thisModule->functions ) {
                 auto & fn = fnI.second;
                 if ( !fn->builtIn && !fn->noAot ) {
-                    ss << describeCppFunc(fn.get(),&collector) << ";\n";
+                    ss << describeCppFunc(fn.get(),&collector,true,!sharded) << ";\n";
                 }
             }
             ss << "\n";
@@ -846,7 +902,7 @@ namespace das {
         }
         virtual void preVisit ( Function * fn) override {
             Visitor::preVisit(fn);
-            ss << "\ninline ";
+            ss << (sharded ? "\n" : "\ninline ");
             describeLocalCppType(ss,fn->result,CpptSubstitureRef::no);
             ss << " " << aotFuncName(fn) << " ( Context * __context__";
         }
@@ -897,19 +953,23 @@ namespace das {
             block->finallyDisabled = block->inTheLoop;
             ss << "{\n";
             tab ++;
-            // pre-declare variables
-            auto & vars = collector.variables[block];
-            for ( auto & var : vars ) {
-                ss << string(tab,'\t');
-                describeVarLocalCppType(ss, var->type);
-                ss << " " << collector.getVarName(var) << ";\n";
+            // pre-declare variables. collector is only read, it can be shared between the shards
+            auto itv = collector.variables.find(block);
+            if ( itv != collector.variables.end() ) {
+                for ( auto & var : itv->second ) {
+                    ss << string(tab,'\t');
+                    describeVarLocalCppType(ss, var->type);
+                    ss << " " << collector.getVarName(var) << ";\n";
+                }
             }
             // pre-declare locals
-            auto & temps = collector.localTemps[block];
-            for ( auto & tmp : temps ) {
-                ss << string(tab,'\t');
-                describeVarLocalCppType(ss, tmp->type);
-                ss << " " << makeLocalTempName(tmp) << ";\n";
+            auto itt = collector.localTemps.find(block);
+            if ( itt != collector.localTemps.end() ) {
+                for ( auto & tmp : itt->second ) {
+                    ss << string(tab,'\t');
+                    describeVarLocalCppType(ss, tmp->type);
+                    ss << " " << makeLocalTempName(tmp) << ";\n";
+                }
             }
         }
         virtual void preVisitBlockArgumentInit ( ExprBlock * block, const VariablePtr & var, Expression * init ) override {
@@ -1586,7 +1646,8 @@ namespace das {
         virtual void preVisit ( ExprStringBuilder * expr ) override {
             Visitor::preVisit(expr);
             uint32_t nArgs = uint32_t(expr->elements.size());
-            ss << "das_string_builder(__context__,SimNode_AotInterop<" << nArgs << ">(";
+            ss << (expr->isScalar() ? "das_string_builder_scalar" : "das_string_builder")
+                << "(__context__,SimNode_AotInterop<" << nArgs << ">(";
             if ( nArgs ) {
                 auto debug_info_name = outputCallTypeInfo(nArgs, expr->elements);
                 ss << debug_info_name << ", ";
@@ -2051,6 +2112,7 @@ namespace das {
             if ( func->noAot ) return true;
             if ( func->aotHybrid ) return true;
             if ( func->module == program->thisModule.get() ) return false;
+            if ( find(directModules.begin(), directModules.end(), func->module)!=directModules.end() ) return false;
             return true;
         }
         bool needsArgPass ( const TypeDeclPtr & argType ) const {
@@ -2132,7 +2194,7 @@ namespace das {
                         ss << "Func(__context__->fnIdxByMangledName(/*" << mangledName << "*/ " << hash << "u))";
                     }
                 } else {
-                    ss << aotFuncName(call->func) << "(__context__";
+                    ss << aotFuncQualifiedName(call->func, program->thisModule.get()) << "(__context__";
                     if  ( call->arguments.size() ) ss << ",";
                 }
             }
@@ -2305,7 +2367,71 @@ namespace das {
         return hash;
     }
 
-    void Program::registerAotCpp ( TextWriter & logs, Context & context, bool headers ) {
+    static void registerAotCppFunction ( TextWriter & logs, Function * fn, Module * thisModule ) {
+        uint64_t semH = fn->hash;
+        logs << "\t\t// " << aotFuncQualifiedName(fn, thisModule) << "\n";
+        logs << "\t\taotLib[0x" << HEX << semH << DEC << "] = [&](Context & ctx){\n\t\treturn ";
+        logs << "ctx.code->makeNode<SimNode_Aot";
+        if ( fn->copyOnReturn || fn->moveOnReturn ) {
+            logs << "CMRES";
+        }
+        logs << "<" << describeCppFunc(fn,nullptr,false,false) << ",";
+        logs << "&" << aotFuncQualifiedName(fn, thisModule) << ">>();\n\t};\n";
+    }
+
+    // direct calls to the other modules are checked at link time
+    static void registerAotCppDependencies ( TextWriter & logs, Function * fn, const AotCppPrepared & prepared ) {
+        auto it = prepared.calls.find(fn);
+        if ( it==prepared.calls.end() ) return;
+        TextWriter deps;
+        for ( auto cfn : it->second ) {
+            if ( cfn->module!=fn->module ) {
+                auto mangledName = cfn->getMangledName();
+                uint32_t hash = hash_blockz32((uint8_t *)mangledName.c_str());
+                deps << "\t\t\t{ /*" << mangledName << "*/ " << hash << "u, 0x" << HEX << cfn->hash << DEC << " },\n";
+            }
+        }
+        if ( !deps.str().empty() ) {
+            logs << "\t\taotLib.dependencies[0x" << HEX << fn->hash << DEC << "] = {\n" << deps.str() << "\t\t};\n";
+        }
+    }
+
+    void Program::registerAotCppFunctions ( TextWriter & logs, const vector<Function *> & functions ) {
+        for ( auto fn : functions ) {
+            registerAotCppFunction(logs, fn, thisModule.get());
+        }
+    }
+
+    void Program::aotCppReport ( const AotCppPreparedPtr & prepared, TextWriter & logs ) {
+        int total = 0;
+        auto report = [&]( Function * fn, const string & reason ) {
+            logs << fn->at.describe() << ": " << fn->getMangledName() << ", " << reason << "\n";
+            total ++;
+        };
+        library.foreach([&](Module * pm) -> bool {
+            if ( pm->builtIn ) {
+                return true;
+            }
+            bool generated = pm==thisModule.get()
+                || find(prepared->modules.begin(), prepared->modules.end(), pm)!=prepared->modules.end();
+            for ( auto & it : pm->functions ) {
+                auto fn = it.second.get();
+                if ( fn->builtIn || fn->index<0 || !fn->used ) {
+                    continue;
+                }
+                if ( !generated ) {
+                    report(fn, "module " + pm->name + " is not generated with the program");
+                } else if ( fn->noAot ) {
+                    auto it = prepared->noAotReasons.find(fn);
+                    report(fn, it!=prepared->noAotReasons.end() ? it->second : "not supported");
+                }
+            }
+            return true;
+        }, "*");
+        logs << total << " function(s) interpreted\n";
+    }
+
+    void Program::registerAotCpp ( TextWriter & logs, Context & context, bool headers, const AotCppPreparedPtr & prepared ) {
         vector<Function *> fnn; fnn.reserve(totalFunctions);
         for (auto & pm : library.modules) {
             for (auto & it : pm->functions) {
@@ -2328,15 +2454,18 @@ namespace das {
             if ( fnn[i]->noAot )
                 continue;
             // SimFunction * fn = context.getFunction(i);
-            uint64_t semH = fnn[i]->hash;
-            logs << "\t\t// " << aotFuncName(fnn[i]) << "\n";
-            logs << "\t\taotLib[0x" << HEX << semH << DEC << "] = [&](Context & ctx){\n\t\treturn ";
-            logs << "ctx.code->makeNode<SimNode_Aot";
-            if ( fnn[i]->copyOnReturn || fnn[i]->moveOnReturn ) {
-                logs << "CMRES";
+            registerAotCppFunction(logs, fnn[i], thisModule.get());
+            if ( prepared ) {
+                registerAotCppDependencies(logs, fnn[i], *prepared);
+            }
+        }
+        if ( prepared ) {
+            for ( auto fn : prepared->functions ) {
+                if ( fn->module!=thisModule.get() ) {
+                    registerAotCppFunction(logs, fn, thisModule.get());
+                    registerAotCppDependencies(logs, fn, *prepared);
+                }
             }
-            logs << "<" << describeCppFunc(fnn[i],nullptr,false,false) << ",";
-            logs << "&" << aotFuncName(fnn[i]) << ">>();\n\t};\n";
         }
         if ( context.totalVariables || funInit ) {
             uint64_t semH = context.getInitSemanticHash();
@@ -2351,13 +2480,42 @@ namespace das {
         }
     }
 
-    void Program::aotCpp ( Context & context, TextWriter & logs ) {
+    // script modules, which the program requires. whole project AOT generates them with the program
+    static vector<Function *> aotProjectFunctions ( Program * program, vector<Module *> & modules ) {
+        vector<Function *> functions;
+        program->library.foreach([&](Module * pm) -> bool {
+            if ( pm!=program->thisModule.get() && !pm->builtIn ) {
+                modules.push_back(pm);
+                for ( auto & it : pm->functions ) {
+                    auto pfun = it.second.get();
+                    if ( !pfun->builtIn && pfun->index>=0 && pfun->used ) {
+                        functions.push_back(pfun);
+                    }
+                }
+            }
+            return true;
+        }, "*");
+        return functions;
+    }
+
+    AotCppPreparedPtr Program::aotCppPrepare ( Context & context, bool wholeProject ) {
+        auto prepared = make_shared<AotCppPrepared>();
+        vector<Function *> projectFunctions;
+        if ( wholeProject ) {
+            projectFunctions = aotProjectFunctions(this, prepared->modules);
+        }
         // run no-aot marker
-        NoAotMarker marker;
+        NoAotMarker marker(prepared->noAotReasons);
         visit(marker);
+        for ( auto fn : projectFunctions ) {
+            fn->visit(marker);
+        }
         // mark prologue
         PrologueMarker pmarker;
         visit(pmarker);
+        for ( auto fn : projectFunctions ) {
+            fn->visit(pmarker);
+        }
         // compute semantic hash for each used function
         int fni = 0;
         for (auto & pm : library.modules) {
@@ -2371,26 +2529,149 @@ namespace das {
             }
         }
         setPrintFlags();
-        BlockVariableCollector collector;
-        visit(collector);
-        CppAot aotVisitor(shared_from_this(),collector);
-        // pre visit all enumerations and structures for each dependency
-        for ( auto & pm : library.modules ) {
-            if ( pm == thisModule.get() ) {
-                continue;
+        prepared->collector = make_shared<BlockVariableCollector>();
+        visit(*prepared->collector);
+        for ( auto fn : projectFunctions ) {
+            fn->visit(*prepared->collector);
+        }
+        for ( auto & fnI : thisModule->functions ) {
+            auto & fn = fnI.second;
+            if ( !fn->builtIn && !fn->noAot ) {
+                prepared->functions.push_back(fn.get());
+            }
+        }
+        for ( auto fn : projectFunctions ) {
+            if ( !fn->noAot ) {
+                prepared->functions.push_back(fn);
+            }
+        }
+        for ( auto fn : prepared->functions ) {
+            AotCallCollector calls(thisModule.get(), prepared->modules);
+            fn->visit(calls);
+            prepared->calls[fn] = move(calls.calls);
+        }
+        return prepared;
+    }
+
+    // enumerations and structures of all the dependencies, each in the namespace of its module
+    static void aotCppDependencies ( Program * program, const AotCppPrepared & prepared, CppAot & aotVisitor ) {
+        program->library.foreach([&](Module * pm) -> bool {
+            if ( pm == program->thisModule.get() ) {
+                return true;
             }
             aotVisitor.ss << "namespace " << aotModuleName(pm) << " {\n";
             for ( auto & ite : pm->enumerations ) {
-                visitEnumeration(aotVisitor, ite.second.get());
+                program->visitEnumeration(aotVisitor, ite.second.get());
             }
             for ( auto & its : pm->structures ) {
-                visitStructure(aotVisitor, its.second.get());
+                program->visitStructure(aotVisitor, its.second.get());
             }
             aotVisitor.ss << "\n}; // " << pm->name << "\n";
+            return true;
+        }, "*");
+        // functions of the modules, which are generated with the program
+        if ( prepared.prototypes ) {
+            for ( auto pm : prepared.modules ) {
+                aotVisitor.ss << "namespace " << aotModuleName(pm) << " {\n";
+                for ( auto fn : prepared.functions ) {
+                    if ( fn->module==pm ) {
+                        aotVisitor.ss << describeCppFunc(fn,prepared.collector.get(),true,!aotVisitor.isSharded()) << ";\n";
+                    }
+                }
+                aotVisitor.ss << "}\n";
+            }
+        }
+    }
+
+    static void aotCppFunction ( Program * program, CppAot & aotVisitor, Function * fn ) {
+        if ( !aotVisitor.canVisitFunction(fn) ) {
+            return;
+        }
+        if ( fn->module!=program->thisModule.get() ) {
+            aotVisitor.ss << "\nnamespace " << aotModuleName(fn->module) << " {\n";
+            fn->visit(aotVisitor);
+            aotVisitor.ss << "}\n";
+        } else {
+            fn->visit(aotVisitor);
+        }
+    }
+
+    // debug info is per file, so it goes to the anonymous namespace
+    static void aotCppShardText ( CppAot & aotVisitor, TextWriter & logs ) {
+        logs << "\nnamespace {\n" << aotVisitor.debugInfoStr() << "}\n" << aotVisitor.ss.str();
+    }
+
+    void Program::aotCppHeader ( const AotCppPreparedPtr & prepared, TextWriter & logs ) {
+        CppAot aotVisitor(shared_from_this(), *prepared, true);
+        aotCppDependencies(this, *prepared, aotVisitor);
+        for ( auto & ite : thisModule->enumerations ) {
+            ite.second = visitEnumeration(aotVisitor, ite.second.get());
+        }
+        for ( auto & ist : thisModule->structuresInOrder ) {
+            visitStructure(aotVisitor, ist.get());
+        }
+        if ( prepared->prototypes ) {
+            aotVisitor.preVisitProgramBody(this);
+        }
+        aotCppShardText(aotVisitor, logs);
+    }
+
+    void Program::aotCppPrototypes ( const AotCppPreparedPtr & prepared, const vector<Function *> & functions, TextWriter & logs ) {
+        logs << "\n";
+        for ( auto fn : functions ) {
+            if ( fn->module!=thisModule.get() ) {
+                logs << "namespace " << aotModuleName(fn->module) << " { ";
+                logs << describeCppFunc(fn,prepared->collector.get(),true,false) << "; }\n";
+            } else {
+                logs << describeCppFunc(fn,prepared->collector.get(),true,false) << ";\n";
+            }
+        }
+        logs << "\n";
+    }
+
+    void Program::aotCppInitScript ( const AotCppPreparedPtr & prepared, TextWriter & logs ) {
+        CppAot aotVisitor(shared_from_this(), *prepared, true);
+        visitGlobals(aotVisitor);
+        aotCppShardText(aotVisitor, logs);
+    }
+
+    void Program::aotCppFunctions ( const AotCppPreparedPtr & prepared, const vector<Function *> & functions, TextWriter & logs ) {
+        if ( !prepared->prototypes ) {
+            vector<Function *> decl = functions;
+            for ( auto fn : functions ) {
+                auto it = prepared->calls.find(fn);
+                if ( it==prepared->calls.end() ) continue;
+                for ( auto cfn : it->second ) {
+                    if ( find(decl.begin(), decl.end(), cfn)==decl.end() ) {
+                        decl.push_back(cfn);
+                    }
+                }
+            }
+            aotCppPrototypes(prepared, decl, logs);
+        }
+        CppAot aotVisitor(shared_from_this(), *prepared, true);
+        for ( auto fn : functions ) {
+            aotCppFunction(this, aotVisitor, fn);
+        }
+        aotCppShardText(aotVisitor, logs);
+    }
+
+    void Program::aotCpp ( Context & context, TextWriter & logs ) {
+        aotCpp(aotCppPrepare(context), logs);
+    }
+
+    void Program::aotCpp ( const AotCppPreparedPtr & prepared, TextWriter & logs ) {
+        CppAot aotVisitor(shared_from_this(), *prepared);
+        // pre visit all enumerations and structures for each dependency
+        aotCppDependencies(this, *prepared, aotVisitor);
+        // functions of the other modules, if they are generated with the program
+        for ( auto fn : prepared->functions ) {
+            if ( fn->module!=thisModule.get() ) {
+                aotCppFunction(this, aotVisitor, fn);
+            }
         }
         // now to the main body
         visit(aotVisitor);
         logs << aotVisitor.str();
     }
 }
-
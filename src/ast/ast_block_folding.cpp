@@ -234,10 +234,11 @@ namespace das {
 
     // program
 
-    bool Program::optimizationRefFolding() {
+    bool Program::optimizationRefFolding(OptimizationWorklist * work) {
         bool any = false, anything = false;
         do {
             RefFolding context;
+            context.setWorklist(work);
             visit(context);
             any = context.didAnything();
             anything |= any;
@@ -245,14 +246,16 @@ namespace das {
         return anything;
     }
 
-    bool Program::optimizationBlockFolding() {
+    bool Program::optimizationBlockFolding(OptimizationWorklist * work) {
         BlockFolding context;
+        context.setWorklist(work);
         visit(context);
         return context.didAnything();
     }
 
-    bool Program::optimizationCondFolding() {
+    bool Program::optimizationCondFolding(OptimizationWorklist * work) {
         CondFolding context;
+        context.setWorklist(work);
         visit(context);
         return context.didAnything();
     }
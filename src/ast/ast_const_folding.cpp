@@ -13,6 +13,22 @@ namespace das {
 
     void OptVisitor::reportFolding() {
         anyFolding = true;
+        if ( worklist ) {
+            if ( visitingFunction ) {
+                worklist->changed.insert(visitingFunction);
+            } else {
+                worklist->changedOutside = true;
+            }
+        }
+    }
+
+    // Program::visit asks right before it visits the function, globals are visited before any function
+    bool OptVisitor::canVisitFunction ( Function * fun ) {
+        if ( worklist && !worklist->all && !worklist->functions.count(fun) ) {
+            return false;
+        }
+        visitingFunction = fun;
+        return true;
     }
 
     class SetSideEffectVisitor : public Visitor {
@@ -211,8 +227,11 @@ namespace das {
     };
 
     vec4f FoldingVisitor::eval ( Expression * expr, bool & failed ) {
-        ctx.restart();
+        // nodes of the previous expression are no longer needed. functions stay in the context code
+        evalCode->reset();
+        swap(ctx.code, evalCode);
         auto node = expr->simulate(ctx);
+        swap(ctx.code, evalCode);
         ctx.restart();
         vec4f result = ctx.evalWithCatch(node);
         if ( ctx.getException() ) {
@@ -510,7 +529,7 @@ namespace das {
                 uint32_t numArgs = uint32_t(expr->arguments.size());
                 pCall->arguments.reserve(numArgs-1);
                 for ( uint32_t i=1; i!=numArgs; ++i )
-                    pCall->arguments.push_back( expr->arguments[i]->clone() );
+                    pCall->arguments.push_back( expr->arguments[i] );  // clone would drop r2v flags
                 pCall->type = make_shared<TypeDecl>(*funcC->result);
                 reportFolding();
                 return pCall;
@@ -672,8 +691,52 @@ namespace das {
             DAS_ASSERTF ( !program->failed(), "internal error while folding (remove unused)?" );
             program->allocateStack(dummy);
             DAS_ASSERTF ( !program->failed(), "internal error while folding (allocate stack)?" );
-            program->simulate(ctx, dummy);
-            DAS_ASSERTF ( !program->failed(), "internal error while folding (simulate)?" );
+            // functions are simulated on demand. folded functions have no side effects, so there are no globals to initialize
+            program->simulateForFolding(ctx);
+        }
+    protected:
+        // same function with the same arguments folds to the same value
+        bool makeCacheKey ( ExprCall * expr, string & key ) const {
+            TextWriter ss;
+            ss << expr->func->getMangledName();
+            for ( auto & arg : expr->arguments ) {
+                if ( arg->type->baseType==Type::fakeContext ) continue;
+                if ( !arg->rtti_isConstant() ) return false;
+                ss << "\x01";
+                if ( arg->rtti_isStringConstant() ) {
+                    ss << static_pointer_cast<ExprConstString>(arg)->text;
+                } else {
+                    auto carg = static_pointer_cast<ExprConst>(arg);
+                    const char * data = (const char *) &carg->value;
+                    for ( int i=0, is=arg->type->getSizeOf(); i!=is; ++i ) {
+                        ss << HEX << int(uint8_t(data[i])) << " ";
+                    }
+                }
+            }
+            key = ss.str();
+            return true;
+        }
+        ExpressionPtr foldCall ( ExprCall * expr ) {
+            string key;
+            bool cacheIt = makeCacheKey(expr, key);
+            if ( cacheIt ) {
+                auto it = program->foldingCache.find(key);
+                if ( it != program->foldingCache.end() ) {
+                    if ( !it->second ) {
+                        return expr->shared_from_this();
+                    }
+                    auto res = it->second->clone();
+                    res->at = expr->at;
+                    reportFolding();
+                    return res;
+                }
+            }
+            program->simulateFunctionForFolding(ctx, expr->func);
+            auto res = evalAndFold(expr);
+            if ( cacheIt ) {
+                program->foldingCache[key] = res.get()!=expr ? res : nullptr;
+            }
+            return res;
         }
     protected:
         // ExprCall
@@ -691,7 +754,7 @@ namespace das {
                 }
                 if ( allConst ) {
                     DAS_ASSERT ( expr->func->index!=-1 );
-                    return evalAndFold(expr);
+                    return foldCall(expr);
                 }
             }
             return Visitor::visit(expr);
@@ -707,14 +770,16 @@ namespace das {
         visit(nse);
     }
 
-    bool Program::optimizationConstFolding() {
+    bool Program::optimizationConstFolding(OptimizationWorklist * work) {
         checkSideEffects();
         ConstFolding cfe(shared_from_this());
+        cfe.setWorklist(work);
         visit(cfe);
         bool any = cfe.didAnything();
         if ( cfe.needRun() ) {
             if ( !options.getOption("disableRun",false) ) {
                 RunFolding rfe(shared_from_this());
+                rfe.setWorklist(work);
                 visit(rfe);
                 any |= rfe.didAnything();
             }
@@ -79,6 +79,209 @@ namespace das {
         return pInvoke;
     }
 
+    // fused iterator adapters
+    //  for x in take(filter(src,pred),n)
+    //      body
+    //  becomes
+    //  {
+    //      let __take_n : int = n
+    //      var __take_i = 0
+    //      for x in src
+    //          if !invoke(pred,x)
+    //              continue
+    //          if __take_i >= __take_n
+    //              break
+    //          __take_i ++
+    //          body
+    //  }
+    //  pass-through adapters (filter,take,skip,zip) keep user iterator names, so the loop variable is still
+    //  a reference to the source element; map and enumerate bind a value with let
+    struct FusedFor {
+        FusedFor ( const LineInfo & a ) : at(a) {}
+        static int arity ( const ExpressionPtr & src ) {
+            if ( !src->rtti_isIterAdapter() ) return 1;
+            auto ad = static_pointer_cast<ExprIterAdapter>(src);
+            auto & args = ad->arguments;
+            if ( ad->name=="zip" ) {
+                if ( args.size()<1 ) return -1;
+                int total = 0;
+                for ( auto & arg : args ) {
+                    int n = arity(arg);
+                    if ( n<0 ) return -1;
+                    total += n;
+                }
+                return total;
+            } else if ( ad->name=="enumerate" ) {
+                if ( args.size()!=1 ) return -1;
+                int n = arity(args[0]);
+                return n<0 ? -1 : n + 1;
+            } else {
+                if ( args.size()!=2 ) return -1;
+                int n = arity(args[0]);
+                if ( ad->name=="map" ) return n<0 ? -1 : 1;
+                return n;                                   // filter, take, skip
+            }
+        }
+        string makeName ( const char * what ) {
+            return "__" + string(what) + "_" + to_string(at.line) + "_" + to_string(at.column) + "_" + to_string(index++);
+        }
+        ExpressionPtr makeVar ( const string & name ) const {
+            return make_shared<ExprVar>(at, name);
+        }
+        ExpressionPtr makeLet ( const string & name, const TypeDeclPtr & type, const ExpressionPtr & init ) const {
+            auto pVar = make_shared<Variable>();
+            pVar->at = at;
+            pVar->name = name;
+            pVar->type = type;
+            pVar->init = init;
+            auto pLet = make_shared<ExprLet>();
+            pLet->at = at;
+            pLet->variables.push_back(pVar);
+            return pLet;
+        }
+        ExpressionPtr makeIf ( const ExpressionPtr & cond, const vector<ExpressionPtr> & list ) const {
+            auto pBlock = make_shared<ExprBlock>();
+            pBlock->at = at;
+            pBlock->list = list;
+            auto pIf = make_shared<ExprIfThenElse>();
+            pIf->at = at;
+            pIf->cond = cond;
+            pIf->if_true = pBlock;
+            return pIf;
+        }
+        // invoke(fn,names...), or for the block literal $(a,b) body
+        //  invoke() <| $()
+        //      let a & = names[0]
+        //      let b & = names[1]
+        //      body
+        ExpressionPtr makeInvoke ( const ExpressionPtr & fn, const string * names, int count ) const {
+            auto pInvoke = make_shared<ExprInvoke>(at, "invoke");
+            if ( fn->rtti_isMakeBlock() ) {
+                auto mkb = static_pointer_cast<ExprMakeBlock>(fn);
+                auto blk = static_pointer_cast<ExprBlock>(mkb->block);
+                if ( int(blk->arguments.size())==count ) {
+                    auto pBlock = static_pointer_cast<ExprBlock>(blk->clone());
+                    vector<ExpressionPtr> binds;
+                    for ( int i=0; i!=count; ++i ) {
+                        auto & arg = blk->arguments[i];
+                        auto argT = make_shared<TypeDecl>(*arg->type);
+                        argT->ref = true;
+                        binds.push_back(makeLet(arg->name, argT, makeVar(names[i])));
+                    }
+                    pBlock->arguments.clear();
+                    pBlock->list.insert(pBlock->list.begin(), binds.begin(), binds.end());
+                    pInvoke->arguments.push_back(make_shared<ExprMakeBlock>(fn->at, pBlock));
+                    return pInvoke;
+                }
+            }
+            pInvoke->arguments.push_back(fn);
+            for ( int i=0; i!=count; ++i ) {
+                pInvoke->arguments.push_back(makeVar(names[i]));
+            }
+            return pInvoke;
+        }
+        void fuse ( const ExpressionPtr & src, const string * names ) {
+            if ( !src->rtti_isIterAdapter() ) {
+                iterators.push_back(names[0]);
+                sources.push_back(src);
+                return;
+            }
+            auto ad = static_pointer_cast<ExprIterAdapter>(src);
+            auto & args = ad->arguments;
+            if ( ad->name=="zip" ) {
+                for ( auto & arg : args ) {
+                    fuse(arg, names);
+                    names += arity(arg);
+                }
+            } else if ( ad->name=="enumerate" ) {
+                // var __enum = 0; ... let name = __enum ++
+                auto cntName = makeName("enum");
+                prologue.push_back(makeLet(cntName, make_shared<TypeDecl>(Type::tInt), make_shared<ExprConstInt>(at,0)));
+                fuse(args[0], names + 1);
+                auto idxT = make_shared<TypeDecl>(Type::tInt);
+                idxT->constant = true;
+                stages.push_back(makeLet(names[0], idxT, make_shared<ExprOp1>(at, "+++", makeVar(cntName))));
+            } else if ( ad->name=="map" ) {
+                // let name = invoke(fn,inner...)
+                int count = arity(args[0]);
+                vector<string> inner;
+                for ( int i=0; i!=count; ++i ) {
+                    inner.push_back(makeName("map"));
+                }
+                fuse(args[0], inner.data());
+                auto resT = make_shared<TypeDecl>(Type::autoinfer);
+                resT->constant = true;
+                stages.push_back(makeLet(names[0], resT, makeInvoke(args[1], inner.data(), count)));
+            } else if ( ad->name=="filter" ) {
+                // if !invoke(pred,names...) continue
+                fuse(args[0], names);
+                auto pNot = make_shared<ExprOp1>(at, "!", makeInvoke(args[1], names, arity(args[0])));
+                stages.push_back(makeIf(pNot, { make_shared<ExprContinue>(at) }));
+            } else if ( ad->name=="take" ) {
+                // if __take_i >= __take_n break; __take_i ++
+                auto limName = makeName("take_n");
+                auto cntName = makeName("take_i");
+                auto limT = make_shared<TypeDecl>(Type::tInt);
+                limT->constant = true;
+                prologue.push_back(makeLet(limName, limT, args[1]));
+                prologue.push_back(makeLet(cntName, make_shared<TypeDecl>(Type::tInt), make_shared<ExprConstInt>(at,0)));
+                fuse(args[0], names);
+                auto pDone = make_shared<ExprOp2>(at, ">=", makeVar(cntName), makeVar(limName));
+                stages.push_back(makeIf(pDone, { make_shared<ExprBreak>(at) }));
+                stages.push_back(make_shared<ExprOp1>(at, "++", makeVar(cntName)));
+            } else if ( ad->name=="skip" ) {
+                // if __skip_n > 0 { __skip_n --; continue }
+                auto cntName = makeName("skip_n");
+                prologue.push_back(makeLet(cntName, make_shared<TypeDecl>(Type::tInt), args[1]));
+                fuse(args[0], names);
+                auto pSkip = make_shared<ExprOp2>(at, ">", makeVar(cntName), make_shared<ExprConstInt>(at,0));
+                stages.push_back(makeIf(pSkip, {
+                    make_shared<ExprOp1>(at, "--", makeVar(cntName)),
+                    make_shared<ExprContinue>(at)
+                }));
+            }
+        }
+        LineInfo                at;
+        int                     index = 0;
+        vector<string>          iterators;
+        vector<ExpressionPtr>   sources;
+        vector<ExpressionPtr>   prologue;
+        vector<ExpressionPtr>   stages;
+    };
+
+    Expression * generateFusedFor ( ExprFor * expr ) {
+        bool anyAdapters = false;
+        int total = 0;
+        for ( auto & src : expr->sources ) {
+            anyAdapters |= src->rtti_isIterAdapter();
+            int n = FusedFor::arity(src);
+            if ( n<0 ) return expr;
+            total += n;
+        }
+        // mismatched loops are left alone, infer reports adapters which were not fused
+        if ( !anyAdapters || total!=int(expr->iterators.size()) ) {
+            return expr;
+        }
+        FusedFor ff(expr->at);
+        const string * names = expr->iterators.data();
+        for ( auto & src : expr->sources ) {
+            ff.fuse(src, names);
+            names += FusedFor::arity(src);
+        }
+        swap(expr->iterators, ff.iterators);
+        swap(expr->sources, ff.sources);
+        auto body = static_pointer_cast<ExprBlock>(expr->subexpr);
+        body->list.insert(body->list.begin(), ff.stages.begin(), ff.stages.end());
+        if ( ff.prologue.empty() ) {
+            return expr;
+        }
+        auto pBlock = new ExprBlock();
+        pBlock->at = expr->at;
+        pBlock->list = ff.prologue;
+        pBlock->list.push_back(ExpressionPtr(expr));
+        return pBlock;
+    }
+
     /* a->b(args) is short for invoke(a.b, cast<auto> a, args)  */
     ExprInvoke * makeInvokeMethod ( const LineInfo & at, Expression * a, const string & b ) {
         auto pInvoke = new ExprInvoke(at, "invoke");
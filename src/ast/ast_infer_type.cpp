@@ -29,12 +29,34 @@ namespace das {
 
     // type inference
 
+    // what the previous inference pass found out about the function
+    struct InferFunctionInfo {
+        bool                stable = false;     // no errors, and nothing changed during the last visit
+        vector<Function *>  dependencies;       // functions of this module, which it calls or takes address of
+    };
+    typedef map<Function *, InferFunctionInfo> InferFunctionMap;
+
     class InferTypes : public FoldingVisitor {
     public:
-        InferTypes( const ProgramPtr & prog ) : FoldingVisitor(prog ) {
+        InferTypes( const ProgramPtr & prog, const InferFunctionMap * prevI = nullptr, InferFunctionMap * nextI = nullptr )
+            : FoldingVisitor(prog ), prevInfo(prevI), nextInfo(nextI) {
             enableInferTimeFolding = prog->options.getOption("inferTimeFolding",true);
         }
         bool finished() const { return !needRestart; }
+        // something outside of the functions changed or failed. all functions need to be visited again
+        bool outsideChanged() const { return outsideRestart || program->errors.size()!=functionErrors; }
+    public:
+        uint32_t                visitedFunctions = 0;
+        uint32_t                skippedFunctions = 0;
+        uint64_t                visitedExpressions = 0;
+    protected:
+        const InferFunctionMap *prevInfo = nullptr;
+        InferFunctionMap *      nextInfo = nullptr;
+        vector<Function *>      funcDeps;
+        size_t                  funcErrors = 0;
+        size_t                  functionErrors = 0;
+        bool                    funcRestart = false;
+        bool                    outsideRestart = false;
     protected:
         FunctionPtr             func;
         vector<VariablePtr>     local;
@@ -70,6 +92,44 @@ namespace das {
         }
         void reportGenericInfer() {
             needRestart = true;
+            if ( func ) {
+                funcRestart = true;
+            } else {
+                outsideRestart = true;
+            }
+        }
+        void addDependency ( Function * fn ) {
+            if ( nextInfo && fn && fn->module==program->thisModule.get() ) {
+                funcDeps.push_back(fn);
+            }
+        }
+        bool isStable ( Function * fn ) const {
+            if ( fn->module!=program->thisModule.get() ) return true;
+            auto it = prevInfo->find(fn);
+            return it!=prevInfo->end() && it->second.stable;
+        }
+    public:
+        // function is skipped, if nothing has changed in it, or in anything it depends on, during the previous pass
+        virtual bool canVisitFunction ( Function * fn ) override {
+            if ( prevInfo ) {
+                auto it = prevInfo->find(fn);
+                if ( it!=prevInfo->end() && it->second.stable ) {
+                    bool depsStable = true;
+                    for ( auto dep : it->second.dependencies ) {
+                        if ( !isStable(dep) ) {
+                            depsStable = false;
+                            break;
+                        }
+                    }
+                    if ( depsStable ) {
+                        (*nextInfo)[fn] = it->second;
+                        skippedFunctions ++;
+                        return false;
+                    }
+                }
+            }
+            visitedFunctions ++;
+            return true;
         }
     protected:
 
@@ -113,6 +173,16 @@ namespace das {
                     }
                     verifyType(arrayType);
                 }
+            } else if ( decl->baseType==Type::tSlice ) {
+                if ( auto sliceType = decl->firstType ) {
+                    if ( sliceType->ref ) {
+                        error("can't declare a slice of references",sliceType->at,CompilationError::invalid_array_type);
+                    }
+                    if ( sliceType->baseType==Type::tVoid) {
+                        error("can't declare a void slice",sliceType->at,CompilationError::invalid_array_type);
+                    }
+                    verifyType(sliceType);
+                }
             } else if ( decl->baseType==Type::tTable ) {
                 if ( auto keyType = decl->firstType ) {
                     if ( keyType->ref ) {
@@ -281,7 +351,7 @@ namespace das {
                     resT->firstType = inferAlias(decl->firstType,fptr);
                     if ( !resT->firstType ) return nullptr;
                 }
-            } else if ( decl->baseType==Type::tArray ) {
+            } else if ( decl->baseType==Type::tArray || decl->baseType==Type::tSlice ) {
                 if ( decl->firstType ) {
                     resT->firstType = inferAlias(decl->firstType,fptr);
                     if ( !resT->firstType ) return nullptr;
@@ -915,6 +985,9 @@ namespace das {
             Visitor::preVisit(f);
             func = f->shared_from_this();
             func->hasReturn = false;
+            funcDeps.clear();
+            funcErrors = program->errors.size();
+            funcRestart = false;
         }
         virtual void preVisitArgument ( Function * fn, const VariablePtr & var, bool lastArg ) override {
             Visitor::preVisitArgument(fn, var, lastArg);
@@ -994,6 +1067,12 @@ namespace das {
             DAS_ASSERT(blocks.size()==0);
             DAS_ASSERT(local.size()==0);
             DAS_ASSERT(with.size()==0);
+            functionErrors += program->errors.size() - funcErrors;
+            if ( nextInfo ) {
+                auto & info = (*nextInfo)[that];
+                info.stable = !funcRestart && program->errors.size()==funcErrors;
+                info.dependencies = funcDeps;
+            }
             func.reset();
             return Visitor::visit(that);
         }
@@ -1001,6 +1080,7 @@ namespace das {
         virtual void preVisitExpression ( Expression * expr ) override {
             Visitor::preVisitExpression(expr);
             expr->type.reset();
+            visitedExpressions ++;
         }
     // const
         virtual ExpressionPtr visit ( ExprConst * c ) override {
@@ -1033,6 +1113,7 @@ namespace das {
             if ( fns.size()==1 ) {
                 expr->func = fns.back().get();
                 expr->func->addr = true;
+                addDependency(expr->func);
                 expr->type = make_shared<TypeDecl>(Type::tFunction);
                 expr->type->firstType = make_shared<TypeDecl>(*expr->func->result);
                 expr->type->argTypes.reserve ( expr->func->arguments.size() );
@@ -1126,6 +1207,13 @@ namespace das {
             expr->type = make_shared<TypeDecl>(Type::tVoid);
             return Visitor::visit(expr);
         }
+    // ExprIterAdapter
+        virtual ExpressionPtr visit ( ExprIterAdapter * expr ) override {
+            // adapters which made it this far were not fused into a for loop
+            error(expr->name + "(...) can only be used as a for loop source, with one iterator per value it produces",
+                expr->at, CompilationError::invalid_iteration_source);
+            return Visitor::visit(expr);
+        }
     // ExprAssert
         virtual ExpressionPtr visit ( ExprAssert * expr ) override {
             if ( expr->argumentsFailedToInfer ) return Visitor::visit(expr);
@@ -1725,6 +1813,40 @@ namespace das {
                     return Visitor::visit(expr);
                 }
                 expr->type = seT->annotation->makeIndexType(expr->subexpr, expr->index);
+                if ( expr->type->isGoodSliceType() ) {
+                    expr->type->firstType->constant |= seT->constant;
+                } else {
+                    expr->type->constant |= seT->constant;
+                }
+            } else if ( ixT->isSimpleType(Type::tRange) ) {
+                // a[range(from,to)] is a non-owning view of the elements of the array, fixed array, or slice
+                if ( seT->isGoodSliceType() ) {
+                    expr->subexpr = Expression::autoDereference(expr->subexpr);
+                    expr->type = make_shared<TypeDecl>(*seT);
+                    expr->type->ref = false;
+                    expr->type->constant = false;
+                    expr->type->firstType->constant |= seT->constant;
+                } else if ( seT->isGoodArrayType() || (seT->dim.size() && seT->isRef()) ) {
+                    expr->type = make_shared<TypeDecl>(Type::tSlice);
+                    if ( seT->dim.size() ) {
+                        expr->type->firstType = make_shared<TypeDecl>(*seT);
+                        expr->type->firstType->dim.pop_back();
+                    } else {
+                        expr->type->firstType = make_shared<TypeDecl>(*seT->firstType);
+                    }
+                    expr->type->firstType->ref = false;
+                    expr->type->firstType->constant |= seT->constant;
+                } else {
+                    error("can only slice an array, a fixed array, or a slice", expr->subexpr->at, CompilationError::cant_index);
+                }
+            } else if ( seT->isGoodSliceType() ) {
+                if ( !ixT->isIndex() ) {
+                    error("index must be int, uint, or range", expr->index->at, CompilationError::invalid_index_type);
+                    return Visitor::visit(expr);
+                }
+                expr->subexpr = Expression::autoDereference(expr->subexpr);
+                expr->type = make_shared<TypeDecl>(*seT->firstType);
+                expr->type->ref = true;
                 expr->type->constant |= seT->constant;
             } else if ( seT->isPointer() ) {
                 if ( !ixT->isIndex() ) {
@@ -2116,6 +2238,7 @@ namespace das {
                       + "' with argument (" + expr->subexpr->type->describe() + ")", expr->at, CompilationError::operator_not_found);
             } else {
                 expr->func = functions[0].get();
+                addDependency(expr->func);
                 expr->type = make_shared<TypeDecl>(*expr->func->result);
                 if ( !expr->func->arguments[0]->type->isRef() )
                     expr->subexpr = Expression::autoDereference(expr->subexpr);
@@ -2153,6 +2276,7 @@ namespace das {
                       + ")\n" + candidates, expr->at, CompilationError::operator_not_found);
             } else {
                 expr->func = functions[0].get();
+                addDependency(expr->func);
                 expr->type = make_shared<TypeDecl>(*expr->func->result);
                 if ( !expr->func->arguments[0]->type->isRef() )
                     expr->left = Expression::autoDereference(expr->left);
@@ -2556,6 +2680,9 @@ namespace das {
                 } else if ( src->type->isGoodArrayType() ) {
                     pVar->type = make_shared<TypeDecl>(*src->type->firstType);
                     pVar->type->ref = true;
+                } else if ( src->type->isGoodSliceType() ) {
+                    pVar->type = make_shared<TypeDecl>(*src->type->firstType);
+                    pVar->type->ref = true;
                 } else if ( src->type->isRange() ) {
                     pVar->type = make_shared<TypeDecl>(src->type->getRangeBaseType());
                     pVar->type->ref = false;
@@ -2866,6 +2993,7 @@ namespace das {
             } else {
                 DAS_ASSERT(functions.size()==1);
                 auto funcC = functions.back();
+                addDependency(funcC.get());
                 if ( generics.size()==1 ) {
                     auto gen = generics.back();
                     if ( funcC->fromGeneric != gen.get() ) {
@@ -3152,8 +3280,13 @@ namespace das {
 
     // program
 
+    extern "C" int64_t ref_time_ticks ();
+    extern "C" int get_time_usec (int64_t reft);
+
     void Program::inferTypes(TextWriter & logs) {
         const bool log = options.getOption("logInferPasses",false);
+        const bool logTime = options.getOption("logCompileTime",false);
+        const bool incremental = options.getOption("incrementalInfer",true);
         int pass = 0, maxPasses = 50;
         if (auto maxP = options.find("maxInferPasses", Type::tInt)) {
             maxPasses = maxP->iValue;
@@ -3161,11 +3294,24 @@ namespace das {
         if ( log ) {
             logs << "INITIAL CODE:\n" << *this;
         }
+        // only functions, which changed or depend on what changed during the previous pass, are visited again
+        InferFunctionMap prevInfo, nextInfo;
+        bool canSkip = false;
+        uint64_t totalExpressions = 0;
+        auto time0 = ref_time_ticks();
         for ( pass = 0; pass < maxPasses; ++pass ) {
             failToCompile = false;
             errors.clear();
-            InferTypes context(shared_from_this());
+            nextInfo.clear();
+            InferTypes context(shared_from_this(), canSkip ? &prevInfo : nullptr, incremental ? &nextInfo : nullptr);
             visit(context);
+            canSkip = incremental && !context.outsideChanged();
+            swap(prevInfo, nextInfo);
+            totalExpressions += context.visitedExpressions;
+            if ( logTime ) {
+                logs << "infer pass " << pass << ": " << context.visitedFunctions << " functions visited, "
+                    << context.skippedFunctions << " skipped, " << context.visitedExpressions << " expressions\n";
+            }
             for ( auto efn : context.extraFunctions ) {
                 addFunction(efn);
             }
@@ -3179,6 +3325,10 @@ namespace das {
             if ( context.finished() )
                 break;
         }
+        if ( logTime ) {
+            auto dt = get_time_usec(time0) / 1000000.;
+            logs << "infer took " << dt << ", " << (pass+1) << " passes, " << totalExpressions << " expressions\n";
+        }
         if (pass == maxPasses) {
             error("type inference exceeded maximum allowed number of passes ("+to_string(maxPasses)+")\n"
                     "this is likely due to a loop in the type system", LineInfo(), CompilationError::too_many_infer_passes);
@@ -0,0 +1,279 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_visitor.h"
+
+namespace das {
+
+    // function is inlined, when its body is a single 'return expr', and expr is no bigger than this
+    //  [inline] functions are inlined regardless of the size, [noinline] ones are never inlined
+    const int MAX_INLINE_NODES = 16;
+    const int MAX_INLINE_ROUNDS = 4;
+
+    // read of the constant, variable, or its field, which is cheap to repeat and can't fail
+    static bool isSimpleArgument ( Expression * expr ) {
+        if ( expr->rtti_isConstant() || expr->rtti_isVar() ) {
+            return true;
+        } else if ( expr->rtti_isR2V() ) {
+            return isSimpleArgument(static_cast<ExprRef2Value *>(expr)->subexpr.get());
+        } else if ( expr->rtti_isField() && !expr->rtti_isSafeField() ) {
+            auto efield = static_cast<ExprField *>(expr);
+            return !efield->value->type->isPointer() && isSimpleArgument(efield->value.get());
+        } else if ( expr->rtti_isSwizzle() ) {
+            return isSimpleArgument(static_cast<ExprSwizzle *>(expr)->value.get());
+        }
+        return false;
+    }
+
+    static bool isPureCall ( ExprLooksLikeCall * expr, Function * func ) {
+        if ( !func || !func->builtIn || func->sideEffectFlags ) {
+            return false;
+        }
+        for ( auto & arg : expr->arguments ) {
+            if ( !isSimpleArgument(arg.get()) ) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // computation, which can be moved into the inlined body as is, because it has no side effects and can't fail
+    //  division and modulo are excluded, for they panic on zero
+    static bool isPureArgument ( Expression * expr ) {
+        if ( isSimpleArgument(expr) ) {
+            return true;
+        } else if ( expr->rtti_isR2V() ) {
+            return isPureArgument(static_cast<ExprRef2Value *>(expr)->subexpr.get());
+        } else if ( expr->rtti_isOp1() ) {
+            auto op1 = static_cast<ExprOp1 *>(expr);
+            return isPureCall(op1, op1->func) && isPureArgument(op1->subexpr.get());
+        } else if ( expr->rtti_isOp2() ) {
+            auto op2 = static_cast<ExprOp2 *>(expr);
+            if ( op2->op=="/" || op2->op=="%" ) {
+                return false;
+            }
+            return isPureCall(op2, op2->func) && isPureArgument(op2->left.get()) && isPureArgument(op2->right.get());
+        } else if ( expr->rtti_isOp3() ) {
+            auto op3 = static_cast<ExprOp3 *>(expr);
+            return isPureArgument(op3->subexpr.get()) && isPureArgument(op3->left.get()) && isPureArgument(op3->right.get());
+        } else if ( expr->rtti_isCall() ) {
+            auto call = static_cast<ExprCall *>(expr);
+            if ( !call->func || !call->func->builtIn || call->func->sideEffectFlags ) {
+                return false;
+            }
+            for ( auto & arg : call->arguments ) {
+                if ( !isPureArgument(arg.get()) ) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        return false;
+    }
+
+    // checks, that the return expression only reads, counts its nodes, and how many times each argument is used
+    class InlineShape : public Visitor {
+    public:
+        InlineShape ( Function * fn ) : func(fn) { uses.resize(fn->arguments.size(), 0); }
+        bool        ok = true;
+        int         nodes = 0;
+        vector<int> uses;
+    protected:
+        Function *  func;
+    protected:
+        virtual void preVisitExpression ( Expression * expr ) override {
+            Visitor::preVisitExpression(expr);
+            nodes ++;
+            if ( expr->rtti_isSafeField() ) {
+                ok = false;
+            } else if ( !(expr->rtti_isConstant() || expr->rtti_isVar() || expr->rtti_isR2V()
+                    || expr->rtti_isOp1() || expr->rtti_isOp2() || expr->rtti_isOp3()
+                    || expr->rtti_isField() || expr->rtti_isSwizzle() || expr->rtti_isAt() || expr->rtti_isCall()) ) {
+                ok = false;
+            }
+        }
+        virtual void preVisit ( ExprVar * expr ) override {
+            Visitor::preVisit(expr);
+            if ( expr->argument ) {
+                if ( expr->argumentIndex>=0 && expr->argumentIndex<int(uses.size()) ) {
+                    uses[expr->argumentIndex] ++;
+                } else {
+                    ok = false;
+                }
+            } else if ( expr->local || expr->block ) {
+                ok = false;
+            }
+        }
+        virtual void preVisit ( ExprCall * expr ) override {
+            Visitor::preVisit(expr);
+            if ( !expr->func || expr->func==func ) ok = false;
+        }
+        virtual void preVisit ( ExprOp1 * expr ) override {
+            Visitor::preVisit(expr);
+            if ( !expr->func || expr->func==func ) ok = false;
+        }
+        virtual void preVisit ( ExprOp2 * expr ) override {
+            Visitor::preVisit(expr);
+            if ( !expr->func || expr->func==func ) ok = false;
+        }
+    };
+
+    // replaces arguments of the inlined function with the call arguments
+    //  argument of the workhorse type is only to be read. its substitution has to end up under the ref2value,
+    //  possibly through the field or the swizzle. otherwise callee could have modified its own copy, or took its address
+    class InlineArguments : public Visitor {
+    public:
+        InlineArguments ( Function * fn, const vector<ExpressionPtr> & a ) : func(fn), args(a) {}
+        bool failed() const { return !values.empty() || !reads.empty(); }
+    protected:
+        Function *                      func;
+        const vector<ExpressionPtr> &   args;
+        set<Expression *>               values;     // value, where the reference was
+        set<Expression *>               reads;      // reference, which has to be read
+    protected:
+        virtual ExpressionPtr visit ( ExprVar * expr ) override {
+            if ( !expr->argument ) {
+                return Visitor::visit(expr);
+            }
+            auto & arg = args[expr->argumentIndex];
+            bool byValue = !func->arguments[expr->argumentIndex]->type->isRefType();
+            ExpressionPtr sub;
+            if ( arg->rtti_isR2V() ) {
+                sub = static_pointer_cast<ExprRef2Value>(arg)->subexpr->clone();
+                if ( byValue ) reads.insert(sub.get());
+            } else {
+                sub = arg->clone();
+                if ( !sub->type->isRef() ) {
+                    values.insert(sub.get());
+                } else if ( byValue ) {
+                    reads.insert(sub.get());
+                }
+            }
+            return sub;
+        }
+        virtual ExpressionPtr visit ( ExprField * expr ) override {
+            if ( reads.erase(expr->value.get()) ) reads.insert(expr);
+            return Visitor::visit(expr);
+        }
+        virtual ExpressionPtr visit ( ExprSwizzle * expr ) override {
+            if ( reads.erase(expr->value.get()) ) reads.insert(expr);
+            return Visitor::visit(expr);
+        }
+        virtual ExpressionPtr visit ( ExprRef2Value * expr ) override {
+            if ( values.erase(expr->subexpr.get()) ) {
+                return expr->subexpr;
+            }
+            reads.erase(expr->subexpr.get());
+            return Visitor::visit(expr);
+        }
+    };
+
+    class InlineCalls : public OptVisitor {
+    public:
+        InlineCalls ( Program * prog, TextWriter & l ) : program(prog), logs(l) {
+            log = program->options.getOption("logInline",false);
+        }
+        int inlined = 0;
+    protected:
+        Program *       program;
+        TextWriter &    logs;
+        bool            log = false;
+        Function *      func = nullptr;
+    protected:
+        ExprReturn * inlineReturn ( Function * fn ) const {
+            if ( fn->builtIn || fn->noInline || fn->sideEffectFlags || fn->module!=program->thisModule.get() ) {
+                return nullptr;
+            }
+            if ( !fn->result->isWorkhorseType() || fn->result->isRef() ) {
+                return nullptr;
+            }
+            for ( auto & arg : fn->arguments ) {
+                if ( arg->type->isRefType() ) {
+                    if ( !arg->type->isConst() ) return nullptr;
+                } else if ( !arg->type->isWorkhorseType() || arg->type->isRef() ) {
+                    return nullptr;
+                }
+            }
+            if ( !fn->body || !fn->body->rtti_isBlock() ) {
+                return nullptr;
+            }
+            auto block = static_pointer_cast<ExprBlock>(fn->body);
+            if ( block->isClosure || block->finalList.size() || block->list.size()!=1 || !block->list[0]->rtti_isReturn() ) {
+                return nullptr;
+            }
+            auto ret = static_pointer_cast<ExprReturn>(block->list[0]);
+            if ( !ret->subexpr || ret->moveSemantics || ret->returnReference ) {
+                return nullptr;
+            }
+            return ret.get();
+        }
+        ExpressionPtr inlineCall ( ExprCall * expr ) {
+            auto fn = expr->func;
+            auto ret = inlineReturn(fn);
+            if ( !ret || expr->arguments.size()!=fn->arguments.size() ) {
+                return nullptr;
+            }
+            InlineShape shape(fn);
+            ret->subexpr->visit(shape);
+            if ( !shape.ok || (!fn->inlineCall && shape.nodes>MAX_INLINE_NODES) ) {
+                return nullptr;
+            }
+            for ( size_t i=0, is=expr->arguments.size(); i!=is; ++i ) {
+                auto arg = expr->arguments[i].get();
+                if ( isSimpleArgument(arg) ) {
+                    continue;
+                }
+                if ( fn->arguments[i]->type->isRefType() || shape.uses[i]>1 || !isPureArgument(arg) ) {
+                    return nullptr;
+                }
+            }
+            InlineArguments subst(fn, expr->arguments);
+            auto body = ret->subexpr->clone()->visit(subst);
+            if ( subst.failed() ) {
+                return nullptr;
+            }
+            return body;
+        }
+    protected:
+        virtual void preVisit ( Function * fn ) override {
+            OptVisitor::preVisit(fn);
+            func = fn;
+        }
+        virtual FunctionPtr visit ( Function * fn ) override {
+            func = nullptr;
+            return OptVisitor::visit(fn);
+        }
+        virtual ExpressionPtr visit ( ExprCall * expr ) override {
+            if ( expr->func && expr->func!=func ) {
+                if ( auto body = inlineCall(expr) ) {
+                    if ( log ) {
+                        logs << expr->at.describe() << ": inlined " << expr->func->name
+                            << " into " << (func ? func->name : string("global initializer")) << "\n";
+                    }
+                    inlined ++;
+                    reportFolding();
+                    return body;
+                }
+            }
+            return OptVisitor::visit(expr);
+        }
+    };
+
+    // runs before the rest of the optimizations, so that inlined expressions get folded into the caller
+    //  calls, which appear in the inlined bodies, are inlined in the next round
+    bool Program::inlineFunctions(TextWriter & logs) {
+        int total = 0;
+        for ( int round=0; round!=MAX_INLINE_ROUNDS; ++round ) {
+            InlineCalls context(this, logs);
+            visit(context);
+            total += context.inlined;
+            if ( !context.didAnything() ) {
+                break;
+            }
+        }
+        if ( total && options.getOption("logInline",false) ) {
+            logs << total << " calls inlined\n";
+        }
+        return total!=0;
+    }
+}
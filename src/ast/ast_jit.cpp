@@ -0,0 +1,240 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/ast/ast_jit.h"
+
+#include "daScript/simulate/simulate_visit_op.h"
+
+#include <stdlib.h>
+
+extern "C" int64_t ref_time_ticks ();
+
+namespace das {
+
+    // counts calls of the function, while the function is profiled
+    struct SimNode_JitCallCounter : SimNode {
+        SimNode_JitCallCounter ( SimNode * c ) : SimNode(c->debugInfo), code(c) {}
+        virtual vec4f eval ( Context & context ) override {
+            calls ++;
+            return code->eval(context);
+        }
+        virtual SimNode * visit ( SimVisitor & vis ) override {
+            V_BEGIN();
+            V_OP(JitCallCounter);
+            V_SUB(code);
+            V_END();
+        }
+        SimNode *   code;
+        uint64_t    calls = 0;
+    };
+
+    CppJit::CppJit ( const ProgramPtr & prog, Context & ctx, const CppJitOptions & opt )
+        : program(prog), context(ctx), options(opt), compiled(false) {
+        // same order as in the simulate
+        program->library.foreach([&](Module * pm){
+            for ( auto & it : pm->functions ) {
+                auto pfun = it.second.get();
+                if ( pfun->index < 0 || !pfun->used )
+                    continue;
+                functions.push_back(pfun);
+            }
+            return true;
+        },"*");
+        int totalFunctions = context.getTotalFunctions();
+        functions.resize(totalFunctions);
+        original.resize(totalFunctions);
+        counters.resize(totalFunctions);
+        state.resize(totalFunctions, JitState::interpreted);
+        for ( int fni=0; fni!=totalFunctions; ++fni ) {
+            auto fn = context.getFunction(fni);
+            original[fni] = fn->code;
+            auto pfun = functions[fni];
+            if ( !fn->aot && pfun && pfun->module==program->thisModule.get() && !pfun->builtIn && !pfun->noAot ) {
+                state[fni] = JitState::profiled;
+                counters[fni] = context.code->makeNode<SimNode_JitCallCounter>(fn->code);
+            }
+        }
+        profile(true);
+    }
+
+    CppJit::~CppJit() {
+        // compilation in flight is not linked
+        if ( worker.joinable() ) {
+            worker.join();
+            remove(libraryName.c_str());
+            remove(logName.c_str());
+        }
+        // interpreted code goes back, then it is safe to unload
+        for ( int fni=0, fnis=int(original.size()); fni!=fnis; ++fni ) {
+            auto fn = context.getFunction(fni);
+            if ( state[fni]!=JitState::interpreted ) {
+                fn->code = original[fni];
+                fn->aot = false;
+            }
+        }
+        libraries.clear();
+    }
+
+    void CppJit::profile ( bool enable ) {
+        for ( int fni=0, fnis=int(original.size()); fni!=fnis; ++fni ) {
+            if ( state[fni]==JitState::profiled || state[fni]==JitState::compiling ) {
+                context.getFunction(fni)->code = enable ? counters[fni] : original[fni];
+            }
+        }
+    }
+
+    bool CppJit::update ( TextWriter & logs ) {
+        if ( worker.joinable() ) {
+            if ( !compiled ) {
+                return false;
+            }
+            worker.join();
+            return finishCompile(logs);
+        }
+        startCompile(logs);
+        return false;
+    }
+
+    bool CppJit::flush ( TextWriter & logs ) {
+        if ( !worker.joinable() ) {
+            return false;
+        }
+        worker.join();
+        return finishCompile(logs);
+    }
+
+    bool CppJit::startCompile ( TextWriter & logs ) {
+        vector<int> hot;
+        for ( int fni=0, fnis=int(original.size()); fni!=fnis; ++fni ) {
+            if ( state[fni]==JitState::profiled && counters[fni]->calls>=options.hotCalls ) {
+                hot.push_back(fni);
+            }
+        }
+        if ( hot.empty() ) {
+            return false;
+        }
+        // semantic hash is computed from the interpreted code
+        profile(false);
+        auto prepared = program->aotCppPrepare(context);
+        profile(true);
+        prepared->prototypes = false;
+        // hot functions, and everything they call directly
+        vector<Function *> jit;
+        for ( auto fni : hot ) {
+            auto pfun = functions[fni];
+            if ( find(prepared->functions.begin(), prepared->functions.end(), pfun)!=prepared->functions.end() ) {
+                jit.push_back(pfun);
+            }
+        }
+        for ( size_t i=0; i!=jit.size(); ++i ) {
+            for ( auto cfn : prepared->calls[jit[i]] ) {
+                if ( find(jit.begin(), jit.end(), cfn)==jit.end() ) {
+                    jit.push_back(cfn);
+                }
+            }
+        }
+        TextWriter tw;
+        tw << "#include \"daScript/misc/platform.h\"\n\n";
+        tw << "#include \"daScript/simulate/simulate.h\"\n";
+        tw << "#include \"daScript/simulate/aot.h\"\n";
+        tw << "#include \"daScript/simulate/aot_library.h\"\n\n";
+        bool noAot = false;
+        program->library.foreach([&](Module * mod){
+            if ( mod->name!="" && mod->aotRequire(tw)==ModuleAotType::no_aot ) {
+                noAot = true;
+            }
+            return true;
+        },"*");
+        if ( noAot || jit.empty() ) {
+            for ( auto fni : hot ) {
+                state[fni] = JitState::failed;
+                context.getFunction(fni)->code = original[fni];
+            }
+            if ( noAot ) {
+                logs << "JIT disabled, program requires module without AOT\n";
+            }
+            return false;
+        }
+        tw << "\nnamespace das {\n";
+        tw << "namespace {\n";
+        program->aotCppHeader(prepared, tw);
+        program->aotCppFunctions(prepared, jit, tw);
+        tw << "struct AotList_impl : AotListBase {\n";
+        tw << "\tvirtual void registerAotFunctions ( AotLibrary & aotLib ) override {\n";
+        program->registerAotCppFunctions(tw, jit);
+        tw << "\t};\n";
+        tw << "};\n";
+        tw << "AotList_impl impl;\n";
+        tw << "}\n";
+        tw << "}\n";
+        for ( auto fni : hot ) {
+            state[fni] = JitState::compiling;
+        }
+        // shared object, which is loaded, can't be overwritten
+        TextWriter baseName;
+        baseName << options.tempPath << "/das_jit_" << HEX << uint64_t(intptr_t(this)) << "_"
+            << uint64_t(ref_time_ticks()) << DEC << "_" << generation++;
+        string cppName = baseName.str() + ".cpp";
+        libraryName = baseName.str() + ".so";
+        logName = baseName.str() + ".log";
+        TextWriter cmd;
+        cmd << options.compiler;
+        for ( auto & inc : options.includePaths ) {
+            cmd << " -I\"" << inc << "\"";
+        }
+        cmd << " \"" << cppName << "\" -o \"" << libraryName << "\" > \"" << logName << "\" 2>&1";
+        string source = tw.str();
+        string command = cmd.str();
+        compiled = false;
+        worker = thread([this,source,cppName,command](){
+            bool ok = false;
+            if ( FILE * f = fopen(cppName.c_str(), "w") ) {
+                ok = fwrite(source.c_str(), source.length(), 1, f)==1;
+                fclose(f);
+                ok = ok && system(command.c_str())==0;
+                remove(cppName.c_str());
+            }
+            compiledOk = ok;
+            compiled = true;
+        });
+        return true;
+    }
+
+    bool CppJit::finishCompile ( TextWriter & logs ) {
+        bool ok = compiledOk;
+        if ( !ok ) {
+            logs << "JIT compilation failed, see " << logName << "\n";
+        } else {
+            remove(logName.c_str());
+        }
+        AotLibrary aotLib;
+        if ( ok ) {
+            libraries.emplace_back(new AotSharedLibrary());
+            ok = libraries.back()->load(libraryName, aotLib, logs);
+        }
+        // loaded shared object stays mapped
+        remove(libraryName.c_str());
+        libraryName.clear();
+        // linking hashes the interpreted code
+        profile(false);
+        int linked = 0;
+        if ( ok ) {
+            program->linkCppAot(context, aotLib, logs);
+            for ( int fni=0, fnis=int(original.size()); fni!=fnis; ++fni ) {
+                auto fn = context.getFunction(fni);
+                if ( fn->aot && state[fni]!=JitState::compiled && state[fni]!=JitState::interpreted ) {
+                    state[fni] = JitState::compiled;
+                    linked ++;
+                }
+            }
+        }
+        for ( auto & st : state ) {
+            if ( st==JitState::compiling ) {
+                st = JitState::failed;
+            }
+        }
+        profile(true);
+        totalJit += linked;
+        return linked!=0;
+    }
+}
+
@@ -0,0 +1,779 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/ast/ast_jit_x64.h"
+#include "daScript/ast/ast_expressions.h"
+
+#include "daScript/simulate/simulate_visit_op.h"
+
+extern void * os_alloc_exec ( size_t size );
+extern bool os_protect_exec ( void * ptr, size_t size );
+extern void os_free_exec ( void * ptr, size_t size );
+
+namespace das {
+
+    typedef vec4f ( * JitX64Function ) ( vec4f * args );
+
+    // calls the machine code. arguments are where the call put them, result goes where the return would put it
+    struct SimNode_JitX64 : SimNode {
+        SimNode_JitX64 ( const LineInfo & at, JitX64Function f ) : SimNode(at), fn(f) {}
+        virtual vec4f eval ( Context & context ) override {
+            auto res = fn(context.abiArguments());
+            context.abiResult() = res;
+            return res;
+        }
+        virtual SimNode * visit ( SimVisitor & vis ) override {
+            V_BEGIN();
+            V_OP(JitX64);
+            V_END();
+        }
+        JitX64Function fn;
+    };
+
+    // values live in eax (int, bool) or xmm0 (float in x, float vectors and ranges)
+    //  the second operand of the binary operation goes to ecx or xmm1
+    enum class JitKind : uint8_t { none, boolean, integer, floating, vector };
+
+    enum X64Reg : uint8_t { rax = 0, rcx = 1, rdx = 2, rbx = 3, rsp = 4, rbp = 5 };
+
+    enum X64Cond : uint8_t {
+        cc_b = 0x2, cc_ae = 0x3, cc_e = 0x4, cc_ne = 0x5, cc_be = 0x6, cc_a = 0x7,
+        cc_p = 0xA, cc_np = 0xB, cc_l = 0xC, cc_ge = 0xD, cc_le = 0xE, cc_g = 0xF
+    };
+
+    // [base + disp], or the constant from the pool, which follows the code
+    struct X64Mem {
+        uint8_t base = rbp;
+        int32_t disp = 0;
+        int32_t constant = -1;
+    };
+
+    // just enough of x86-64 to lower the expressions. only eax, ecx, xmm0..xmm2 are used,
+    //  frame is addressed via rbp, arguments via rbx
+    class X64Emitter {
+    public:
+        vector<uint8_t> code;
+        vector<vec4f>   constants;
+    public:
+        void byte ( uint8_t b ) { code.push_back(b); }
+        void bytes ( std::initializer_list<uint8_t> bl ) { code.insert(code.end(), bl.begin(), bl.end()); }
+        void dword ( uint32_t d ) { for ( int i=0; i!=4; ++i ) byte(uint8_t(d>>(i*8))); }
+        int label() { labels.push_back(-1); return int(labels.size()-1); }
+        void bind ( int l ) { labels[l] = int32_t(code.size()); }
+        int constant ( vec4f value ) {
+            for ( size_t i=0; i!=constants.size(); ++i ) {
+                if ( memcmp(&constants[i], &value, sizeof(vec4f))==0 ) return int(i);
+            }
+            constants.push_back(value);
+            return int(constants.size()-1);
+        }
+        X64Mem constMem ( vec4f value ) { X64Mem m; m.constant = constant(value); return m; }
+        void modrm ( uint8_t reg, const X64Mem & m ) {
+            if ( m.constant>=0 ) {
+                byte(uint8_t(((reg&7)<<3) | 5));            // [rip + disp32]
+                constFixups.push_back(make_pair(uint32_t(code.size()), m.constant));
+                dword(0);
+            } else {
+                byte(uint8_t(0x80 | ((reg&7)<<3) | m.base));  // [base + disp32]
+                dword(uint32_t(m.disp));
+            }
+        }
+        void modrr ( uint8_t reg, uint8_t rm ) { byte(uint8_t(0xC0 | ((reg&7)<<3) | (rm&7))); }
+        // sse with optional prefix, reg <- mem or reg <- reg
+        void sse ( uint8_t prefix, uint8_t op, uint8_t reg, const X64Mem & m ) {
+            if ( prefix ) byte(prefix);
+            byte(0x0F); byte(op); modrm(reg, m);
+        }
+        void sserr ( uint8_t prefix, uint8_t op, uint8_t reg, uint8_t rm ) {
+            if ( prefix ) byte(prefix);
+            byte(0x0F); byte(op); modrr(reg, rm);
+        }
+        void shufps ( uint8_t reg, uint8_t rm, uint8_t imm ) { sserr(0, 0xC6, reg, rm); byte(imm); }
+        void movaps ( uint8_t reg, uint8_t rm ) { sserr(0, 0x28, reg, rm); }
+        void load32 ( uint8_t reg, const X64Mem & m ) { byte(0x8B); modrm(reg, m); }
+        void store32 ( const X64Mem & m, uint8_t reg ) { byte(0x89); modrm(reg, m); }
+        void movImm ( uint8_t reg, uint32_t imm ) { byte(uint8_t(0xB8 + reg)); dword(imm); }
+        void alurr ( uint8_t op, uint8_t dst, uint8_t src ) { byte(op); modrr(src, dst); }  // op r/m32, r32
+        void setcc ( uint8_t cc, uint8_t reg ) { byte(0x0F); byte(uint8_t(0x90 + cc)); modrr(0, reg); }
+        void movzxAl () { bytes({0x0F, 0xB6, 0xC0}); }
+        void testEax () { bytes({0x85, 0xC0}); }
+        void jmp ( int l ) { byte(0xE9); jumpFixups.push_back(make_pair(uint32_t(code.size()), l)); dword(0); }
+        void jcc ( uint8_t cc, int l ) {
+            byte(0x0F); byte(uint8_t(0x80 + cc));
+            jumpFixups.push_back(make_pair(uint32_t(code.size()), l));
+            dword(0);
+        }
+        // resolves labels, and appends the constant pool
+        bool finalize () {
+            for ( auto & fx : jumpFixups ) {
+                if ( labels[fx.second]<0 ) return false;
+                patch(fx.first, labels[fx.second] - int32_t(fx.first + 4));
+            }
+            while ( code.size() & 15 ) byte(0xCC);
+            int32_t pool = int32_t(code.size());
+            for ( auto & c : constants ) {
+                code.insert(code.end(), (uint8_t *)&c, (uint8_t *)&c + sizeof(vec4f));
+            }
+            for ( auto & fx : constFixups ) {
+                patch(fx.first, pool + fx.second*int32_t(sizeof(vec4f)) - int32_t(fx.first + 4));
+            }
+            return true;
+        }
+        void patch ( uint32_t at, int32_t value ) { memcpy(&code[at], &value, sizeof(int32_t)); }
+    protected:
+        vector<int32_t>                 labels;
+        vector<pair<uint32_t,int>>      jumpFixups;
+        vector<pair<uint32_t,int>>      constFixups;
+    };
+
+    // lowers the function body to the machine code. fails on anything it does not know
+    class JitX64Compiler {
+    public:
+        JitX64Compiler ( Function * f ) : func(f) {}
+        bool compile ();
+        X64Emitter  e;
+        string      error;
+    protected:
+        Function *                  func;
+        map<const Variable *,int>   slots;
+        int                         totalSlots = 0;
+        int                         epilogue = -1;
+        vector<pair<int,int>>       loops;      // break, continue
+    protected:
+        bool fail ( const string & what, Expression * expr = nullptr ) {
+            if ( error.empty() ) {
+                error = what;
+                if ( expr ) error += " at " + expr->at.describe();
+            }
+            return false;
+        }
+        static JitKind kindOf ( const TypeDeclPtr & type ) {
+            if ( !type || type->dim.size() ) return JitKind::none;
+            switch ( type->baseType ) {
+            case Type::tBool:   return JitKind::boolean;
+            case Type::tInt:    return JitKind::integer;
+            case Type::tFloat:  return JitKind::floating;
+            case Type::tFloat2:
+            case Type::tFloat3:
+            case Type::tFloat4:
+            case Type::tRange:  return JitKind::vector;
+            default:            return JitKind::none;
+            }
+        }
+        static bool isInt ( JitKind k ) { return k==JitKind::integer || k==JitKind::boolean; }
+        static bool isBuiltin ( Function * fn, const char * moduleName ) {
+            return fn && fn->builtIn && fn->module && fn->module->name==moduleName;
+        }
+        int newSlot () { return totalSlots++; }
+        X64Mem slotMem ( int slot, int ofs = 0 ) const { X64Mem m; m.base = rbp; m.disp = -(32 + slot*16) + ofs; return m; }
+        X64Mem argMem ( int index ) const { X64Mem m; m.base = rbx; m.disp = index*int32_t(sizeof(vec4f)); return m; }
+        // value of the kind, from memory to reg, and back
+        void load ( JitKind k, uint8_t reg, const X64Mem & m ) {
+            switch ( k ) {
+            case JitKind::boolean:
+            case JitKind::integer:  e.load32(reg, m); break;
+            case JitKind::floating: e.sse(0xF3, 0x10, reg, m); break;     // movss
+            default:                e.sse(0, 0x10, reg, m); break;        // movups
+            }
+        }
+        void store ( JitKind k, const X64Mem & m, uint8_t reg ) {
+            switch ( k ) {
+            case JitKind::boolean:
+            case JitKind::integer:  e.store32(m, reg); break;
+            case JitKind::floating: e.sse(0xF3, 0x11, reg, m); break;     // movss
+            default:                e.sse(0, 0x11, reg, m); break;        // movups
+            }
+        }
+        void moveToSecond ( JitKind k ) {
+            if ( isInt(k) ) e.alurr(0x89, rcx, rax);                     // mov ecx, eax
+            else e.movaps(1, 0);                                        // movaps xmm1, xmm0
+        }
+        bool variable ( Expression * expr, X64Mem & m ) {
+            if ( !expr->rtti_isVar() ) return false;
+            auto evar = static_cast<ExprVar *>(expr);
+            if ( evar->block ) return false;
+            auto it = slots.find(evar->variable.get());
+            if ( it!=slots.end() ) {
+                m = slotMem(it->second);
+                return true;
+            }
+            if ( evar->argument ) {
+                m = argMem(evar->argumentIndex);
+                return true;
+            }
+            return false;
+        }
+        // locals, arguments, and constants are loaded directly into the second register
+        bool isSimple ( Expression * expr ) {
+            if ( expr->rtti_isR2V() ) expr = static_cast<ExprRef2Value *>(expr)->subexpr.get();
+            X64Mem m;
+            return expr->rtti_isConstant() || variable(expr, m);
+        }
+        bool loadConst ( ExprConst * c, uint8_t reg ) {
+            auto k = kindOf(c->type);
+            switch ( k ) {
+            case JitKind::boolean:  e.movImm(reg, cast<bool>::to(c->value) ? 1 : 0); return true;
+            case JitKind::integer:  e.movImm(reg, uint32_t(cast<int32_t>::to(c->value))); return true;
+            case JitKind::floating: e.sse(0xF3, 0x10, reg, e.constMem(v_splats(cast<float>::to(c->value)))); return true;
+            case JitKind::vector:   e.sse(0, 0x10, reg, e.constMem(c->value)); return true;
+            default:                return fail("unsupported constant", c);
+            }
+        }
+        bool loadSimple ( Expression * expr, uint8_t reg ) {
+            if ( expr->rtti_isR2V() ) expr = static_cast<ExprRef2Value *>(expr)->subexpr.get();
+            if ( expr->rtti_isConstant() ) return loadConst(static_cast<ExprConst *>(expr), reg);
+            X64Mem m;
+            if ( !variable(expr, m) ) return fail("unsupported variable", expr);
+            load(kindOf(expr->type), reg, m);
+            return true;
+        }
+        // left goes to the first register, right to the second one. evaluation order is left, then right
+        bool operands ( Expression * left, Expression * right ) {
+            if ( isSimple(right) ) {
+                return expr(left) && loadSimple(right, 1);
+            }
+            auto lk = kindOf(left->type);
+            if ( !expr(left) ) return false;
+            int tmp = newSlot();
+            store(lk, slotMem(tmp), 0);
+            if ( !expr(right) ) return false;
+            moveToSecond(kindOf(right->type));
+            load(lk, 0, slotMem(tmp));
+            return true;
+        }
+        void splatResult ( JitKind k ) {
+            if ( isInt(k) ) {
+                e.bytes({0x66, 0x0F, 0x6E, 0xC0});          // movd xmm0, eax
+                e.bytes({0x66, 0x0F, 0x70, 0xC0, 0x00});    // pshufd xmm0, xmm0, 0
+            } else if ( k==JitKind::floating ) {
+                e.shufps(0, 0, 0);
+            }
+        }
+        bool binaryOp ( const string & op, JitKind lk, JitKind rk, Expression * at );
+        bool compare ( const string & op, JitKind k );
+        bool expr ( Expression * ex );
+        bool op1 ( ExprOp1 * ex );
+        bool op2 ( ExprOp2 * ex );
+        bool call ( ExprCall * ex );
+        bool assign ( ExprOp2 * ex );
+        bool stmt ( Expression * ex );
+    };
+
+    bool JitX64Compiler::compare ( const string & op, JitKind k ) {
+        if ( isInt(k) ) {
+            e.alurr(0x39, rax, rcx);                        // cmp eax, ecx
+            uint8_t cc = op=="<" ? cc_l : op=="<=" ? cc_le : op==">" ? cc_g : op==">=" ? cc_ge : op=="==" ? cc_e : cc_ne;
+            e.setcc(cc, rax);
+        } else if ( k==JitKind::floating ) {
+            if ( op=="<" || op=="<=" ) {
+                e.sserr(0, 0x2E, 1, 0);                     // ucomiss xmm1, xmm0
+                e.setcc(op=="<" ? cc_a : cc_ae, rax);
+            } else if ( op==">" || op==">=" ) {
+                e.sserr(0, 0x2E, 0, 1);                     // ucomiss xmm0, xmm1
+                e.setcc(op==">" ? cc_a : cc_ae, rax);
+            } else if ( op=="==" ) {
+                e.sserr(0, 0x2E, 0, 1);
+                e.setcc(cc_e, rax);
+                e.setcc(cc_np, rcx);
+                e.bytes({0x20, 0xC8});                      // and al, cl
+            } else {
+                e.sserr(0, 0x2E, 0, 1);
+                e.setcc(cc_ne, rax);
+                e.setcc(cc_p, rcx);
+                e.bytes({0x08, 0xC8});                      // or al, cl
+            }
+        } else {
+            return false;
+        }
+        e.movzxAl();
+        return true;
+    }
+
+    // first register op= second register
+    bool JitX64Compiler::binaryOp ( const string & op, JitKind lk, JitKind rk, Expression * at ) {
+        if ( op=="<" || op=="<=" || op==">" || op==">=" || op=="==" || op=="!=" ) {
+            if ( lk!=rk || !compare(op, lk) ) return fail("unsupported comparison " + op, at);
+            return true;
+        }
+        if ( isInt(lk) ) {
+            if ( lk!=rk ) return fail("unsupported operation " + op, at);
+            if ( op=="+" ) e.alurr(0x01, rax, rcx);
+            else if ( op=="-" ) e.alurr(0x29, rax, rcx);
+            else if ( op=="*" ) e.bytes({0x0F, 0xAF, 0xC1});   // imul eax, ecx
+            else if ( op=="&" ) e.alurr(0x21, rax, rcx);
+            else if ( op=="|" ) e.alurr(0x09, rax, rcx);
+            else if ( op=="^" ) e.alurr(0x31, rax, rcx);
+            else if ( op=="<<" && lk==JitKind::integer ) e.bytes({0xD3, 0xE0});   // shl eax, cl
+            else if ( op==">>" && lk==JitKind::integer ) e.bytes({0xD3, 0xF8});   // sar eax, cl
+            else return fail("unsupported operation " + op, at);
+            return true;
+        }
+        uint8_t opc = op=="+" ? 0x58 : op=="-" ? 0x5C : op=="*" ? 0x59 : op=="/" ? 0x5E : 0;
+        if ( !opc ) return fail("unsupported operation " + op, at);
+        if ( lk==JitKind::floating && rk==JitKind::floating ) {
+            e.sserr(0xF3, opc, 0, 1);
+        } else if ( lk==JitKind::vector && rk==JitKind::vector ) {
+            e.sserr(0, opc, 0, 1);
+        } else if ( lk==JitKind::vector && rk==JitKind::floating && (op=="*" || op=="/") ) {
+            e.shufps(1, 1, 0);
+            e.sserr(0, opc, 0, 1);
+        } else if ( lk==JitKind::floating && rk==JitKind::vector && (op=="*" || op=="/") ) {
+            e.shufps(0, 0, 0);
+            e.sserr(0, opc, 0, 1);
+        } else {
+            return fail("unsupported operation " + op, at);
+        }
+        return true;
+    }
+
+    bool JitX64Compiler::op1 ( ExprOp1 * ex ) {
+        if ( !isBuiltin(ex->func, "$") ) return fail("operator " + ex->op, ex);
+        auto k = kindOf(ex->subexpr->type);
+        const auto & op = ex->op;
+        if ( op=="++" || op=="--" || op=="+++" || op=="---" ) {
+            X64Mem m;
+            if ( !variable(ex->subexpr.get(), m) || (k!=JitKind::integer && k!=JitKind::floating) ) {
+                return fail("unsupported " + op, ex);
+            }
+            bool post = op.length()==3;
+            bool inc = op[0]=='+';
+            load(k, 0, m);
+            if ( post ) moveToSecond(k);
+            uint8_t reg = post ? 1 : 0;
+            if ( k==JitKind::integer ) {
+                e.bytes({0x83, uint8_t((inc ? 0xC0 : 0xE8) | reg), 0x01});     // add/sub reg, 1
+            } else {
+                e.sse(0xF3, inc ? 0x58 : 0x5C, reg, e.constMem(v_splats(1.0f)));
+            }
+            store(k, m, reg);
+            return true;
+        }
+        if ( !expr(ex->subexpr.get()) ) return false;
+        if ( op=="+" ) {
+            return k==JitKind::integer || k==JitKind::floating || k==JitKind::vector ? true : fail("unsupported +", ex);
+        } else if ( op=="-" ) {
+            if ( k==JitKind::integer ) {
+                e.bytes({0xF7, 0xD8});                                      // neg eax
+            } else if ( k==JitKind::floating || k==JitKind::vector ) {
+                e.sse(0, 0x57, 0, e.constMem(v_cast_vec4f(v_splatsi(int32_t(0x80000000)))));   // xorps
+            } else {
+                return fail("unsupported -", ex);
+            }
+            return true;
+        } else if ( op=="!" && k==JitKind::boolean ) {
+            e.bytes({0x83, 0xF0, 0x01});                                    // xor eax, 1
+            return true;
+        } else if ( op=="~" && k==JitKind::integer ) {
+            e.bytes({0xF7, 0xD0});                                          // not eax
+            return true;
+        }
+        return fail("unsupported operator " + op, ex);
+    }
+
+    bool JitX64Compiler::assign ( ExprOp2 * ex ) {
+        if ( !ex->left->rtti_isVar() || !slots.count(static_cast<ExprVar *>(ex->left.get())->variable.get()) ) {
+            return fail("assignment to anything but local variable", ex);
+        }
+        X64Mem m = slotMem(slots[static_cast<ExprVar *>(ex->left.get())->variable.get()]);
+        auto lk = kindOf(ex->left->type);
+        auto rk = kindOf(ex->right->type);
+        if ( lk==JitKind::none || rk==JitKind::none ) return fail("unsupported type", ex);
+        if ( !expr(ex->right.get()) ) return false;
+        if ( ex->op=="=" || ex->op=="<-" || ex->op==":=" ) {
+            if ( lk!=rk ) return fail("assignment of different types", ex);
+            store(lk, m, 0);
+            return true;
+        }
+        // op=
+        string op = ex->op.substr(0, ex->op.length()-1);
+        if ( lk==JitKind::boolean ) return fail("unsupported operator " + ex->op, ex);
+        moveToSecond(rk);
+        load(lk, 0, m);
+        if ( !binaryOp(op, lk, rk, ex) ) return false;
+        store(lk, m, 0);
+        return true;
+    }
+
+    bool JitX64Compiler::op2 ( ExprOp2 * ex ) {
+        const auto & op = ex->op;
+        if ( op=="=" || op=="<-" || op==":=" ) {
+            return assign(ex);
+        }
+        if ( !isBuiltin(ex->func, "$") ) return fail("operator " + op, ex);
+        if ( op.length()>1 && op.back()=='=' && op!="==" && op!="!=" && op!="<=" && op!=">=" ) {
+            return assign(ex);
+        }
+        auto lk = kindOf(ex->left->type);
+        auto rk = kindOf(ex->right->type);
+        if ( lk==JitKind::none || rk==JitKind::none ) return fail("unsupported type", ex);
+        // boolean && and || short circuit
+        if ( lk==JitKind::boolean && (op=="&" || op=="|") ) {
+            int done = e.label();
+            if ( !expr(ex->left.get()) ) return false;
+            e.testEax();
+            e.jcc(op=="&" ? cc_e : cc_ne, done);
+            if ( !expr(ex->right.get()) ) return false;
+            e.bind(done);
+            return true;
+        }
+        if ( !operands(ex->left.get(), ex->right.get()) ) return false;
+        return binaryOp(op, lk, rk, ex);
+    }
+
+    bool JitX64Compiler::call ( ExprCall * ex ) {
+        auto fn = ex->func;
+        auto rk = kindOf(ex->type);
+        auto nargs = ex->arguments.size();
+        for ( auto & arg : ex->arguments ) {
+            if ( kindOf(arg->type)==JitKind::none ) return fail("unsupported call to " + ex->name, ex);
+        }
+        if ( isBuiltin(fn, "$") ) {
+            if ( fn->name=="int" && nargs<=1 ) {
+                if ( nargs==0 ) { e.alurr(0x31, rax, rax); return true; }
+                auto ak = kindOf(ex->arguments[0]->type);
+                if ( !expr(ex->arguments[0].get()) ) return false;
+                if ( ak==JitKind::floating ) e.bytes({0xF3, 0x0F, 0x2C, 0xC0});   // cvttss2si eax, xmm0
+                else if ( ak!=JitKind::integer ) return fail("unsupported conversion", ex);
+                return true;
+            }
+            if ( fn->name=="float" && nargs<=1 ) {
+                if ( nargs==0 ) { e.sserr(0, 0x57, 0, 0); return true; }
+                auto ak = kindOf(ex->arguments[0]->type);
+                if ( !expr(ex->arguments[0].get()) ) return false;
+                if ( ak==JitKind::integer ) e.bytes({0xF3, 0x0F, 0x2A, 0xC0});    // cvtsi2ss xmm0, eax
+                else if ( ak!=JitKind::floating ) return fail("unsupported conversion", ex);
+                return true;
+            }
+            bool floatCtor = fn->name=="float2" || fn->name=="float3" || fn->name=="float4";
+            if ( (floatCtor || fn->name=="range") && rk==JitKind::vector ) {
+                int components = fn->name=="range" ? 2 : fn->name.back() - '0';
+                int tmp = newSlot();
+                e.sserr(0, 0x57, 0, 0);                                         // xorps xmm0, xmm0
+                store(JitKind::vector, slotMem(tmp), 0);
+                if ( nargs==0 ) return true;
+                if ( nargs!=1 && int(nargs)!=components ) return fail("unsupported constructor", ex);
+                for ( int i=0; i!=components; ++i ) {
+                    if ( i<int(nargs) ) {
+                        auto arg = ex->arguments[i].get();
+                        auto ak = kindOf(arg->type);
+                        if ( !expr(arg) ) return false;
+                        if ( floatCtor && ak==JitKind::integer ) {
+                            e.bytes({0xF3, 0x0F, 0x2A, 0xC0});                  // cvtsi2ss xmm0, eax
+                            ak = JitKind::floating;
+                        }
+                        if ( floatCtor ? ak!=JitKind::floating : ak!=JitKind::integer ) {
+                            return fail("unsupported constructor", ex);
+                        }
+                    }
+                    store(floatCtor ? JitKind::floating : JitKind::integer, slotMem(tmp, i*4), 0);
+                }
+                load(JitKind::vector, 0, slotMem(tmp));
+                return true;
+            }
+        } else if ( isBuiltin(fn, "math") ) {
+            auto ak = nargs ? kindOf(ex->arguments[0]->type) : JitKind::none;
+            if ( fn->name=="sqrt" && nargs==1 && (ak==JitKind::floating || ak==JitKind::vector) ) {
+                if ( !expr(ex->arguments[0].get()) ) return false;
+                e.sserr(ak==JitKind::floating ? 0xF3 : 0, 0x51, 0, 0);
+                return true;
+            }
+            if ( fn->name=="abs" && nargs==1 && (ak==JitKind::floating || ak==JitKind::vector) ) {
+                if ( !expr(ex->arguments[0].get()) ) return false;
+                e.sse(0, 0x54, 0, e.constMem(v_cast_vec4f(v_splatsi(0x7fffffff))));  // andps
+                return true;
+            }
+            if ( (fn->name=="min" || fn->name=="max") && nargs==2 && ak!=JitKind::boolean ) {
+                if ( !operands(ex->arguments[0].get(), ex->arguments[1].get()) ) return false;
+                bool isMin = fn->name=="min";
+                if ( ak==JitKind::integer ) {
+                    e.alurr(0x39, rax, rcx);                                    // cmp eax, ecx
+                    e.bytes({0x0F, uint8_t(isMin ? 0x4F : 0x4C), 0xC1});       // cmovg / cmovl eax, ecx
+                } else {
+                    e.sserr(ak==JitKind::floating ? 0xF3 : 0, isMin ? 0x5D : 0x5F, 0, 1);
+                }
+                return true;
+            }
+            bool isDot = fn->name=="dot" && nargs==2;
+            bool isLength = (fn->name=="length" || fn->name=="lengthSq") && nargs==1;
+            if ( (isDot || isLength) && ak==JitKind::vector ) {
+                auto vt = ex->arguments[0]->type->baseType;
+                int components = vt==Type::tFloat2 ? 2 : vt==Type::tFloat3 ? 3 : 4;
+                if ( isDot ) {
+                    if ( !operands(ex->arguments[0].get(), ex->arguments[1].get()) ) return false;
+                } else {
+                    if ( !expr(ex->arguments[0].get()) ) return false;
+                    e.movaps(1, 0);
+                }
+                e.sserr(0, 0x59, 0, 1);                                         // mulps xmm0, xmm1
+                // x + y + z + w, lanes 1..3 of xmm0 are intact until the end
+                for ( int c=1; c!=components; ++c ) {
+                    e.movaps(1, 0);
+                    e.shufps(1, 1, uint8_t(c*0x55));
+                    e.sserr(0xF3, 0x58, 0, 1);                                  // addss xmm0, xmm1
+                }
+                if ( fn->name=="length" ) e.sserr(0xF3, 0x51, 0, 0);           // sqrtss
+                return true;
+            }
+        }
+        return fail("call to " + ex->name, ex);
+    }
+
+    bool JitX64Compiler::expr ( Expression * ex ) {
+        if ( !ex ) return fail("missing expression");
+        if ( ex->rtti_isR2V() ) {
+            return expr(static_cast<ExprRef2Value *>(ex)->subexpr.get());
+        } else if ( ex->rtti_isConstant() ) {
+            return loadConst(static_cast<ExprConst *>(ex), 0);
+        } else if ( ex->rtti_isVar() ) {
+            X64Mem m;
+            auto k = kindOf(ex->type);
+            if ( k==JitKind::none || !variable(ex, m) ) return fail("unsupported variable", ex);
+            load(k, 0, m);
+            return true;
+        } else if ( ex->rtti_isOp1() ) {
+            return op1(static_cast<ExprOp1 *>(ex));
+        } else if ( ex->rtti_isOp2() ) {
+            return op2(static_cast<ExprOp2 *>(ex));
+        } else if ( ex->rtti_isOp3() ) {
+            auto op3 = static_cast<ExprOp3 *>(ex);
+            if ( kindOf(op3->type)==JitKind::none ) return fail("unsupported type", ex);
+            int other = e.label(), done = e.label();
+            if ( !expr(op3->subexpr.get()) ) return false;
+            e.testEax();
+            e.jcc(cc_e, other);
+            if ( !expr(op3->left.get()) ) return false;
+            e.jmp(done);
+            e.bind(other);
+            if ( !expr(op3->right.get()) ) return false;
+            e.bind(done);
+            return true;
+        } else if ( ex->rtti_isCall() ) {
+            return call(static_cast<ExprCall *>(ex));
+        } else if ( ex->rtti_isSwizzle() ) {
+            auto sw = static_cast<ExprSwizzle *>(ex);
+            if ( kindOf(sw->value->type)!=JitKind::vector || sw->value->type->baseType==Type::tRange ) {
+                return fail("unsupported swizzle", ex);
+            }
+            if ( !expr(sw->value.get()) ) return false;
+            auto fsz = sw->fields.size();
+            uint8_t fs[4];
+            fs[0] = sw->fields[0];
+            fs[1] = fsz >= 2 ? sw->fields[1] : sw->fields[0];
+            fs[2] = fsz >= 3 ? sw->fields[2] : sw->fields[0];
+            fs[3] = fsz >= 4 ? sw->fields[3] : sw->fields[0];
+            e.shufps(0, 0, uint8_t(fs[0] | (fs[1]<<2) | (fs[2]<<4) | (fs[3]<<6)));
+            return true;
+        }
+        return fail("unsupported expression", ex);
+    }
+
+    bool JitX64Compiler::stmt ( Expression * ex ) {
+        if ( ex->rtti_isBlock() ) {
+            auto blk = static_cast<ExprBlock *>(ex);
+            if ( blk->isClosure || blk->finalList.size() ) return fail("block with finally", ex);
+            for ( auto & st : blk->list ) {
+                if ( !stmt(st.get()) ) return false;
+            }
+            return true;
+        } else if ( ex->rtti_isLet() ) {
+            auto let = static_cast<ExprLet *>(ex);
+            for ( auto & var : let->variables ) {
+                auto k = kindOf(var->type);
+                if ( k==JitKind::none || var->type->ref ) return fail("unsupported variable " + var->name, ex);
+                int slot = newSlot();
+                if ( var->init ) {
+                    if ( kindOf(var->init->type)!=k || !expr(var->init.get()) ) return fail("unsupported initialization", ex);
+                    store(k, slotMem(slot), 0);
+                } else {
+                    e.sserr(0, 0x57, 0, 0);                                     // xorps xmm0, xmm0
+                    store(JitKind::vector, slotMem(slot), 0);
+                }
+                slots[var.get()] = slot;
+            }
+            return true;
+        } else if ( ex->rtti_isIfThenElse() ) {
+            auto ite = static_cast<ExprIfThenElse *>(ex);
+            int other = e.label(), done = e.label();
+            if ( !expr(ite->cond.get()) ) return false;
+            e.testEax();
+            e.jcc(cc_e, other);
+            if ( !stmt(ite->if_true.get()) ) return false;
+            if ( ite->if_false ) e.jmp(done);
+            e.bind(other);
+            if ( ite->if_false && !stmt(ite->if_false.get()) ) return false;
+            e.bind(done);
+            return true;
+        } else if ( ex->rtti_isWhile() ) {
+            auto wh = static_cast<ExprWhile *>(ex);
+            int cond = e.label(), done = e.label();
+            e.bind(cond);
+            if ( !expr(wh->cond.get()) ) return false;
+            e.testEax();
+            e.jcc(cc_e, done);
+            loops.push_back(make_pair(done, cond));
+            if ( !stmt(wh->body.get()) ) return false;
+            loops.pop_back();
+            e.jmp(cond);
+            e.bind(done);
+            return true;
+        } else if ( ex->rtti_isFor() ) {
+            auto ef = static_cast<ExprFor *>(ex);
+            if ( ef->sources.size()!=1 || ef->iteratorVariables.size()!=1
+                    || !ef->sources[0]->type || ef->sources[0]->type->baseType!=Type::tRange ) {
+                return fail("for, which is not over the range", ex);
+            }
+            int cond = e.label(), next = e.label(), done = e.label();
+            if ( !expr(ef->sources[0].get()) ) return false;
+            int rng = newSlot(), it = newSlot();
+            store(JitKind::vector, slotMem(rng), 0);
+            slots[ef->iteratorVariables[0].get()] = it;
+            e.load32(rax, slotMem(rng));
+            e.store32(slotMem(it), rax);
+            e.bind(cond);
+            e.load32(rax, slotMem(it));
+            e.byte(0x3B); e.modrm(rax, slotMem(rng, 4));                       // cmp eax, [range.to]
+            e.jcc(cc_ge, done);
+            loops.push_back(make_pair(done, next));
+            if ( !stmt(ef->subexpr.get()) ) return false;
+            loops.pop_back();
+            e.bind(next);
+            e.load32(rax, slotMem(it));
+            e.bytes({0x83, 0xC0, 0x01});                                        // add eax, 1
+            e.store32(slotMem(it), rax);
+            e.jmp(cond);
+            e.bind(done);
+            return true;
+        } else if ( ex->rtti_isReturn() ) {
+            auto ret = static_cast<ExprReturn *>(ex);
+            if ( !ret->subexpr || ret->returnFlags ) return fail("unsupported return", ex);
+            auto k = kindOf(ret->subexpr->type);
+            if ( k==JitKind::none || !expr(ret->subexpr.get()) ) return fail("unsupported return", ex);
+            splatResult(k);
+            e.jmp(epilogue);
+            return true;
+        } else if ( ex->rtti_isBreak() || ex->rtti_isContinue() ) {
+            if ( loops.empty() ) return fail("break outside of the loop", ex);
+            e.jmp(ex->rtti_isBreak() ? loops.back().first : loops.back().second);
+            return true;
+        }
+        // expression, value of which is not used
+        return expr(ex);
+    }
+
+    bool JitX64Compiler::compile () {
+        if ( kindOf(func->result)==JitKind::none || func->result->ref ) {
+            return fail("result type " + func->result->describe());
+        }
+        for ( auto & arg : func->arguments ) {
+            if ( kindOf(arg->type)==JitKind::none || arg->type->ref ) {
+                return fail("argument " + arg->name + " of type " + arg->type->describe());
+            }
+        }
+        epilogue = e.label();
+        e.bytes({0x55, 0x48, 0x89, 0xE5, 0x53});                   // push rbp; mov rbp, rsp; push rbx
+        e.bytes({0x48, 0x81, 0xEC});                                // sub rsp, frame
+        uint32_t frameAt = uint32_t(e.code.size());
+        e.dword(0);
+#if defined(_WIN64)
+        e.bytes({0x48, 0x89, 0xCB});                                // mov rbx, rcx
+#else
+        e.bytes({0x48, 0x89, 0xFB});                                // mov rbx, rdi
+#endif
+        if ( !stmt(func->body.get()) ) return false;
+        e.sserr(0, 0x57, 0, 0);                                     // xorps xmm0, xmm0
+        e.bind(epilogue);
+        e.bytes({0x48, 0x8B, 0x5D, 0xF8, 0xC9, 0xC3});              // mov rbx, [rbp-8]; leave; ret
+        // rsp stays 16 byte aligned
+        e.patch(frameAt, totalSlots*16 + 24);
+        return e.finalize() ? true : fail("unresolved label");
+    }
+
+    JitX64::JitX64 ( const ProgramPtr & prog, Context & ctx ) : program(prog), context(ctx) {
+        int totalFunctions = context.getTotalFunctions();
+        functions.resize(totalFunctions, nullptr);
+        original.resize(totalFunctions, nullptr);
+        state.resize(totalFunctions, JitState::interpreted);
+        program->library.foreach([&](Module * pm){
+            for ( auto & it : pm->functions ) {
+                auto pfun = it.second.get();
+                if ( pfun->index>=0 && pfun->used && pfun->index<totalFunctions ) {
+                    functions[pfun->index] = pfun;
+                }
+            }
+            return true;
+        },"*");
+    }
+
+    JitX64::~JitX64() {
+        for ( int fni=0, fnis=int(state.size()); fni!=fnis; ++fni ) {
+            if ( state[fni]==JitState::compiled ) {
+                context.getFunction(fni)->code = original[fni];
+            }
+        }
+        for ( auto & mem : memory ) {
+            os_free_exec(mem.first, mem.second);
+        }
+    }
+
+    bool JitX64::supported() {
+#if defined(_M_X64) || defined(__x86_64__)
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    bool JitX64::compiled ( int fnIndex ) const {
+        return fnIndex>=0 && fnIndex<int(state.size()) && state[fnIndex]==JitState::compiled;
+    }
+
+    int JitX64::compile ( TextWriter & logs, bool verbose ) {
+        int count = 0;
+        for ( int fni=0, fnis=int(state.size()); fni!=fnis; ++fni ) {
+            if ( compile(fni, logs, verbose) ) {
+                count ++;
+            }
+        }
+        return count;
+    }
+
+    bool JitX64::compile ( int fnIndex, TextWriter & logs, bool verbose ) {
+        if ( fnIndex<0 || fnIndex>=int(state.size()) || state[fnIndex]!=JitState::interpreted ) {
+            return false;
+        }
+        auto simFn = context.getFunction(fnIndex);
+        auto pfun = functions[fnIndex];
+        state[fnIndex] = JitState::failed;
+        if ( !supported() || !pfun || pfun->builtIn || !pfun->body || simFn->aot ) {
+            return false;
+        }
+        JitX64Compiler cc(pfun);
+        if ( !cc.compile() ) {
+            if ( verbose ) {
+                logs << pfun->getMangledName() << " stays interpreted, " << cc.error << "\n";
+            }
+            return false;
+        }
+        size_t size = cc.e.code.size();
+        void * mem = os_alloc_exec(size);
+        if ( !mem ) {
+            logs << "can't allocate executable memory\n";
+            return false;
+        }
+        memcpy(mem, cc.e.code.data(), size);
+        if ( !os_protect_exec(mem, size) ) {
+            os_free_exec(mem, size);
+            logs << "can't make memory executable\n";
+            return false;
+        }
+        memory.push_back(make_pair(mem, size));
+        original[fnIndex] = simFn->code;
+        simFn->code = context.code->makeNode<SimNode_JitX64>(simFn->code->debugInfo, (JitX64Function)mem);
+        state[fnIndex] = JitState::compiled;
+        totalJit ++;
+        if ( verbose ) {
+            logs << pfun->getMangledName() << " compiled, " << uint32_t(size) << " bytes\n";
+        }
+        return true;
+    }
+}
+
@@ -250,7 +250,37 @@ namespace das {
         return it != callThis.end() ? &it->second : nullptr;
     }
 
+    // embedded sources are only compiled, when something gets compiled for the first time.
+    // processes, which only instantiate context images, or never compile anything, never pay for it
     bool Module::compileBuiltinModule ( const string & modName, unsigned char * str, unsigned int str_len ) {
+        builtinSources.push_back({modName, str, str_len});
+        return true;
+    }
+
+    bool Module::compilingBuiltinModules = false;
+
+    void Module::compileBuiltinModules() {
+        if ( compilingBuiltinModules ) return;
+        compilingBuiltinModules = true;
+        vector<Module *> pending;
+        for ( auto m = modules; m != nullptr; m = m->next ) {
+            if ( !m->builtinSources.empty() ) {
+                pending.push_back(m);
+            }
+        }
+        // in the order of registration, so that modules can use what was registered before them
+        reverse(pending.begin(), pending.end());
+        for ( auto m : pending ) {
+            auto sources = move(m->builtinSources);
+            m->builtinSources.clear();
+            for ( auto & src : sources ) {
+                m->compileBuiltinSource(src.name, src.str, src.length);
+            }
+        }
+        compilingBuiltinModules = false;
+    }
+
+    bool Module::compileBuiltinSource ( const string & modName, unsigned char * str, unsigned int str_len ) {
         TextWriter issues;
         str[str_len-1] = 0;//replace last symbol with null terminating. fixme: This is sloppy, and assumes there is something to replace!
         auto access = make_shared<FileAccess>();
@@ -116,6 +116,7 @@ namespace das {
 
     ProgramPtr parseDaScript ( const string & fileName, const FileAccessPtr & access, TextWriter & logs, ModuleGroup & libGroup, bool exportAll ) {
         auto time0 = ref_time_ticks();
+        Module::compileBuiltinModules();
         int err;
         auto program = g_Program = make_shared<Program>();
         g_Access = access;
@@ -178,9 +179,69 @@ namespace das {
         }
     }
 
-    ProgramPtr compileDaScript ( const string & fileName, const FileAccessPtr & access, TextWriter & logs, ModuleGroup & libGroup, bool exportAll ) {
+    ProgramPtr ProgramCache::find ( uint64_t key ) {
+        auto it = programs.find(key);
+        if ( it != programs.end() ) {
+            hits ++;
+            return it->second.program;
+        } else {
+            misses ++;
+            return nullptr;
+        }
+    }
+
+    void ProgramCache::add ( uint64_t key, const ProgramPtr & program, unique_ptr<ModuleGroup> && group, const FileAccessPtr & access ) {
+        auto & cp = programs[key];
+        cp.program.reset();
+        cp.group = move(group);
+        cp.access = access;
+        cp.program = program;
+    }
+
+    // FNV-1a
+    static void hashProgramSource ( uint64_t & hash, const char * data, uint32_t size ) {
+        for ( uint32_t i=0; i!=size; ++i ) {
+            hash = ( hash ^ uint8_t(data[i]) ) * 1099511628211ull;
+        }
+    }
+
+    // name and text of the main file, and of all the modules it requires
+    static uint64_t getProgramSourceHash ( const string & fileName, const FileAccessPtr & access, const vector<string> & req, bool exportAll ) {
+        uint64_t hash = 14695981039346656037ull;
+        hashProgramSource(hash, exportAll ? "export" : "local", exportAll ? 6 : 5);
+        auto hashFile = [&]( const string & fn ) {
+            hashProgramSource(hash, fn.c_str(), uint32_t(fn.length()+1));
+            if ( auto fi = access->getFileInfo(fn) ) {
+                hashProgramSource(hash, fi->source, fi->sourceLength);
+            }
+        };
+        hashFile(fileName);
+        for ( auto & mod : req ) {
+            hashFile(access->getIncludeFileName(fileName, mod) + ".das");
+        }
+        return hash;
+    }
+
+    ProgramPtr compileDaScript ( const string & fileName, const FileAccessPtr & access, TextWriter & logs, ModuleGroup & libGroup,
+                                bool exportAll, ProgramCache * cache ) {
         vector<string> req, missing;
         if ( getPrerequisits(fileName, access, req, missing, libGroup) ) {
+            if ( cache ) {
+                auto key = getProgramSourceHash(fileName, access, req, exportAll);
+                if ( auto program = cache->find(key) ) {
+                    // functions and globals of the shared modules are marked and indexed per program. restore them for this one
+                    if ( !program->failed() ) {
+                        program->markOrRemoveUnusedSymbols(exportAll);
+                        program->allocateIndices(logs);
+                    }
+                    return program;
+                }
+                // failed programs are cached too, same sources fail the same way
+                auto group = make_unique<ModuleGroup>();
+                auto program = compileDaScript(fileName, access, logs, *group, exportAll);
+                cache->add(key, program, move(group), access);
+                return program;
+            }
             reverse(req.begin(), req.end());
             for ( auto & mod : req ) {
                 if ( !libGroup.findModule(mod) ) {
@@ -318,9 +318,65 @@ namespace das
         }
     }
 
+    // int, float, and pointer are passed and returned via the typed eval
+    static Type scalarType ( const TypeDeclPtr & type ) {
+        if ( type->isRef() || type->dim.size() ) {
+            return Type::none;
+        }
+        switch ( type->baseType ) {
+            case Type::tInt:        return Type::tInt;
+            case Type::tFloat:      return Type::tFloat;
+            case Type::tPointer:
+            case Type::tString:     return Type::tPointer;
+            default:                return Type::none;
+        }
+    }
+
+    template <template <int,typename> class CallNode, typename ArgT>
+    static SimNode * makeCallScalarNode ( Context & context, int nArg, const LineInfo & at ) {
+        switch ( nArg ) {
+            case 1: return context.code->makeNode<CallNode<1,ArgT>>(at);
+            case 2: return context.code->makeNode<CallNode<2,ArgT>>(at);
+            case 3: return context.code->makeNode<CallNode<3,ArgT>>(at);
+            case 4: return context.code->makeNode<CallNode<4,ArgT>>(at);
+            default: return nullptr;
+        }
+    }
+
+    template <template <int,typename> class CallNode>
+    static SimNode * makeCallScalarNode ( Context & context, Type argType, int nArg, const LineInfo & at ) {
+        switch ( argType ) {
+            case Type::tInt:        return makeCallScalarNode<CallNode,int32_t>(context, nArg, at);
+            case Type::tFloat:      return makeCallScalarNode<CallNode,float>(context, nArg, at);
+            case Type::tPointer:    return makeCallScalarNode<CallNode,char *>(context, nArg, at);
+            default:                return nullptr;
+        }
+    }
+
+    // call to the function with 1 to 4 arguments of the same scalar type
+    static SimNode * makeCallScalar ( Context & context, const Function * fn, bool fast ) {
+        int nArg = int(fn->arguments.size());
+        if ( nArg<1 || nArg>4 ) {
+            return nullptr;
+        }
+        auto argType = scalarType(fn->arguments[0]->type);
+        for ( auto & arg : fn->arguments ) {
+            if ( scalarType(arg->type)!=argType ) {
+                return nullptr;
+            }
+        }
+        if ( fast ) {
+            return makeCallScalarNode<SimNode_FastCallScalar>(context, argType, nArg, fn->at);
+        } else {
+            return makeCallScalarNode<SimNode_CallScalar>(context, argType, nArg, fn->at);
+        }
+    }
+
     SimNode * Function::makeSimNode ( Context & context ) {
         if ( copyOnReturn || moveOnReturn ) {
             return context.code->makeNodeUnroll<SimNode_CallAndCopyOrMove>(int(arguments.size()), at);
+        } else if ( auto scalarCall = makeCallScalar(context, this, fastCall) ) {
+            return scalarCall;
         } else if ( fastCall ) {
             return context.code->makeNodeUnroll<SimNode_FastCall>(int(arguments.size()), at);
         } else {
@@ -711,6 +767,12 @@ namespace das
                                                context.code->allocateString(message));
     }
 
+    SimNode * ExprIterAdapter::simulate (Context & context) const {
+        DAS_ASSERTF(0, "we should not be here ever, ExprIterAdapter should be fused into the for loop by the parser.");
+        context.thisProgram->error("internal compilation error, generating node for ExprIterAdapter", at);
+        return nullptr;
+    }
+
     SimNode * ExprMakeLambda::simulate (Context & context) const {
         DAS_ASSERTF(0, "we should not be here ever, ExprMakeLambda should completly fold during type inference.");
         context.thisProgram->error("internal compilation error, generating node for ExprMakeLambda", at);
@@ -914,6 +976,8 @@ namespace das
             return nullptr;
         } else if ( subexpr->type->isGoodTableType() ) {
             return nullptr;
+        } else if ( index->type->isSimpleType(Type::tRange) && !subexpr->type->isHandle() ) {
+            return nullptr;
         } else if ( subexpr->type->isHandle() ) {
             SimNode * result;
             if ( r2vType!=Type::none ) {
@@ -939,6 +1003,14 @@ namespace das
             } else {
                 return context.code->makeNode<SimNode_ArrayAt>(at, prv, pidx, stride, extraOffset);
             }
+        } else if ( subexpr->type->isGoodSliceType() ) {
+            auto prv = subexpr->simulate(context);
+            auto pidx = index->simulate(context);
+            if ( r2vType!=Type::none ) {
+                return context.code->makeValueNode<SimNode_SliceAtR2V>(r2vType, at, prv, pidx, extraOffset);
+            } else {
+                return context.code->makeNode<SimNode_SliceAt>(at, prv, pidx, extraOffset);
+            }
         } else if ( subexpr->type->isPointer() ) {
             uint32_t range = 0xffffffff;
             uint32_t stride = subexpr->type->firstType->getSizeOf();
@@ -977,8 +1049,20 @@ namespace das
     }
 
     SimNode * ExprAt::simulate (Context & context) const {
-
-        if ( subexpr->type->isVectorType() ) {
+        if ( index->type->isSimpleType(Type::tRange) && !subexpr->type->isHandle() ) {
+            auto prv = subexpr->simulate(context);
+            auto pidx = index->simulate(context);
+            if ( subexpr->type->isGoodSliceType() ) {
+                return context.code->makeNode<SimNode_SliceSlice>(at, prv, pidx);
+            } else if ( subexpr->type->isGoodArrayType() ) {
+                uint32_t stride = subexpr->type->firstType->getSizeOf();
+                return context.code->makeNode<SimNode_ArraySlice>(at, prv, pidx, stride);
+            } else {
+                uint32_t size = subexpr->type->dim.back();
+                uint32_t stride = subexpr->type->getStride();
+                return context.code->makeNode<SimNode_FixedArraySlice>(at, prv, pidx, size, stride);
+            }
+        } else if ( subexpr->type->isVectorType() ) {
             auto prv = subexpr->simulate(context);
             auto pidx = index->simulate(context);
             uint32_t range = subexpr->type->getVectorDim();
@@ -1217,7 +1301,12 @@ namespace das
     }
 
     SimNode * ExprStringBuilder::simulate (Context & context) const {
-        SimNode_StringBuilder * pSB = context.code->makeNode<SimNode_StringBuilder>(at);
+        SimNode_StringBuilder * pSB;
+        if ( isScalar() ) {
+            pSB = context.code->makeNode<SimNode_StringBuilderScalar>(at);
+        } else {
+            pSB = context.code->makeNode<SimNode_StringBuilder>(at);
+        }
         if ( int nArg = (int) elements.size() ) {
             pSB->arguments = (SimNode **) context.code->allocate(nArg * sizeof(SimNode *));
             pSB->types = (TypeInfo **) context.code->allocate(nArg * sizeof(TypeInfo *));
@@ -1473,6 +1562,12 @@ namespace das
             } else if ( func && func->moveOnReturn ) {
                 return context.code->makeNode<SimNode_ReturnAndMove>(at, simSubE, subexpr->type->getSizeOf());
             }
+            switch ( scalarType(subexpr->type) ) {
+                case Type::tInt:        return context.code->makeNode<SimNode_ReturnScalar<int32_t>>(at, simSubE);
+                case Type::tFloat:      return context.code->makeNode<SimNode_ReturnScalar<float>>(at, simSubE);
+                case Type::tPointer:    return context.code->makeNode<SimNode_ReturnScalar<char *>>(at, simSubE);
+                default:                break;
+            }
         }
         return context.code->makeNode<SimNode_Return>(at, simSubE);
     }
@@ -1547,6 +1642,7 @@ namespace das
         bool nativeIterators = false;
         bool fixedArrays = false;
         bool dynamicArrays = false;
+        bool slices = false;
         bool stringChars = false;
         bool rangeBase = false;
         int32_t fixedSize = INT32_MAX;
@@ -1557,6 +1653,8 @@ namespace das
                 fixedArrays = true;
             } else if ( src->type->isGoodArrayType() ) {
                 dynamicArrays = true;
+            } else if ( src->type->isGoodSliceType() ) {
+                slices = true;
             } else if ( src->type->isGoodIteratorType() ) {
                 nativeIterators = true;
             } else if ( src->type->isHandle() ) {
@@ -1569,7 +1667,7 @@ namespace das
         }
         // create loops based on
         int  total = int(sources.size());
-        int  sourceTypes = int(dynamicArrays) + int(fixedArrays) + int(rangeBase) + int(stringChars);
+        int  sourceTypes = int(dynamicArrays) + int(slices) + int(fixedArrays) + int(rangeBase) + int(stringChars);
         bool hybridRange = rangeBase && (total>1);
         if ( (sourceTypes>1) || hybridRange || nativeIterators || stringChars ) {
             SimNode_ForWithIteratorBase * result = (SimNode_ForWithIteratorBase *)
@@ -1582,6 +1680,10 @@ namespace das
                         sources[t]->at,
                         sources[t]->simulate(context),
                         sources[t]->type->firstType->getStride());
+                } else if ( sources[t]->type->isGoodSliceType() ) {
+                    result->source_iterators[t] = context.code->makeNode<SimNode_SliceIterator>(
+                        sources[t]->at,
+                        sources[t]->simulate(context));
                 } else if ( sources[t]->type->isRange() ) {
                     result->source_iterators[t] = context.code->makeNode<SimNode_RangeIterator>(
                         sources[t]->at,
@@ -1629,6 +1731,12 @@ namespace das
                 } else {
                     result = (SimNode_ForBase *) context.code->makeNodeUnroll<SimNode_ForGoodArray>(total, at);
                 }
+            } else if ( slices ) {
+                if (loop1) {
+                    result = (SimNode_ForBase *) context.code->makeNodeUnroll<SimNode_ForSlice1>(total, at);
+                } else {
+                    result = (SimNode_ForBase *) context.code->makeNodeUnroll<SimNode_ForSlice>(total, at);
+                }
             } else if ( fixedArrays ) {
                 if (loop1) {
                     result = (SimNode_ForBase *)context.code->makeNodeUnroll<SimNode_ForFixedArray1>(total, at);
@@ -1657,7 +1765,7 @@ namespace das
             }
             for ( int t=0; t!=total; ++t ) {
                 result->sources[t] = sources[t]->simulate(context);
-                if ( sources[t]->type->isGoodArrayType() ) {
+                if ( sources[t]->type->isGoodArrayType() || sources[t]->type->isGoodSliceType() ) {
                     result->strides[t] = sources[t]->type->firstType->getStride();
                 } else {
                     result->strides[t] = sources[t]->type->getStride();
@@ -1834,6 +1942,49 @@ namespace das
         }
     }
 
+    static void simulateSimFunction ( Context & context, DebugInfoHelper & helper, Function * pfun ) {
+        auto & gfun = *context.getFunction(pfun->index);
+        auto mangledName = pfun->getMangledName();
+        gfun.name = context.code->allocateName(pfun->name);
+        gfun.mangledName = context.code->allocateName(mangledName);
+        gfun.code = pfun->simulate(context);
+        gfun.debugInfo = helper.makeFunctionDebugInfo(*pfun);
+        gfun.stackSize = pfun->totalStackSize;
+        gfun.mangledNameHash = hash_blockz32((uint8_t *)mangledName.c_str());
+        gfun.flags = 0;
+        gfun.fastcall = pfun->fastCall;
+    }
+
+    // context for the compilation time evaluation. functions are simulated on demand, globals are not initialized
+    void Program::simulateForFolding ( Context & context ) {
+        context.globalVariables = (GlobalVariable *) context.code->allocate( totalVariables*sizeof(GlobalVariable) );
+        memset ( context.globalVariables, 0, totalVariables*sizeof(GlobalVariable) );
+        context.totalVariables = totalVariables;
+        context.functions = (SimFunction *) context.code->allocate( totalFunctions*sizeof(SimFunction) );
+        memset ( context.functions, 0, totalFunctions*sizeof(SimFunction) );
+        context.totalFunctions = totalFunctions;
+    }
+
+    // simulates the function, and everything it calls
+    void Program::simulateFunctionForFolding ( Context & context, Function * fn ) {
+        context.thisProgram = this;
+        DebugInfoHelper helper(context.debugInfo);
+        context.thisHelper = &helper;
+        vector<Function *> stack = { fn };
+        while ( !stack.empty() ) {
+            auto pfun = stack.back();
+            stack.pop_back();
+            if ( pfun->builtIn || pfun->index<0 || context.getFunction(pfun->index)->code ) {
+                continue;
+            }
+            simulateSimFunction(context, helper, pfun);
+            for ( auto dep : pfun->useFunctions ) {
+                stack.push_back(dep);
+            }
+        }
+        context.simEnd();
+    }
+
     bool Program::simulate ( Context & context, TextWriter & logs ) {
         context.thisProgram = this;
         if ( auto optHeap = options.find("heap",Type::tInt) ) {
@@ -1867,16 +2018,7 @@ namespace das
                 auto pfun = it.second;
                 if (pfun->index < 0 || !pfun->used)
                     continue;
-                auto & gfun = context.functions[pfun->index];
-                auto mangledName = pfun->getMangledName();
-                gfun.name = context.code->allocateName(pfun->name);
-                gfun.mangledName = context.code->allocateName(mangledName);
-                gfun.code = pfun->simulate(context);
-                gfun.debugInfo = helper.makeFunctionDebugInfo(*pfun);
-                gfun.stackSize = pfun->totalStackSize;
-                gfun.mangledNameHash = hash_blockz32((uint8_t *)mangledName.c_str());
-                gfun.flags = 0;
-                gfun.fastcall = pfun->fastCall;
+                simulateSimFunction(context, helper, pfun.get());
             }
         }
         for (auto & pm : library.modules ) {
@@ -1918,7 +2060,7 @@ namespace das
         return errors.size() == 0;
     }
 
-    void Program::linkCppAot ( Context & context, AotLibrary & aotLib, TextWriter & logs ) {
+    vector<AotFactory> Program::findCppAot ( Context & context, AotLibrary & aotLib, TextWriter & logs ) {
         bool logIt = options.getOption("logAot",false);
 
         // make list of functions
@@ -1932,20 +2074,59 @@ namespace das
             }
         }
 
+        // semantic hash of every function, to verify dependencies
+        vector<uint64_t> semHashes(context.totalFunctions);
+        map<uint32_t,uint64_t> semHashByName;
+        for ( int fni=0; fni!=context.totalFunctions; ++fni ) {
+            SimFunction & fn = context.functions[fni];
+            // code of the function, which is already linked, is not the one the hash is for
+            uint64_t semHash = fn.aot ? fnn[fni]->hash : getFunctionHash(fnn[fni], fn.code);
+            fnn[fni]->hash = semHash;
+            semHashes[fni] = semHash;
+            semHashByName[fn.mangledNameHash] = semHash;
+        }
+        vector<AotFactory> factories(context.totalFunctions);
         for ( int fni=0; fni!=context.totalFunctions; ++fni ) {
             if ( !fnn[fni]->noAot ) {
                 SimFunction & fn = context.functions[fni];
-                uint64_t semHash = getFunctionHash(fnn[fni], fn.code);
+                uint64_t semHash = semHashes[fni];
                 auto it = aotLib.find(semHash);
                 if ( it != aotLib.end() ) {
-                    fn.code = (it->second)(context);
-                    fn.aot = true;
+                    auto itd = aotLib.dependencies.find(semHash);
+                    if ( itd != aotLib.dependencies.end() ) {
+                        bool changed = false;
+                        for ( auto & dep : itd->second ) {
+                            auto itn = semHashByName.find(dep.mangledNameHash);
+                            if ( itn==semHashByName.end() || itn->second!=dep.semanticHash ) {
+                                changed = true;
+                                break;
+                            }
+                        }
+                        if ( changed ) {
+                            if ( logIt ) logs << "DEPENDENCY CHANGED " << fn.name << " AOT=0x" << HEX << semHash << DEC << "\n";
+                            continue;
+                        }
+                    }
+                    factories[fni] = it->second;
                     if ( logIt ) logs << fn.name << " AOT=0x" << HEX << semHash << DEC << "\n";
                 } else {
                     if ( logIt ) logs << "NOT FOUND " << fn.name << " AOT=0x" << HEX << semHash << DEC << "\n";
                 }
             }
         }
+        return factories;
+    }
+
+    void Program::linkCppAot ( Context & context, AotLibrary & aotLib, TextWriter & logs ) {
+        bool logIt = options.getOption("logAot",false);
+        auto factories = findCppAot(context, aotLib, logs);
+        for ( int fni=0; fni!=context.totalFunctions; ++fni ) {
+            if ( factories[fni] ) {
+                SimFunction & fn = context.functions[fni];
+                fn.code = factories[fni](context);
+                fn.aot = true;
+            }
+        }
         if ( context.totalVariables ) {
             uint64_t semHash = context.getInitSemanticHash();
             auto it = aotLib.find(semHash);
@@ -1957,4 +2138,25 @@ namespace das
             }
         }
     }
+
+    bool Program::makeImage ( Context & context, ContextImage & image, TextWriter & logs ) {
+        // pointers are told apart from the data by comparing two simulations of the same program
+        Context second;
+        TextWriter secondLogs;
+        if ( !simulate(second, secondLogs) ) {
+            logs << secondLogs.str();
+            return false;
+        }
+        // only registered modules can be found by name, when the image is instantiated
+        ContextImage::Symbols symbols;
+        library.foreach([&](Module * pm) -> bool {
+            if ( pm->name.empty() || Module::require(pm->name)!=pm ) return true;
+            symbols.modules.push_back(pm);
+            for ( auto & ah : pm->handleTypes ) {
+                symbols.annotations.push_back(ah.second.get());
+            }
+            return true;
+        }, "*");
+        return image.build(context, second, symbols, logs);
+    }
 }
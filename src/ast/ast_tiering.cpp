@@ -0,0 +1,201 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/ast/ast_tiering.h"
+
+#include "daScript/simulate/simulate_fusion.h"
+#include "daScript/simulate/simulate_visit_op.h"
+
+namespace das {
+
+    // counts calls of the function, until it gets to the last tier
+    struct SimNode_TierCounter : SimNode {
+        SimNode_TierCounter ( SimNode * c ) : SimNode(c->debugInfo), code(c) {}
+        virtual vec4f eval ( Context & context ) override {
+            calls ++;
+            return code->eval(context);
+        }
+        virtual SimNode * visit ( SimVisitor & vis ) override {
+            V_BEGIN();
+            V_OP(TierCounter);
+            V_SUB(code);
+            V_END();
+        }
+        SimNode *   code;
+        uint64_t    calls = 0;
+    };
+
+    // counts iterations of the loop, by wrapping the first expression of its body
+    struct SimNode_TierLoopCounter : SimNode {
+        SimNode_TierLoopCounter ( SimNode * c, uint64_t * l ) : SimNode(c->debugInfo), code(c), loops(l) {}
+        virtual vec4f eval ( Context & context ) override {
+            (*loops) ++;
+            return code->eval(context);
+        }
+        virtual SimNode * visit ( SimVisitor & vis ) override {
+            V_BEGIN();
+            V_OP(TierLoopCounter);
+            V_SUB(code);
+            V_END();
+        }
+        SimNode *   code;
+        uint64_t *  loops;
+    };
+
+    // bodies of all the loops are visited as the 'list', or as the 'list[0]' when there is only one expression
+    struct TierLoopInstrument : SimVisitor {
+        TierLoopInstrument ( Context & ctx, uint64_t * l, set<SimNode *> & c ) : context(ctx), loops(l), counters(c) {}
+        virtual void sub ( SimNode ** nodes, uint32_t count, const char * argN ) override {
+            SimVisitor::sub(nodes, count, argN);
+            if ( count && strcmp(argN,"list")==0 ) {
+                nodes[0] = wrap(nodes[0]);
+            }
+        }
+        virtual SimNode * sub ( SimNode * node, const char * opN ) override {
+            node = SimVisitor::sub(node, opN);
+            return strcmp(opN,"list[0]")==0 ? wrap(node) : node;
+        }
+        SimNode * wrap ( SimNode * node ) {
+            auto counter = context.code->makeNode<SimNode_TierLoopCounter>(node, loops);
+            counters.insert(counter);
+            return counter;
+        }
+        Context &           context;
+        uint64_t *          loops;
+        set<SimNode *> &    counters;
+    };
+
+    struct TierStrip : SimVisitor {
+        TierStrip ( set<SimNode *> & c ) : counters(c) {}
+        virtual SimNode * visit ( SimNode * node ) override {
+            if ( counters.find(node)!=counters.end() ) {
+                counters.erase(node);
+                return static_cast<SimNode_TierLoopCounter *>(node)->code;
+            }
+            return node;
+        }
+        set<SimNode *> &    counters;
+    };
+
+    TieredExecution::TieredExecution ( const ProgramPtr & prog, Context & ctx, const TieringOptions & opt )
+        : program(prog), context(ctx), options(opt) {
+        TextWriter logs;
+        vector<AotFactory> factories;
+        if ( options.aotLib ) {
+            factories = program->findCppAot(context, *options.aotLib, logs);
+        }
+        if ( options.nativeJit && JitX64::supported() ) {
+            jit = make_unique<JitX64>(program, context);
+        }
+        auto startTier = program->options.getOption("fusion",true) ? ExecutionTier::fused : ExecutionTier::interpreted;
+        int totalFunctions = context.getTotalFunctions();
+        functions.resize(totalFunctions);
+        for ( int fni=0; fni!=totalFunctions; ++fni ) {
+            auto & tf = functions[fni];
+            if ( context.getFunction(fni)->aot ) {
+                tf.tier = ExecutionTier::aot;
+                tf.final = true;
+                continue;
+            }
+            tf.tier = startTier;
+            if ( fni<int(factories.size()) ) {
+                tf.aot = factories[fni];
+            }
+            tf.final = tf.tier==ExecutionTier::fused && !tf.aot && !jit;
+            if ( !tf.final ) {
+                instrument(fni);
+            }
+        }
+        updateStats();
+    }
+
+    TieredExecution::~TieredExecution() {
+        for ( int fni=0, fnis=int(functions.size()); fni!=fnis; ++fni ) {
+            strip(fni);
+        }
+        jit.reset();
+        context.functionsPerTier.clear();
+    }
+
+    uint64_t TieredExecution::hotness ( int fnIndex ) const {
+        auto & tf = functions[fnIndex];
+        return tf.counter ? tf.counter->calls + tf.loops : 0;
+    }
+
+    void TieredExecution::instrument ( int fnIndex ) {
+        auto & tf = functions[fnIndex];
+        auto simFn = context.getFunction(fnIndex);
+        TierLoopInstrument loops(context, &tf.loops, loopCounters);
+        simFn->code = simFn->code->visit(loops);
+        tf.counter = context.code->makeNode<SimNode_TierCounter>(simFn->code);
+        simFn->code = tf.counter;
+    }
+
+    void TieredExecution::strip ( int fnIndex ) {
+        auto & tf = functions[fnIndex];
+        if ( !tf.counter ) {
+            return;
+        }
+        auto simFn = context.getFunction(fnIndex);
+        simFn->code = tf.counter->code;
+        TierStrip stripLoops(loopCounters);
+        simFn->code = simFn->code->visit(stripLoops);
+        tf.counter = nullptr;
+    }
+
+    void TieredExecution::promote ( int fnIndex, TextWriter & logs ) {
+        auto & tf = functions[fnIndex];
+        auto simFn = context.getFunction(fnIndex);
+        auto hot = hotness(fnIndex);
+        auto wasTier = tf.tier;
+        strip(fnIndex);
+        if ( tf.tier==ExecutionTier::interpreted ) {
+            fusion(context, simFn, logs);
+            tf.tier = ExecutionTier::fused;
+        }
+        if ( hot>=options.nativeAt ) {
+            if ( tf.aot ) {
+                simFn->code = tf.aot(context);
+                simFn->aot = true;
+                tf.tier = ExecutionTier::aot;
+            } else if ( jit && jit->compile(fnIndex, logs) ) {
+                tf.tier = ExecutionTier::jit;
+            }
+            tf.final = true;
+        }
+        if ( !tf.final ) {
+            instrument(fnIndex);
+        }
+        if ( tf.tier!=wasTier ) {
+            totalPromotions ++;
+            if ( program->options.getOption("logTiering",false) ) {
+                logs << simFn->mangledName << " " << int(wasTier) << " -> " << int(tf.tier) << " after " << hot << "\n";
+            }
+        }
+    }
+
+    int TieredExecution::update ( TextWriter & logs ) {
+        DAS_ASSERTF(context.insideContext==0,"tiers can only change between the evaluations");
+        int promoted = totalPromotions;
+        for ( int fni=0, fnis=int(functions.size()); fni!=fnis; ++fni ) {
+            auto & tf = functions[fni];
+            if ( tf.final ) {
+                continue;
+            }
+            auto hot = hotness(fni);
+            if ( hot>=options.nativeAt || (tf.tier==ExecutionTier::interpreted && hot>=options.fuseAt) ) {
+                promote(fni, logs);
+            }
+        }
+        updateStats();
+        return totalPromotions - promoted;
+    }
+
+    void TieredExecution::updateStats() {
+        context.functionsPerTier.clear();
+        context.functionsPerTier.resize(size_t(ExecutionTier::total), 0);
+        for ( auto & tf : functions ) {
+            context.functionsPerTier[size_t(tf.tier)] ++;
+        }
+    }
+}
+
@@ -52,7 +52,7 @@ namespace das
         TT->constant = (TT->constant | autoT->constant) && !autoT->removeConstant;
         if ( autoT->isPointer() ) {
             applyAutoContracts(TT->firstType, autoT->firstType);
-        } else if ( autoT->baseType==Type::tArray ) {
+        } else if ( autoT->baseType==Type::tArray || autoT->baseType==Type::tSlice ) {
             applyAutoContracts(TT->firstType, autoT->firstType);
         } else if ( autoT->baseType==Type::tTable ) {
             applyAutoContracts(TT->firstType, autoT->firstType);
@@ -101,6 +101,9 @@ namespace das
         // array has to match array
         if ( autoT->baseType==Type::tArray && (initT->baseType!=Type::tArray || !initT->firstType) )
             return nullptr;
+        // slice has to match slice
+        if ( autoT->baseType==Type::tSlice && (initT->baseType!=Type::tSlice || !initT->firstType) )
+            return nullptr;
         // table has to match table
         if ( autoT->baseType==Type::tTable && (initT->baseType!=Type::tTable || !initT->firstType || !initT->secondType) )
             return nullptr;
@@ -122,8 +125,8 @@ namespace das
             // if it's a pointer, infer pointer-to separately
             TT->firstType = inferAutoType(autoT->firstType, initT->firstType);
             if ( !TT->firstType ) return nullptr;
-        } else if ( autoT->baseType==Type::tArray ) {
-            // if it's an array, infer array type separately
+        } else if ( autoT->baseType==Type::tArray || autoT->baseType==Type::tSlice ) {
+            // if it's an array or a slice, infer element type separately
             TT->firstType = inferAutoType(autoT->firstType, initT->firstType);
             if ( !TT->firstType ) return nullptr;
         } else if ( autoT->baseType==Type::tTable ) {
@@ -168,6 +171,12 @@ namespace das
             } else {
                 stream << "array";
             }
+        } else if ( baseType==Type::tSlice ) {
+            if ( firstType ) {
+                stream << "slice<" << firstType->describe(extra) << ">";
+            } else {
+                stream << "slice";
+            }
         } else if ( baseType==Type::tTable ) {
             if ( firstType && secondType ) {
                 stream << "table<" << firstType->describe(extra) << "," << secondType->describe(extra) << ">";
@@ -300,7 +309,7 @@ namespace das
         }
         if ( baseType==Type::tPointer ) {
             return firstType ? firstType->findAlias(name,allowAuto) : nullptr;
-        } else if ( baseType==Type::tArray ) {
+        } else if ( baseType==Type::tArray || baseType==Type::tSlice ) {
             return firstType ? firstType->findAlias(name,allowAuto) : nullptr;
         } else if ( baseType==Type::tTable ) {
             if ( firstType ) {
@@ -423,7 +432,7 @@ namespace das
             return structType->isRawPod();
         if ( baseType==Type::tHandle )
             return annotation->isRawPod();
-        if ( baseType==Type::tPointer )
+        if ( baseType==Type::tPointer || baseType==Type::tSlice )
             return false;
         if ( baseType==Type::tTuple ) {
             for ( auto & arg : argTypes ) {
@@ -451,6 +460,11 @@ namespace das
             if ( firstType ) {
                 ss << "#" << firstType->getMangledName();
             }
+        } else if ( baseType==Type::tSlice ) {
+            ss << "#slice";
+            if ( firstType ) {
+                ss << "#" << firstType->getMangledName();
+            }
         } else if ( baseType==Type::tTable ) {
             ss << "#table";
             if ( firstType ) {
@@ -507,7 +521,7 @@ namespace das
             return annotation->isLocal();
         } else if ( isStructure() ) {
             return structType ? structType->isLocal() : false;
-        } else if ( isPointer() ) {
+        } else if ( isPointer() || isGoodSliceType() ) {
             return true;
         }
         if ( firstType && !firstType->isLocal() ) {
@@ -564,7 +578,7 @@ namespace das
                 return false;
             }
         }
-        if ( baseType==Type::tArray ) {
+        if ( baseType==Type::tArray || baseType==Type::tSlice ) {
             if ( firstType && decl.firstType && !firstType->isSameType(*decl.firstType,true,true,false) ) {
                 return false;
             }
@@ -773,6 +787,10 @@ namespace das
         return baseType==Type::tArray && dim.size()==0 && firstType;
     }
 
+    bool TypeDecl::isGoodSliceType() const {
+        return baseType==Type::tSlice && dim.size()==0 && firstType;
+    }
+
     bool TypeDecl::isGoodTupleType() const {
         return baseType==Type::tTuple && dim.size()==0;
     }
@@ -815,7 +833,7 @@ namespace das
         } else  if ( baseType==Type::tIterator ) {
             if ( firstType )
                 return firstType->isAlias();
-        } else if ( baseType==Type::tArray ) {
+        } else if ( baseType==Type::tArray || baseType==Type::tSlice ) {
             if ( firstType )
                 return firstType->isAlias();
         } else if ( baseType==Type::tTable ) {
@@ -849,7 +867,7 @@ namespace das
         } else  if ( baseType==Type::tPointer ) {
             if ( firstType )
                 return firstType->isAuto();
-        } else if ( baseType==Type::tArray ) {
+        } else if ( baseType==Type::tArray || baseType==Type::tSlice ) {
             if ( firstType )
                 return firstType->isAuto();
         } else if ( baseType==Type::tTable ) {
@@ -1193,7 +1211,7 @@ namespace das
             if ( all.find(thisType)!=all.end() ) return true;
             all.insert(thisType);
         }
-        if ( type->baseType==Type::tPointer ) {
+        if ( type->baseType==Type::tPointer || type->baseType==Type::tSlice ) {
             return false;
         } else if ( type->baseType==Type::tStructure ) {
             if ( type->structType ) {
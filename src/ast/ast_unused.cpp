@@ -190,6 +190,10 @@ namespace das {
             } else if ( expr->rtti_isPtr2Ref() ) {
                 auto rr = (ExprPtr2Ref *)expr;
                 propagateWrite(rr->subexpr.get());
+            } else if ( expr->rtti_isR2V() && expr->type->isGoodSliceType() ) {
+                // writing through a slice value writes to whatever it views
+                auto rr = (ExprRef2Value *)expr;
+                propagateWrite(rr->subexpr.get());
             }
             // TODO:
             //  propagate write to call or expr-like-call???
@@ -496,10 +500,11 @@ namespace das {
         faf.MarkSideEffects(*thisModule);
     }
 
-    bool Program::optimizationUnused(TextWriter & logs) {
+    bool Program::optimizationUnused(TextWriter & logs, OptimizationWorklist * work) {
         buildAccessFlags(logs);
         // remove itselft
         RemoveUnusedLocalVariables context;
+        context.setWorklist(work);
         visit(context);
         return context.didAnything();
     }
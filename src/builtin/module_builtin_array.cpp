@@ -18,6 +18,10 @@ namespace das {
         return arr.capacity;
     }
 
+    int builtin_slice_size ( Slice slice ) {
+        return slice.size;
+    }
+
     void builtin_array_resize ( Array & pArray, int newSize, int stride, Context * context ) {
         array_resize ( *context, pArray, newSize, stride, true );
     }
@@ -58,6 +62,8 @@ namespace das {
         addExtern<DAS_BIND_FUN(builtin_array_clear)>(*this, lib, "clear", SideEffects::modifyArgument, "builtin_array_clear");
         addExtern<DAS_BIND_FUN(builtin_array_size)>(*this, lib, "length", SideEffects::none, "builtin_array_size");
         addExtern<DAS_BIND_FUN(builtin_array_capacity)>(*this, lib, "capacity", SideEffects::none, "builtin_array_capacity");
+        // slice functions
+        addExtern<DAS_BIND_FUN(builtin_slice_size)>(*this, lib, "length", SideEffects::none, "builtin_slice_size");
         // array built-in functions
         addExtern<DAS_BIND_FUN(builtin_array_resize)>(*this, lib, "__builtin_array_resize", SideEffects::modifyArgument, "builtin_array_resize");
         addExtern<DAS_BIND_FUN(builtin_array_reserve)>(*this, lib, "__builtin_array_reserve", SideEffects::modifyArgument, "builtin_array_reserve");
@@ -131,6 +131,7 @@ namespace das
         addFunction ( make_shared<BuiltInFn<SimNode_LexicalCast<int64_t>,   char *,int64_t,Context *>>    ("string",lib,"das_lexical_cast",false) );
         addFunction ( make_shared<BuiltInFn<SimNode_LexicalCast<uint64_t>,  char *,uint64_t,Context *>>   ("string",lib,"das_lexical_cast",false) );
         addFunction ( make_shared<BuiltInFn<SimNode_LexicalCast<float>,     char *,float,Context *>>      ("string",lib,"das_lexical_cast",false) );
+        addFunction ( make_shared<BuiltInFn<SimNode_LexicalCast<double>,    char *,double,Context *>>     ("string",lib,"das_lexical_cast",false) );
     }
 }
 
@@ -87,6 +87,22 @@ namespace das
         };
     };
 
+    struct InlineFunctionAnnotation : MarkFunctionAnnotation {
+        InlineFunctionAnnotation() : MarkFunctionAnnotation("inline") { }
+        virtual bool apply(const FunctionPtr & func, ModuleGroup &, const AnnotationArgumentList &, string &) override {
+            func->inlineCall = true;
+            return true;
+        };
+    };
+
+    struct NoInlineFunctionAnnotation : MarkFunctionAnnotation {
+        NoInlineFunctionAnnotation() : MarkFunctionAnnotation("noinline") { }
+        virtual bool apply(const FunctionPtr & func, ModuleGroup &, const AnnotationArgumentList &, string &) override {
+            func->noInline = true;
+            return true;
+        };
+    };
+
     struct InitFunctionAnnotation : MarkFunctionAnnotation {
         InitFunctionAnnotation() : MarkFunctionAnnotation("init") { }
         virtual bool apply(const FunctionPtr & func, ModuleGroup &, const AnnotationArgumentList &, string &) override {
@@ -181,6 +197,11 @@ namespace das
       return (int32_t) context->heap.buddyChunksCount();
     }
 
+    int32_t tiered_functions ( int32_t tier, Context * context ) {
+        auto & tiers = context->functionsPerTier;
+        return (tier>=0 && tier<int32_t(tiers.size())) ? tiers[tier] : -1;
+    }
+
     void builtin_table_lock ( Table & arr, Context * context ) {
         table_lock(*context, arr);
     }
@@ -199,6 +220,8 @@ namespace das
         addAnnotation(make_shared<UnsafeFunctionAnnotation>());
         addAnnotation(make_shared<UnsafeOpFunctionAnnotation>());
         addAnnotation(make_shared<NoAotFunctionAnnotation>());
+        addAnnotation(make_shared<InlineFunctionAnnotation>());
+        addAnnotation(make_shared<NoInlineFunctionAnnotation>());
         addAnnotation(make_shared<InitFunctionAnnotation>());
         addAnnotation(make_shared<HybridFunctionAnnotation>());
         // functions
@@ -211,6 +234,8 @@ namespace das
         addExtern<DAS_BIND_FUN(heap_bytes_allocated)>(*this, lib, "heap_bytes_allocated", SideEffects::modifyExternal, "heap_bytes_allocated");
         addExtern<DAS_BIND_FUN(heap_high_watermark)>(*this, lib, "heap_high_watermark", SideEffects::modifyExternal, "heap_high_watermark");
         addExtern<DAS_BIND_FUN(heap_depth)>(*this, lib, "heap_depth", SideEffects::modifyExternal, "heap_depth");
+        // tiered execution
+        addExtern<DAS_BIND_FUN(tiered_functions)>(*this, lib, "tiered_functions", SideEffects::modifyExternal, "tiered_functions");
         // binary serializer
         addInterop<_builtin_binary_load,void,vec4f,char *>(*this,lib,"_builtin_binary_load",SideEffects::modifyArgument, "_builtin_binary_load");
         addInterop<_builtin_binary_save,void,const vec4f,const Block &>(*this, lib, "_builtin_binary_save",SideEffects::modifyExternal, "_builtin_binary_save");
@@ -235,6 +260,13 @@ namespace das
         addCall<ExprKeyExists>("__builtin_table_key_exists");
         // blocks
         addCall<ExprInvoke>("invoke");
+        // iterator adapters, fused into the for loop
+        addCall<ExprIterAdapter>("map");
+        addCall<ExprIterAdapter>("filter");
+        addCall<ExprIterAdapter>("take");
+        addCall<ExprIterAdapter>("skip");
+        addCall<ExprIterAdapter>("zip");
+        addCall<ExprIterAdapter>("enumerate");
         // profile
         addExtern<DAS_BIND_FUN(builtin_profile)>(*this,lib,"profile", SideEffects::modifyExternal, "builtin_profile");
         addString(lib);
@@ -7,8 +7,10 @@
 
 #include "daScript/simulate/aot_builtin_string.h"
 #include "daScript/misc/string_writer.h"
+#include "daScript/misc/string_convert.h"
 
 MAKE_TYPE_FACTORY(StringBuilderWriter, StringBuilderWriter)
+MAKE_TYPE_FACTORY(string_view, das::StringView)
 
 namespace das
 {
@@ -18,6 +20,20 @@ namespace das
         }
     };
 
+    struct StringViewAnnotation : ManagedValueAnnotation<StringView> {
+        StringViewAnnotation() : ManagedValueAnnotation<StringView>("string_view","das::StringView") {}
+        virtual void walk ( DataWalker & walker, void * data ) override {
+            if ( walker.reading ) {
+                // views can't be read, there is nothing for them to point to
+            } else {
+                auto sv = (StringView *) data;
+                string text(sv->data ? sv->data : "", sv->length);
+                char * str = (char *) text.c_str();
+                walker.String(str);
+            }
+        }
+    };
+
     int32_t get_character_at ( const char * str, int32_t index, Context * context ) {
         const uint32_t strLen = stringLengthSafe ( *context, str );
         if ( uint32_t(index)>=strLen ) {
@@ -150,48 +166,203 @@ namespace das
         return ret;
     }
 
-    unsigned string_to_uint ( const char *str, Context * context ) {
-        char *endptr;
-        unsigned long int ret = strtoul(str, &endptr, 10);
-        const uint32_t strLen = stringLengthSafe ( *context, str );
-        if (endptr != str + strLen || strLen == 0)
-        {
+    unsigned string_view_to_uint ( StringView str, Context * context ) {
+        uint32_t ret = 0;
+        const char * end = str.data + str.length;
+        if ( parse_uint32(str.data, end, ret) != end || !str.length ) {
             context->throw_error("string-to-uint conversion failed. String is not an uint number");
             return 0;
         }
         return ret;
     }
 
-    int string_to_int ( const char *str, Context * context ) {
-        char *endptr;
-        long int ret = strtol(str, &endptr, 10);
-        const uint32_t strLen = stringLengthSafe ( *context, str );
-        if (endptr != str + strLen || strLen == 0)
-        {
+    int string_view_to_int ( StringView str, Context * context ) {
+        int32_t ret = 0;
+        const char * end = str.data + str.length;
+        if ( parse_int32(str.data, end, ret) != end || !str.length ) {
             context->throw_error("string-to-int conversion failed. String is not an integer number");
             return 0;
         }
         return ret;
     }
 
-    float string_to_float ( const char *str, Context * context ) {
-        char *endptr;
-        float ret = strtof(str, &endptr);
-        const uint32_t strLen = stringLengthSafe ( *context, str );
-        if (endptr != str + strLen || strLen == 0)
-        {
+    float string_view_to_float ( StringView str, Context * context ) {
+        float ret = 0.f;
+        const char * end = str.data + str.length;
+        if ( parse_float(str.data, end, ret) != end || !str.length ) {
             context->throw_error("string-to-float conversion failed. String is not an float number");
             return 0.f;
         }
         return ret;
     }
 
+    double string_view_to_double ( StringView str, Context * context ) {
+        double ret = 0.;
+        const char * end = str.data + str.length;
+        if ( parse_double(str.data, end, ret) != end || !str.length ) {
+            context->throw_error("string-to-double conversion failed. String is not an double number");
+            return 0.;
+        }
+        return ret;
+    }
+
+    unsigned string_to_uint ( const char *str, Context * context ) {
+        return string_view_to_uint(builtin_string_view(str, context), context);
+    }
+
+    int string_to_int ( const char *str, Context * context ) {
+        return string_view_to_int(builtin_string_view(str, context), context);
+    }
+
+    float string_to_float ( const char *str, Context * context ) {
+        return string_view_to_float(builtin_string_view(str, context), context);
+    }
+
+    double string_to_double ( const char *str, Context * context ) {
+        return string_view_to_double(builtin_string_view(str, context), context);
+    }
+
     float fast_to_float ( const char *str ) {
-        return str ? (float)atof(str) : 0.f;
+        float ret = 0.f;
+        return str && parse_float(str, str + strlen(str), ret) ? ret : 0.f;
     }
 
     int fast_to_int ( const char *str ) {
-        return str ? atoi(str) : 0;
+        int64_t ret = 0;
+        return str && parse_int64(str, str + strlen(str), ret) ? int(ret) : 0;
+    }
+
+    // string_view
+
+    StringView builtin_string_view ( const char * str, Context * context ) {
+        return StringView(str, stringLengthSafe(*context, str));
+    }
+
+    StringView builtin_string_view_slice1 ( StringView str, int start, int end ) {
+        const int strLen = int(str.length);
+        start = clamp_int((start < 0) ? (strLen + start) : start, 0, strLen);
+        end = clamp_int((end < 0) ? (strLen + end) : end, 0, strLen);
+        return end > start ? StringView(str.data + start, uint32_t(end-start)) : StringView(nullptr, 0);
+    }
+
+    StringView builtin_string_view_slice2 ( StringView str, int start ) {
+        return builtin_string_view_slice1(str, start, int(str.length));
+    }
+
+    StringView builtin_string_slice_view1 ( const char * str, int start, int end, Context * context ) {
+        return builtin_string_view_slice1(builtin_string_view(str,context), start, end);
+    }
+
+    StringView builtin_string_slice_view2 ( const char * str, int start, Context * context ) {
+        return builtin_string_view_slice2(builtin_string_view(str,context), start);
+    }
+
+    StringView builtin_string_view_strip_left ( StringView str ) {
+        const char * t = str.data;
+        const char * end = str.data + str.length;
+        while ( t != end && isspace(*t) ) t++;
+        return StringView(t, uint32_t(end-t));
+    }
+
+    StringView builtin_string_view_strip_right ( StringView str ) {
+        const char * end = str.data + str.length;
+        while ( end != str.data && isspace(end[-1]) ) end--;
+        return StringView(str.data, uint32_t(end-str.data));
+    }
+
+    StringView builtin_string_view_strip ( StringView str ) {
+        return builtin_string_view_strip_right(builtin_string_view_strip_left(str));
+    }
+
+    StringView builtin_string_strip_view ( const char * str, Context * context ) {
+        return builtin_string_view_strip(builtin_string_view(str,context));
+    }
+
+    StringView builtin_string_strip_left_view ( const char * str, Context * context ) {
+        return builtin_string_view_strip_left(builtin_string_view(str,context));
+    }
+
+    StringView builtin_string_strip_right_view ( const char * str, Context * context ) {
+        return builtin_string_view_strip_right(builtin_string_view(str,context));
+    }
+
+    int32_t builtin_string_view_length ( StringView str ) {
+        return int32_t(str.length);
+    }
+
+    int32_t builtin_string_view_character_at ( StringView str, int32_t index, Context * context ) {
+        if ( uint32_t(index)>=str.length ) {
+            context->throw_error("string character index out of range");
+        }
+        return str.data[index];
+    }
+
+    bool builtin_string_view_startswith ( StringView str, const char * cmp, Context * context ) {
+        const uint32_t cmpLen = stringLengthSafe ( *context, cmp );
+        return (cmpLen > str.length) ? false : memcmp(str.data, cmp, cmpLen) == 0;
+    }
+
+    bool builtin_string_view_endswith ( StringView str, const char * cmp, Context * context ) {
+        const uint32_t cmpLen = stringLengthSafe ( *context, cmp );
+        return (cmpLen > str.length) ? false : memcmp(&str.data[str.length - cmpLen], cmp, cmpLen) == 0;
+    }
+
+    int32_t builtin_string_view_find ( StringView str, const char * substr, Context * context ) {
+        const uint32_t subLen = stringLengthSafe ( *context, substr );
+        if ( subLen > str.length ) return -1;
+        for ( uint32_t i=0, n=str.length-subLen; i<=n; ++i ) {
+            if ( memcmp(str.data+i, substr, subLen)==0 ) {
+                return int32_t(i);
+            }
+        }
+        return -1;
+    }
+
+    bool builtin_string_view_equ ( StringView a, StringView b ) {
+        return a.length==b.length && (a.length==0 || memcmp(a.data, b.data, a.length)==0);
+    }
+
+    bool builtin_string_view_nequ ( StringView a, StringView b ) {
+        return !builtin_string_view_equ(a, b);
+    }
+
+    // operators don't get the context in AOT
+    bool builtin_string_view_equ_str ( StringView a, const char * b ) {
+        return builtin_string_view_equ(a, StringView(b, b ? uint32_t(strlen(b)) : 0));
+    }
+
+    bool builtin_string_view_nequ_str ( StringView a, const char * b ) {
+        return !builtin_string_view_equ_str(a, b);
+    }
+
+    char * builtin_string_view_to_string ( StringView str, Context * context ) {
+        return str.length ? context->heap.allocateString(str.data, str.length) : nullptr;
+    }
+
+    static __forceinline void invoke_string_view_block ( const TBlock<void,StringView> & block, StringView sv, Context * context ) {
+        vec4f args[1];
+        args[0] = cast<StringView>::from(sv);
+        context->invoke(block, args, nullptr);
+    }
+
+    void builtin_string_view_split ( StringView str, const char * delim, const TBlock<void,StringView> & block, Context * context ) {
+        string_view_split(str, builtin_string_view(delim,context), [&](StringView sv) {
+            invoke_string_view_block(block, sv, context);
+        });
+    }
+
+    void builtin_string_split ( const char * str, const char * delim, const TBlock<void,StringView> & block, Context * context ) {
+        builtin_string_view_split(builtin_string_view(str,context), delim, block, context);
+    }
+
+    void builtin_string_view_tokenize ( StringView str, const char * delims, const TBlock<void,StringView> & block, Context * context ) {
+        string_view_tokenize(str, builtin_string_view(delims,context), [&](StringView sv) {
+            invoke_string_view_block(block, sv, context);
+        });
+    }
+
+    void builtin_string_tokenize ( const char * str, const char * delims, const TBlock<void,StringView> & block, Context * context ) {
+        builtin_string_view_tokenize(builtin_string_view(str,context), delims, block, context);
     }
 
     char * to_das_string(const string & str, Context * ctx) {
@@ -290,8 +461,44 @@ namespace das
         addExtern<DAS_BIND_FUN(string_to_int)>(*this, lib, "int", SideEffects::none, "string_to_int");
         addExtern<DAS_BIND_FUN(string_to_uint)>(*this, lib, "uint", SideEffects::none, "string_to_uint");
         addExtern<DAS_BIND_FUN(string_to_float)>(*this, lib, "float", SideEffects::none, "string_to_float");
+        addExtern<DAS_BIND_FUN(string_to_double)>(*this, lib, "double", SideEffects::none, "string_to_double");
         addExtern<DAS_BIND_FUN(fast_to_int)>(*this, lib, "to_int", SideEffects::none, "fast_to_int");
         addExtern<DAS_BIND_FUN(fast_to_float)>(*this, lib, "to_float", SideEffects::none, "fast_to_float");
+        // string_view
+        addAnnotation(make_shared<StringViewAnnotation>());
+        addExtern<DAS_BIND_FUN(builtin_string_view)>(*this, lib, "view", SideEffects::none, "builtin_string_view");
+        addExtern<DAS_BIND_FUN(builtin_string_view_to_string)>(*this, lib, "string", SideEffects::none, "builtin_string_view_to_string");
+        addExtern<DAS_BIND_FUN(builtin_string_view_length)>(*this, lib, "length", SideEffects::none, "builtin_string_view_length");
+        addExtern<DAS_BIND_FUN(builtin_string_view_character_at)>(*this, lib, "characterat", SideEffects::none, "builtin_string_view_character_at");
+        addExtern<DAS_BIND_FUN(builtin_string_view_equ)>(*this, lib, "==", SideEffects::none, "builtin_string_view_equ");
+        addExtern<DAS_BIND_FUN(builtin_string_view_nequ)>(*this, lib, "!=", SideEffects::none, "builtin_string_view_nequ");
+        addExtern<DAS_BIND_FUN(builtin_string_view_equ_str)>(*this, lib, "==", SideEffects::none, "builtin_string_view_equ_str");
+        addExtern<DAS_BIND_FUN(builtin_string_view_nequ_str)>(*this, lib, "!=", SideEffects::none, "builtin_string_view_nequ_str");
+        addExtern<DAS_BIND_FUN(builtin_string_view_startswith)>(*this, lib, "startswith", SideEffects::none, "builtin_string_view_startswith");
+        addExtern<DAS_BIND_FUN(builtin_string_view_endswith)>(*this, lib, "endswith", SideEffects::none, "builtin_string_view_endswith");
+        addExtern<DAS_BIND_FUN(string_view_to_int)>(*this, lib, "int", SideEffects::none, "string_view_to_int");
+        addExtern<DAS_BIND_FUN(string_view_to_uint)>(*this, lib, "uint", SideEffects::none, "string_view_to_uint");
+        addExtern<DAS_BIND_FUN(string_view_to_float)>(*this, lib, "float", SideEffects::none, "string_view_to_float");
+        addExtern<DAS_BIND_FUN(string_view_to_double)>(*this, lib, "double", SideEffects::none, "string_view_to_double");
+        addExtern<DAS_BIND_FUN(builtin_string_view_find)>(*this, lib, "find", SideEffects::none, "builtin_string_view_find");
+        addExtern<DAS_BIND_FUN(builtin_string_view_slice1)>(*this, lib, "slice", SideEffects::none, "builtin_string_view_slice1");
+        addExtern<DAS_BIND_FUN(builtin_string_view_slice2)>(*this, lib, "slice", SideEffects::none, "builtin_string_view_slice2");
+        addExtern<DAS_BIND_FUN(builtin_string_view_strip)>(*this, lib, "strip", SideEffects::none, "builtin_string_view_strip");
+        addExtern<DAS_BIND_FUN(builtin_string_view_strip_left)>(*this, lib, "strip_left", SideEffects::none, "builtin_string_view_strip_left");
+        addExtern<DAS_BIND_FUN(builtin_string_view_strip_right)>(*this, lib, "strip_right", SideEffects::none, "builtin_string_view_strip_right");
+        addExtern<DAS_BIND_FUN(builtin_string_slice_view1)>(*this, lib, "slice_view", SideEffects::none, "builtin_string_slice_view1");
+        addExtern<DAS_BIND_FUN(builtin_string_slice_view2)>(*this, lib, "slice_view", SideEffects::none, "builtin_string_slice_view2");
+        addExtern<DAS_BIND_FUN(builtin_string_strip_view)>(*this, lib, "strip_view", SideEffects::none, "builtin_string_strip_view");
+        addExtern<DAS_BIND_FUN(builtin_string_strip_left_view)>(*this, lib, "strip_left_view", SideEffects::none, "builtin_string_strip_left_view");
+        addExtern<DAS_BIND_FUN(builtin_string_strip_right_view)>(*this, lib, "strip_right_view", SideEffects::none, "builtin_string_strip_right_view");
+        addExtern<DAS_BIND_FUN(builtin_string_split)>(*this, lib, "split",
+            SideEffects::modifyExternal, "builtin_string_split_T")->setAotTemplate();
+        addExtern<DAS_BIND_FUN(builtin_string_view_split)>(*this, lib, "split",
+            SideEffects::modifyExternal, "builtin_string_view_split_T")->setAotTemplate();
+        addExtern<DAS_BIND_FUN(builtin_string_tokenize)>(*this, lib, "tokenize",
+            SideEffects::modifyExternal, "builtin_string_tokenize_T")->setAotTemplate();
+        addExtern<DAS_BIND_FUN(builtin_string_view_tokenize)>(*this, lib, "tokenize",
+            SideEffects::modifyExternal, "builtin_string_view_tokenize_T")->setAotTemplate();
         // format
         addExtern<DAS_BIND_FUN(format<int32_t>)> (*this, lib, "format", SideEffects::none, "format<int32_t>");
         addExtern<DAS_BIND_FUN(format<uint32_t>)>(*this, lib, "format", SideEffects::none, "format<uint32_t>");
@@ -0,0 +1,41 @@
+#include "daScript/misc/platform.h"
+
+#ifdef _MSC_VER
+
+#include <windows.h>
+
+void * os_alloc_exec ( size_t size ) {
+    return VirtualAlloc(nullptr, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+}
+
+bool os_protect_exec ( void * ptr, size_t size ) {
+    DWORD oldProtect = 0;
+    if ( !VirtualProtect(ptr, size, PAGE_EXECUTE_READ, &oldProtect) ) {
+        return false;
+    }
+    FlushInstructionCache(GetCurrentProcess(), ptr, size);
+    return true;
+}
+
+void os_free_exec ( void * ptr, size_t ) {
+    VirtualFree(ptr, 0, MEM_RELEASE);
+}
+
+#else
+
+#include <sys/mman.h>
+
+void * os_alloc_exec ( size_t size ) {
+    void * ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    return ptr==MAP_FAILED ? nullptr : ptr;
+}
+
+bool os_protect_exec ( void * ptr, size_t size ) {
+    return mprotect(ptr, size, PROT_READ | PROT_EXEC)==0;
+}
+
+void os_free_exec ( void * ptr, size_t size ) {
+    munmap(ptr, size);
+}
+
+#endif
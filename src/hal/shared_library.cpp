@@ -0,0 +1,39 @@
+#include "daScript/misc/platform.h"
+
+#ifdef _MSC_VER
+
+#include <windows.h>
+
+void * os_load_shared_library ( const char * fileName ) {
+    return (void *) LoadLibraryA(fileName);
+}
+
+void os_unload_shared_library ( void * handle ) {
+    FreeLibrary((HMODULE)handle);
+}
+
+const char * os_shared_library_error () {
+    static char message[256];
+    FormatMessageA(FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS, nullptr, GetLastError(),
+        0, message, sizeof(message), nullptr);
+    return message;
+}
+
+#else
+
+#include <dlfcn.h>
+
+void * os_load_shared_library ( const char * fileName ) {
+    return dlopen(fileName, RTLD_NOW | RTLD_LOCAL);
+}
+
+void os_unload_shared_library ( void * handle ) {
+    dlclose(handle);
+}
+
+const char * os_shared_library_error () {
+    auto message = dlerror();
+    return message ? message : "";
+}
+
+#endif
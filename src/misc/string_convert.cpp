@@ -0,0 +1,465 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/misc/string_convert.h"
+
+// Grisu2 is based on the implementation from RapidJSON (MIT license)
+//  Copyright (C) 2015 THL A29 Limited, a Tencent company, and Milo Yip
+// which implements
+//  Loitsch, Florian. "Printing floating-point numbers quickly and accurately with integers."
+//  ACM Sigplan Notices 45.6 (2010): 233-243.
+// it works for float as well as for double, only the boundaries are different
+
+namespace das {
+
+    static const char g_digitPairs[201] =
+        "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+        "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+        "8081828384858687888990919293949596979899";
+
+    int fmt_uint64 ( char * buf, uint64_t value ) {
+        char tmp[DAS_NUMBER_BUFFER_SIZE];
+        char * at = tmp + DAS_NUMBER_BUFFER_SIZE;
+        while ( value >= 100 ) {
+            const char * d = g_digitPairs + (value % 100) * 2;
+            value /= 100;
+            *--at = d[1];
+            *--at = d[0];
+        }
+        if ( value >= 10 ) {
+            const char * d = g_digitPairs + value * 2;
+            *--at = d[1];
+            *--at = d[0];
+        } else {
+            *--at = char('0' + value);
+        }
+        int len = int(tmp + DAS_NUMBER_BUFFER_SIZE - at);
+        memcpy(buf, at, len);
+        return len;
+    }
+
+    int fmt_int64 ( char * buf, int64_t value ) {
+        if ( value < 0 ) {
+            *buf = '-';
+            return 1 + fmt_uint64(buf + 1, uint64_t(0) - uint64_t(value));
+        }
+        return fmt_uint64(buf, uint64_t(value));
+    }
+
+    struct DiyFp {
+        uint64_t    f;
+        int         e;
+        DiyFp() = default;
+        DiyFp ( uint64_t fp, int exp ) : f(fp), e(exp) {}
+        DiyFp operator - ( const DiyFp & rhs ) const {
+            return DiyFp(f - rhs.f, e);
+        }
+        DiyFp operator * ( const DiyFp & rhs ) const {
+            const uint64_t M32 = 0xFFFFFFFF;
+            const uint64_t a = f >> 32;
+            const uint64_t b = f & M32;
+            const uint64_t c = rhs.f >> 32;
+            const uint64_t d = rhs.f & M32;
+            const uint64_t ac = a * c;
+            const uint64_t bc = b * c;
+            const uint64_t ad = a * d;
+            const uint64_t bd = b * d;
+            uint64_t tmp = (bd >> 32) + (ad & M32) + (bc & M32);
+            tmp += 1U << 31;    // round
+            return DiyFp(ac + (ad >> 32) + (bc >> 32) + (tmp >> 32), e + rhs.e + 64);
+        }
+        DiyFp normalize() const {
+            DiyFp res = *this;
+            while ( !(res.f & (uint64_t(1) << 63)) ) {
+                res.f <<= 1;
+                res.e--;
+            }
+            return res;
+        }
+    };
+
+    // 10^-348, 10^-340, ..., 10^340
+    static DiyFp getCachedPower ( int e, int & K ) {
+        static const uint64_t cachedPowersF[] = {
+            0xfa8fd5a0081c0288ull, 0xbaaee17fa23ebf76ull, 0x8b16fb203055ac76ull, 0xcf42894a5dce35eaull,
+            0x9a6bb0aa55653b2dull, 0xe61acf033d1a45dfull, 0xab70fe17c79ac6caull, 0xff77b1fcbebcdc4full,
+            0xbe5691ef416bd60cull, 0x8dd01fad907ffc3cull, 0xd3515c2831559a83ull, 0x9d71ac8fada6c9b5ull,
+            0xea9c227723ee8bcbull, 0xaecc49914078536dull, 0x823c12795db6ce57ull, 0xc21094364dfb5637ull,
+            0x9096ea6f3848984full, 0xd77485cb25823ac7ull, 0xa086cfcd97bf97f4ull, 0xef340a98172aace5ull,
+            0xb23867fb2a35b28eull, 0x84c8d4dfd2c63f3bull, 0xc5dd44271ad3cdbaull, 0x936b9fcebb25c996ull,
+            0xdbac6c247d62a584ull, 0xa3ab66580d5fdaf6ull, 0xf3e2f893dec3f126ull, 0xb5b5ada8aaff80b8ull,
+            0x87625f056c7c4a8bull, 0xc9bcff6034c13053ull, 0x964e858c91ba2655ull, 0xdff9772470297ebdull,
+            0xa6dfbd9fb8e5b88full, 0xf8a95fcf88747d94ull, 0xb94470938fa89bcfull, 0x8a08f0f8bf0f156bull,
+            0xcdb02555653131b6ull, 0x993fe2c6d07b7facull, 0xe45c10c42a2b3b06ull, 0xaa242499697392d3ull,
+            0xfd87b5f28300ca0eull, 0xbce5086492111aebull, 0x8cbccc096f5088ccull, 0xd1b71758e219652cull,
+            0x9c40000000000000ull, 0xe8d4a51000000000ull, 0xad78ebc5ac620000ull, 0x813f3978f8940984ull,
+            0xc097ce7bc90715b3ull, 0x8f7e32ce7bea5c70ull, 0xd5d238a4abe98068ull, 0x9f4f2726179a2245ull,
+            0xed63a231d4c4fb27ull, 0xb0de65388cc8ada8ull, 0x83c7088e1aab65dbull, 0xc45d1df942711d9aull,
+            0x924d692ca61be758ull, 0xda01ee641a708deaull, 0xa26da3999aef774aull, 0xf209787bb47d6b85ull,
+            0xb454e4a179dd1877ull, 0x865b86925b9bc5c2ull, 0xc83553c5c8965d3dull, 0x952ab45cfa97a0b3ull,
+            0xde469fbd99a05fe3ull, 0xa59bc234db398c25ull, 0xf6c69a72a3989f5cull, 0xb7dcbf5354e9beceull,
+            0x88fcf317f22241e2ull, 0xcc20ce9bd35c78a5ull, 0x98165af37b2153dfull, 0xe2a0b5dc971f303aull,
+            0xa8d9d1535ce3b396ull, 0xfb9b7cd9a4a7443cull, 0xbb764c4ca7a44410ull, 0x8bab8eefb6409c1aull,
+            0xd01fef10a657842cull, 0x9b10a4e5e9913129ull, 0xe7109bfba19c0c9dull, 0xac2820d9623bf429ull,
+            0x80444b5e7aa7cf85ull, 0xbf21e44003acdd2dull, 0x8e679c2f5e44ff8full, 0xd433179d9c8cb841ull,
+            0x9e19db92b4e31ba9ull, 0xeb96bf6ebadf77d9ull, 0xaf87023b9bf0ee6bull
+        };
+        static const int16_t cachedPowersE[] = {
+            -1220, -1193, -1166, -1140, -1113, -1087, -1060, -1034, -1007,  -980,
+             -954,  -927,  -901,  -874,  -847,  -821,  -794,  -768,  -741,  -715,
+             -688,  -661,  -635,  -608,  -582,  -555,  -529,  -502,  -475,  -449,
+             -422,  -396,  -369,  -343,  -316,  -289,  -263,  -236,  -210,  -183,
+             -157,  -130,  -103,   -77,   -50,   -24,     3,    30,    56,    83,
+              109,   136,   162,   189,   216,   242,   269,   295,   322,   348,
+              375,   402,   428,   455,   481,   508,   534,   561,   588,   614,
+              641,   667,   694,   720,   747,   774,   800,   827,   853,   880,
+              907,   933,   960,   986,  1013,  1039,  1066
+        };
+        double dk = (-61 - e) * 0.30102999566398114 + 347;  // dk must be positive, so can do ceiling in positive
+        int k = int(dk);
+        if ( dk - k > 0.0 ) k++;
+        unsigned index = unsigned((k >> 3) + 1);
+        K = -(-348 + int(index << 3));
+        return DiyFp(cachedPowersF[index], cachedPowersE[index]);
+    }
+
+    static __forceinline void grisuRound ( char * buffer, int len, uint64_t delta, uint64_t rest, uint64_t ten_kappa, uint64_t wp_w ) {
+        while ( rest < wp_w && delta - rest >= ten_kappa &&
+               (rest + ten_kappa < wp_w || wp_w - rest > rest + ten_kappa - wp_w) ) {
+            buffer[len - 1]--;
+            rest += ten_kappa;
+        }
+    }
+
+    static __forceinline int countDecimalDigit32 ( uint32_t n ) {
+        if ( n < 10 ) return 1;
+        if ( n < 100 ) return 2;
+        if ( n < 1000 ) return 3;
+        if ( n < 10000 ) return 4;
+        if ( n < 100000 ) return 5;
+        if ( n < 1000000 ) return 6;
+        if ( n < 10000000 ) return 7;
+        if ( n < 100000000 ) return 8;
+        return 9;
+    }
+
+    static const uint32_t g_pow10_32[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000 };
+
+    static void digitGen ( const DiyFp & W, const DiyFp & Mp, uint64_t delta, char * buffer, int & len, int & K ) {
+        const DiyFp one(uint64_t(1) << -Mp.e, Mp.e);
+        const DiyFp wp_w = Mp - W;
+        uint32_t p1 = uint32_t(Mp.f >> -one.e);
+        uint64_t p2 = Mp.f & (one.f - 1);
+        int kappa = countDecimalDigit32(p1);
+        len = 0;
+        while ( kappa > 0 ) {
+            uint32_t d = p1 / g_pow10_32[kappa-1];
+            p1 %= g_pow10_32[kappa-1];
+            if ( d || len ) buffer[len++] = char('0' + d);
+            kappa--;
+            uint64_t tmp = (uint64_t(p1) << -one.e) + p2;
+            if ( tmp <= delta ) {
+                K += kappa;
+                grisuRound(buffer, len, delta, tmp, uint64_t(g_pow10_32[kappa]) << -one.e, wp_w.f);
+                return;
+            }
+        }
+        for (;;) {
+            p2 *= 10;
+            delta *= 10;
+            char d = char(p2 >> -one.e);
+            if ( d || len ) buffer[len++] = char('0' + d);
+            p2 &= one.f - 1;
+            kappa--;
+            if ( p2 < delta ) {
+                K += kappa;
+                int index = -kappa;
+                grisuRound(buffer, len, delta, p2, one.f, wp_w.f * (index < 9 ? g_pow10_32[index] : 0));
+                return;
+            }
+        }
+    }
+
+    // value is f * 2^e, hiddenBit is the implicit leading bit of the format
+    static void grisu2 ( uint64_t f, int e, uint64_t hiddenBit, char * buffer, int & len, int & K ) {
+        const DiyFp v(f, e);
+        DiyFp pl = DiyFp((f << 1) + 1, e - 1).normalize();
+        DiyFp mi = (f == hiddenBit) ? DiyFp((f << 2) - 1, e - 2) : DiyFp((f << 1) - 1, e - 1);
+        mi.f <<= mi.e - pl.e;
+        mi.e = pl.e;
+        const DiyFp c_mk = getCachedPower(pl.e, K);
+        const DiyFp W = v.normalize() * c_mk;
+        DiyFp Wp = pl * c_mk;
+        DiyFp Wm = mi * c_mk;
+        Wm.f++;
+        Wp.f--;
+        digitGen(W, Wp, Wp.f - Wm.f, buffer, len, K);
+    }
+
+    static int fmt_exponent ( char * buf, int X ) {
+        char * at = buf;
+        *at++ = 'e';
+        if ( X < 0 ) {
+            *at++ = '-';
+            X = -X;
+        } else {
+            *at++ = '+';
+        }
+        if ( X >= 100 ) {
+            *at++ = char('0' + X / 100);
+            X %= 100;
+        }
+        *at++ = g_digitPairs[X*2];
+        *at++ = g_digitPairs[X*2+1];
+        return int(at - buf);
+    }
+
+    // value is digits * 10^K. same layout as %g, precision is at least 6, or as many digits as there are
+    static int fmt_digits ( char * buf, const char * digits, int n, int K ) {
+        while ( n > 1 && digits[n-1]=='0' ) {
+            n --;
+            K ++;
+        }
+        const int X = n + K - 1;
+        const int P = n > 6 ? n : 6;
+        char * at = buf;
+        if ( X < -4 || X >= P ) {
+            *at++ = digits[0];
+            if ( n > 1 ) {
+                *at++ = '.';
+                memcpy(at, digits + 1, n - 1);
+                at += n - 1;
+            }
+            at += fmt_exponent(at, X);
+        } else if ( K >= 0 ) {
+            memcpy(at, digits, n);
+            at += n;
+            for ( int i=0; i!=K; ++i ) *at++ = '0';
+        } else if ( X >= 0 ) {
+            memcpy(at, digits, X + 1);
+            at += X + 1;
+            *at++ = '.';
+            memcpy(at, digits + X + 1, n - X - 1);
+            at += n - X - 1;
+        } else {
+            *at++ = '0';
+            *at++ = '.';
+            for ( int i=-1; i!=X; --i ) *at++ = '0';
+            memcpy(at, digits, n);
+            at += n;
+        }
+        return int(at - buf);
+    }
+
+    static int fmt_special ( char * buf, bool sign, bool isNan, bool isZero ) {
+        char * at = buf;
+        if ( sign ) *at++ = '-';
+        const char * text = isZero ? "0" : (isNan ? "nan" : "inf");
+        size_t len = strlen(text);
+        memcpy(at, text, len);
+        return int(at - buf + len);
+    }
+
+    int fmt_double ( char * buf, double value ) {
+        uint64_t u;
+        memcpy(&u, &value, sizeof(double));
+        const bool sign = (u >> 63) != 0;
+        const int biased_e = int((u >> 52) & 0x7ff);
+        const uint64_t significand = u & 0x000FFFFFFFFFFFFFull;
+        if ( biased_e==0x7ff ) return fmt_special(buf, sign, significand!=0, false);
+        if ( biased_e==0 && significand==0 ) return fmt_special(buf, sign, false, true);
+        const uint64_t hiddenBit = 0x0010000000000000ull;
+        uint64_t f = biased_e ? significand + hiddenBit : significand;
+        int e = biased_e ? biased_e - 1075 : -1074;
+        char digits[DAS_NUMBER_BUFFER_SIZE];
+        int n = 0, K = 0;
+        grisu2(f, e, hiddenBit, digits, n, K);
+        char * at = buf;
+        if ( sign ) *at++ = '-';
+        return int(at - buf) + fmt_digits(at, digits, n, K);
+    }
+
+    int fmt_float ( char * buf, float value ) {
+        uint32_t u;
+        memcpy(&u, &value, sizeof(float));
+        const bool sign = (u >> 31) != 0;
+        const int biased_e = int((u >> 23) & 0xff);
+        const uint32_t significand = u & 0x007FFFFF;
+        if ( biased_e==0xff ) return fmt_special(buf, sign, significand!=0, false);
+        if ( biased_e==0 && significand==0 ) return fmt_special(buf, sign, false, true);
+        const uint64_t hiddenBit = 0x00800000;
+        uint64_t f = biased_e ? significand + hiddenBit : significand;
+        int e = biased_e ? biased_e - 150 : -149;
+        char digits[DAS_NUMBER_BUFFER_SIZE];
+        int n = 0, K = 0;
+        grisu2(f, e, hiddenBit, digits, n, K);
+        char * at = buf;
+        if ( sign ) *at++ = '-';
+        return int(at - buf) + fmt_digits(at, digits, n, K);
+    }
+
+    static __forceinline bool is_space ( char ch ) {
+        return ch==' ' || ch=='\t' || ch=='\n' || ch=='\r' || ch=='\v' || ch=='\f';
+    }
+
+    static __forceinline bool is_digit ( char ch ) {
+        return ch>='0' && ch<='9';
+    }
+
+    static const char * parse_digits ( const char * at, const char * end, uint64_t limit, uint64_t & value ) {
+        if ( at==end || !is_digit(*at) ) return nullptr;
+        uint64_t res = 0;
+        for ( ; at!=end && is_digit(*at); ++at ) {
+            uint64_t d = uint64_t(*at - '0');
+            if ( res > (limit - d) / 10 ) return nullptr;
+            res = res * 10 + d;
+        }
+        value = res;
+        return at;
+    }
+
+    const char * parse_uint64 ( const char * str, const char * end, uint64_t & value ) {
+        while ( str!=end && is_space(*str) ) str++;
+        if ( str!=end && *str=='+' ) str++;
+        return parse_digits(str, end, UINT64_MAX, value);
+    }
+
+    const char * parse_int64 ( const char * str, const char * end, int64_t & value ) {
+        while ( str!=end && is_space(*str) ) str++;
+        bool neg = false;
+        if ( str!=end && (*str=='+' || *str=='-') ) {
+            neg = *str=='-';
+            str++;
+        }
+        uint64_t res;
+        str = parse_digits(str, end, neg ? uint64_t(INT64_MAX)+1 : uint64_t(INT64_MAX), res);
+        if ( str ) value = neg ? int64_t(uint64_t(0) - res) : int64_t(res);
+        return str;
+    }
+
+    const char * parse_int32 ( const char * str, const char * end, int32_t & value ) {
+        int64_t res;
+        str = parse_int64(str, end, res);
+        if ( !str || res<INT32_MIN || res>INT32_MAX ) return nullptr;
+        value = int32_t(res);
+        return str;
+    }
+
+    const char * parse_uint32 ( const char * str, const char * end, uint32_t & value ) {
+        uint64_t res;
+        str = parse_uint64(str, end, res);
+        if ( !str || res>UINT32_MAX ) return nullptr;
+        value = uint32_t(res);
+        return str;
+    }
+
+    // decimal number, which is exactly mantissa * 10^exp10
+    struct DecimalNumber {
+        uint64_t    mantissa = 0;
+        int         exp10 = 0;
+        bool        negative = false;
+        bool        exact = true;       // mantissa has all the significant digits
+    };
+
+    static const char * scan_decimal ( const char * at, const char * end, DecimalNumber & num ) {
+        if ( at!=end && (*at=='+' || *at=='-') ) {
+            num.negative = *at=='-';
+            at++;
+        }
+        int nDigits = 0, nSignificant = 0;
+        for ( ; at!=end && is_digit(*at); ++at, ++nDigits ) {
+            if ( nSignificant < 19 ) {
+                num.mantissa = num.mantissa * 10 + uint64_t(*at - '0');
+                if ( num.mantissa ) nSignificant ++;
+            } else {
+                num.exp10 ++;
+                if ( *at!='0' ) num.exact = false;
+            }
+        }
+        if ( at!=end && *at=='.' ) {
+            for ( ++at; at!=end && is_digit(*at); ++at, ++nDigits ) {
+                if ( nSignificant < 19 ) {
+                    num.mantissa = num.mantissa * 10 + uint64_t(*at - '0');
+                    if ( num.mantissa ) nSignificant ++;
+                    num.exp10 --;
+                } else if ( *at!='0' ) {
+                    num.exact = false;
+                }
+            }
+        }
+        if ( !nDigits ) return nullptr;
+        if ( at!=end && (*at=='e' || *at=='E') ) {
+            const char * ex = at + 1;
+            bool negExp = false;
+            if ( ex!=end && (*ex=='+' || *ex=='-') ) {
+                negExp = *ex=='-';
+                ex++;
+            }
+            if ( ex!=end && is_digit(*ex) ) {
+                int e = 0;
+                for ( ; ex!=end && is_digit(*ex); ++ex ) {
+                    if ( e < 100000 ) e = e * 10 + (*ex - '0');
+                }
+                num.exp10 += negExp ? -e : e;
+                at = ex;
+            }
+        }
+        return at;
+    }
+
+    static __forceinline bool is_hex_prefix ( const char * at, const char * end ) {
+        return at!=end && (*at=='x' || *at=='X');
+    }
+
+    // anything the fast path can't do exactly (long mantissas, large exponents, inf, nan, hex) goes to libc
+    template <typename TT, typename FN>
+    static const char * parse_slow ( const char * str, const char * end, TT & value, FN && fn ) {
+        char buf[64];
+        string longText;
+        const char * text;
+        size_t len = size_t(end - str);
+        if ( len < sizeof(buf) ) {
+            memcpy(buf, str, len);
+            buf[len] = 0;
+            text = buf;
+        } else {
+            longText.assign(str, len);
+            text = longText.c_str();
+        }
+        char * endptr = nullptr;
+        value = (TT) fn(text, &endptr);
+        return endptr==text ? nullptr : str + (endptr - text);
+    }
+
+    const char * parse_double ( const char * str, const char * end, double & value ) {
+        static const double pow10[] = {
+            1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+            1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+        };
+        while ( str!=end && is_space(*str) ) str++;
+        DecimalNumber num;
+        const char * at = scan_decimal(str, end, num);
+        if ( at && num.exact && !is_hex_prefix(at,end) && num.mantissa <= (uint64_t(1) << 53) && num.exp10 >= -22 && num.exp10 <= 22 ) {
+            double res = double(num.mantissa);
+            res = num.exp10 < 0 ? res / pow10[-num.exp10] : res * pow10[num.exp10];
+            value = num.negative ? -res : res;
+            return at;
+        }
+        return parse_slow(str, end, value, [](const char * s, char ** e) { return strtod(s, e); });
+    }
+
+    const char * parse_float ( const char * str, const char * end, float & value ) {
+        static const float pow10[] = {
+            1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f
+        };
+        while ( str!=end && is_space(*str) ) str++;
+        DecimalNumber num;
+        const char * at = scan_decimal(str, end, num);
+        if ( at && num.exact && !is_hex_prefix(at,end) && num.mantissa <= (uint64_t(1) << 24) && num.exp10 >= -10 && num.exp10 <= 10 ) {
+            float res = float(num.mantissa);
+            res = num.exp10 < 0 ? res / pow10[-num.exp10] : res * pow10[num.exp10];
+            value = num.negative ? -res : res;
+            return at;
+        }
+        return parse_slow(str, end, value, [](const char * s, char ** e) { return strtof(s, e); });
+    }
+}
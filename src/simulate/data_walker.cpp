@@ -138,6 +138,9 @@ namespace das {
             walk_array(arr->data, getTypeSize(info->firstType), arr->size, info->firstType);
             if ( cancel ) return;
             afterArray(arr, info);
+        } else if ( info->type==Type::tSlice ) {
+            auto slice = (Slice *) pa;
+            walk_array(slice->data, slice->stride, slice->size, info->firstType);
         } else if ( info->type==Type::tTable ) {
             auto tab = (Table *) pa;
             beforeTable(tab, info);
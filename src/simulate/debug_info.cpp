@@ -47,6 +47,7 @@ namespace das
         {   Type::tFunction,    "function"},
         {   Type::tLambda,      "lambda"},
         {   Type::tTuple,       "tuple"},
+        {   Type::tSlice,       "slice"},
     };
 
     string das_to_string ( Type t ) {
@@ -95,6 +96,7 @@ namespace das
             case tFunction:     return sizeof(Func);
             case tLambda:       return sizeof(Lambda);
             case tTuple:        return 0;
+            case tSlice:        return sizeof(Slice);
             default:
                 DAS_ASSERTF(0, "not implemented. likely new built-intype been added, and support has not been updated.");
                 return 0;
@@ -139,6 +141,7 @@ namespace das
             case tFunction:     return alignof(Func);
             case tLambda:       return alignof(Lambda);
             case tTuple:        return 1;
+            case tSlice:        return alignof(Slice);
             default:
                 DAS_ASSERTF(0, "not implemented. likely new built-intype been added, and support has not been updated.");
                 return 0;
@@ -260,7 +263,7 @@ namespace das
         if ( THIS->type==Type::tStructure && THIS->structType!=decl->structType ) {
             return false;
         }
-        if ( THIS->type==Type::tPointer || THIS->type==Type::tIterator ) {
+        if ( THIS->type==Type::tPointer || THIS->type==Type::tIterator || THIS->type==Type::tSlice ) {
             if ( (THIS->firstType && !isVoid(THIS->firstType))
                 && (decl->firstType && !isVoid(decl->firstType))
                 && !isSameType(THIS->firstType, decl->firstType, true, true, false) ) {
@@ -359,6 +362,8 @@ namespace das
             stream << "Table<" << debug_type(info->firstType) << "," << debug_type(info->secondType) << ">";
         } else if ( info->type==Type::tIterator ) {
             stream << "Iterator<" << debug_type(info->firstType) << ">";
+        } else if ( info->type==Type::tSlice ) {
+            stream << "Slice<" << debug_type(info->firstType) << ">";
         } else {
             stream << das_to_string(info->type);
         }
@@ -30,14 +30,18 @@ namespace das {
     char * HeapAllocator::allocate ( uint32_t size ) {
         size = (size + 0x0f) & ~0x0f;
         bytesTotal += size;
+        char * data;
         if ( size < bigAllocationThreshold )
         {
-            return buddy.allocateNonEmpty(size);//since we allocate one page in constructor
+            data = buddy.allocateNonEmpty(size);//since we allocate one page in constructor
         } else {
-            char * data = (char *) das_aligned_alloc16(size);
+            data = (char *) das_aligned_alloc16(size);
             bigAllocations[data] = size;
-            return data;
         }
+        if ( zeroMemory ) {
+            memset(data, 0, size);
+        }
+        return data;
     }
 
     bool HeapAllocator::free ( char * data, uint32_t size ) {
@@ -122,6 +122,45 @@ namespace das
         return cast<char *>::from(iter);
     }
 
+    // Slice
+
+    Slice slice_make ( Context & context, char * data, uint32_t size, uint32_t stride, int32_t from, int32_t to ) {
+        if ( from<0 || to<from || uint32_t(to)>size ) {
+            context.throw_error_ex("slice range [%i,%i) out of bounds [0,%u)", from, to, size);
+            return Slice();
+        }
+        Slice slice;
+        slice.data = data + from*stride;
+        slice.size = uint32_t(to - from);
+        slice.stride = stride;
+        return slice;
+    }
+
+    vec4f SimNode_ArraySlice::eval ( Context & context ) {
+        Array * pA = (Array *) l->evalPtr(context);
+        range rng = cast<range>::to(r->eval(context));
+        return cast<Slice>::from(slice_make(context, pA->data, pA->size, stride, rng.from, rng.to));
+    }
+
+    vec4f SimNode_FixedArraySlice::eval ( Context & context ) {
+        char * data = l->evalPtr(context);
+        range rng = cast<range>::to(r->eval(context));
+        return cast<Slice>::from(slice_make(context, data, size, stride, rng.from, rng.to));
+    }
+
+    vec4f SimNode_SliceSlice::eval ( Context & context ) {
+        Slice slice = cast<Slice>::to(l->eval(context));
+        range rng = cast<range>::to(r->eval(context));
+        return cast<Slice>::from(slice_make(context, slice.data, slice.size, slice.stride, rng.from, rng.to));
+    }
+
+    vec4f SimNode_SliceIterator::eval ( Context & context ) {
+        Slice slice = cast<Slice>::to(source->eval(context));
+        char * iter = context.heap.allocate(sizeof(FixedArrayIterator));
+        new (iter) FixedArrayIterator(slice.data, slice.size, slice.stride);
+        return cast<char *>::from(iter);
+    }
+
     // delete
 
     vec4f SimNode_DeleteArray::eval ( Context & context ) {
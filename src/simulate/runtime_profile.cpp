@@ -1,6 +1,8 @@
 #include "daScript/misc/platform.h"
 
 #include "daScript/simulate/runtime_range.h"
+#include "daScript/simulate/runtime_profile.h"
+#include "daScript/simulate/simulate_visit_op.h"
 
 extern "C" int64_t ref_time_ticks ();
 extern "C" int get_time_usec (int64_t reft);
@@ -23,5 +25,125 @@ namespace das
         }
         return (float) tSec;
     }
-}
 
+    struct SimNode_ProfileFunction : SimNode {
+        SimNode_ProfileFunction ( SimNode * c, uint32_t se ) : SimNode(c->debugInfo), code(c), sampleEvery(se) {}
+        virtual vec4f eval ( Context & context ) override {
+            calls ++;
+            // recursive call is already timed by the outermost one
+            if ( depth ) {
+                depth ++;
+                auto res = code->eval(context);
+                depth --;
+                return res;
+            }
+            if ( outerCalls++ % sampleEvery ) {
+                depth ++;
+                auto res = code->eval(context);
+                depth --;
+                return res;
+            }
+            depth ++;
+            auto t0 = ref_time_ticks();
+            auto res = code->eval(context);
+            ticks += ref_time_ticks() - t0;
+            depth --;
+            samples ++;
+            return res;
+        }
+        virtual SimNode * visit ( SimVisitor & vis ) override {
+            V_BEGIN();
+            V_OP(ProfileFunction);
+            V_SUB(code);
+            V_END();
+        }
+        uint64_t usec() const {
+            if ( !samples ) return 0;
+            // ticks to usec
+            int64_t t = int64_t(ticks * outerCalls / samples);
+            return uint64_t(get_time_usec(ref_time_ticks() - t));
+        }
+        void reset() {
+            calls = outerCalls = samples = 0;
+            ticks = 0;
+            depth = 0;
+        }
+        SimNode *   code;
+        uint32_t    sampleEvery;
+        uint32_t    depth = 0;
+        uint64_t    calls = 0;
+        uint64_t    outerCalls = 0;
+        uint64_t    samples = 0;
+        uint64_t    ticks = 0;
+    };
+
+    void Context::profileFunctions ( bool enable, uint32_t sampleEvery ) {
+        if ( enable==profilingFunctions() ) {
+            return;
+        }
+        if ( enable ) {
+            profiledFunctions.resize(totalFunctions);
+            for ( int fni=0; fni!=totalFunctions; ++fni ) {
+                auto & fn = functions[fni];
+                profiledFunctions[fni] = code->makeNode<SimNode_ProfileFunction>(fn.code, das::max(sampleEvery, 1u));
+                fn.code = profiledFunctions[fni];
+            }
+        } else {
+            for ( int fni=0; fni!=totalFunctions; ++fni ) {
+                functions[fni].code = profiledFunctions[fni]->code;
+            }
+            profiledFunctions.clear();
+        }
+    }
+
+    void Context::resetFunctionProfile() {
+        for ( auto pf : profiledFunctions ) {
+            pf->reset();
+        }
+    }
+
+    void Context::getFunctionProfile ( vector<FunctionProfile> & profile ) const {
+        for ( int fni=0, fnis=int(profiledFunctions.size()); fni!=fnis; ++fni ) {
+            auto pf = profiledFunctions[fni];
+            if ( pf->calls ) {
+                FunctionProfile fp;
+                fp.mangledName = functions[fni].mangledName;
+                fp.calls = pf->calls;
+                fp.usec = pf->usec();
+                profile.push_back(fp);
+            }
+        }
+    }
+
+    void writeFunctionProfile ( TextWriter & tw, const vector<FunctionProfile> & profile ) {
+        tw << "// calls usec function\n";
+        for ( auto & fp : profile ) {
+            tw << fp.calls << " " << fp.usec << " " << fp.mangledName << "\n";
+        }
+    }
+
+    bool readFunctionProfile ( const string & text, vector<FunctionProfile> & profile ) {
+        size_t at = 0;
+        while ( at < text.length() ) {
+            auto eol = text.find('\n', at);
+            if ( eol==string::npos ) eol = text.length();
+            string line = text.substr(at, eol-at);
+            at = eol + 1;
+            if ( !line.empty() && line.back()=='\r' ) line.pop_back();
+            if ( line.empty() || line.compare(0,2,"//")==0 ) {
+                continue;
+            }
+            FunctionProfile fp;
+            unsigned long long calls = 0, usec = 0;
+            int nameAt = 0;
+            if ( sscanf(line.c_str(), "%llu %llu %n", &calls, &usec, &nameAt)<2 || nameAt==0 ) {
+                return false;
+            }
+            fp.calls = calls;
+            fp.usec = usec;
+            fp.mangledName = line.substr(nameAt);
+            profile.push_back(fp);
+        }
+        return true;
+    }
+}
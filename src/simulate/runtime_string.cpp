@@ -176,6 +176,90 @@ namespace das
         return cast<char *>::from(pStr);
     }
 
+    // string builder, scalar path
+    //  arguments are formatted into the scratch buffer first (strings are not copied),
+    //  so that the result can be allocated once, with its exact length.
+    //  formatting matches DebugDataWalker with PrintFlags::string_builder
+
+    static __forceinline int sb_format_hex ( char * buf, uint64_t value ) {
+        char tmp[16];
+        int n = 0;
+        do {
+            tmp[n++] = "0123456789abcdef"[value & 15];
+            value >>= 4;
+        } while ( value );
+        buf[0] = '0';
+        buf[1] = 'x';
+        for ( int i=0; i!=n; ++i ) {
+            buf[i+2] = tmp[n-i-1];
+        }
+        return n + 2;
+    }
+
+    char * string_builder_scalar ( Context & context, const vec4f * args, TypeInfo ** types, int nArgs ) {
+        const int scratchSize = DAS_NUMBER_BUFFER_SIZE;
+        char * scratch = (char *)(alloca(nArgs * scratchSize));
+        const char ** text = (const char **)(alloca(nArgs * sizeof(const char *)));
+        uint32_t * length = (uint32_t *)(alloca(nArgs * sizeof(uint32_t)));
+        uint32_t total = 0;
+        for ( int i=0; i!=nArgs; ++i ) {
+            char * buf = scratch + i*scratchSize;
+            const char * str = buf;
+            int len = 0;
+            switch ( types[i]->type ) {
+                case Type::tString:
+                    str = cast<char *>::to(args[i]);
+                    len = stringLengthSafe(context, str);
+                    break;
+                case Type::tBool:
+                    str = cast<bool>::to(args[i]) ? "true" : "false";
+                    len = int(strlen(str));
+                    break;
+                case Type::tInt8:   len = fmt_int64(buf, cast<int8_t>::to(args[i])); break;
+                case Type::tInt16:  len = fmt_int64(buf, cast<int16_t>::to(args[i])); break;
+                case Type::tInt:    len = fmt_int64(buf, cast<int32_t>::to(args[i])); break;
+                case Type::tInt64:  len = fmt_int64(buf, cast<int64_t>::to(args[i])); break;
+                case Type::tUInt8:  len = sb_format_hex(buf, cast<uint8_t>::to(args[i])); break;
+                case Type::tUInt16: len = sb_format_hex(buf, cast<uint16_t>::to(args[i])); break;
+                case Type::tUInt:   len = sb_format_hex(buf, cast<uint32_t>::to(args[i])); break;
+                case Type::tUInt64: len = sb_format_hex(buf, cast<uint64_t>::to(args[i])); break;
+                case Type::tFloat:  len = snprintf(buf, scratchSize, "%g", cast<float>::to(args[i])); break;
+                case Type::tDouble: len = snprintf(buf, scratchSize, "%g", cast<double>::to(args[i])); break;
+                default:
+                    DAS_ASSERTF(0, "unsupported scalar string builder argument type");
+                    break;
+            }
+            text[i] = str;
+            length[i] = uint32_t(len);
+            total += uint32_t(len);
+        }
+        if ( !total ) {
+            return nullptr;
+        }
+        char * data = context.heap.allocate(total + sizeof(StringHeader) + 1);
+        if ( !data ) {
+            context.throw_error("can't allocate string builder result, out of heap");
+            return nullptr;
+        }
+        auto header = (StringHeader *) data;
+        header->hash = 0;
+        header->length = total;
+        char * str = data + sizeof(StringHeader);
+        char * at = str;
+        for ( int i=0; i!=nArgs; ++i ) {
+            memcpy(at, text[i], length[i]);
+            at += length[i];
+        }
+        *at = 0;
+        return str;
+    }
+
+    vec4f SimNode_StringBuilderScalar::eval ( Context & context ) {
+        vec4f * argValues = (vec4f *)(alloca(nArguments * sizeof(vec4f)));
+        evalArgs(context, argValues);
+        return cast<char *>::from(string_builder_scalar(context, argValues, types, nArguments));
+    }
+
     vec4f SimNode_DeleteString::eval ( Context & context ) {
         char ** str = (char**)(subexpr->evalPtr(context));
         str = str + total - 1;
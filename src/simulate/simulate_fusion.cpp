@@ -88,22 +88,24 @@ namespace das {
         map<SimNode *,SimNodeInfo> & info;
     };
 
+    bool fusion ( Context & context, SimFunction * fn, TextWriter & logs ) {
+        bool anyFusion = false;
+        for ( ;; ) {
+            SimNodeCollector collector;
+            fn->code->visit(collector);
+            SimFusion fuse(&context, logs, move(collector.info));
+            fn->code = fn->code->visit(fuse);
+            if ( !fuse.fused ) break;
+            anyFusion = true;
+        }
+        return anyFusion;
+    }
+
     void Program::fusion ( Context & context, TextWriter & logs ) {
-        // log all functions
         if ( options.getOption("fusion",true) ) {
-            bool anyFusion = true;
-            while ( anyFusion) {
-                anyFusion = false;
-                for ( int i=0; i!=context.totalFunctions; ++i ) {
-                    SimFunction * fn = context.getFunction(i);
-                    SimNodeCollector collector;
-                    fn->code->visit(collector);
-                    SimFusion fuse(&context, logs, move(collector.info));
-                    fn->code = fn->code->visit(fuse);
-                    anyFusion |= fuse.fused;
-                }
+            for ( int i=0; i!=context.totalFunctions; ++i ) {
+                das::fusion(context, context.getFunction(i), logs);
             }
         }
     }
 }
-
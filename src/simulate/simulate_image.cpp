@@ -0,0 +1,558 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate_image.h"
+#include "daScript/ast/ast.h"
+
+#if defined(__linux__)
+#include <link.h>
+#endif
+
+namespace das {
+
+#if defined(__linux__)
+
+    static const uint64_t   image_magic = 0x45474d4953414444ull;   // DDASIMGE
+    static const uint32_t   image_version = 1;
+
+    enum class ImageRef : uint32_t {
+        data,           // not a pointer
+        arena,          // offset in the region
+        executable,     // offset from the executable base
+        file,           // file info index
+        module,         // module index
+        annotation      // annotation index
+    };
+
+    struct ImageRelocation {
+        uint32_t    region;
+        uint32_t    offset;
+        ImageRef    kind;
+        uint32_t    target;
+    };
+
+    struct ImageRegion {
+        char *      data;
+        uint32_t    size;
+        uint32_t    arena;  // 0 - code, 1 - debug info
+    };
+
+    // executable, which contains daScript. all the nodes are instantiated by it
+    struct ImageExecutable {
+        uintptr_t                           base = 0;
+        uint64_t                            stamp = 0;
+        vector<pair<uintptr_t,uintptr_t>>   segments;
+    };
+
+    static void hashBytes ( uint64_t & hash, const void * data, size_t size ) {
+        auto bytes = (const uint8_t *) data;
+        for ( size_t i=0; i!=size; ++i ) {
+            hash = (hash ^ bytes[i]) * 1099511628211ull;
+        }
+    }
+
+    static const ImageExecutable & getImageExecutable() {
+        static ImageExecutable exe;
+        static bool initialized = false;
+        if ( !initialized ) {
+            initialized = true;
+            exe.stamp = 14695981039346656037ull;
+            dl_iterate_phdr([](struct dl_phdr_info * info, size_t, void *) -> int {
+                auto anchor = uintptr_t(&getImageExecutable);
+                bool found = false;
+                for ( int i=0; i!=info->dlpi_phnum; ++i ) {
+                    auto & ph = info->dlpi_phdr[i];
+                    auto from = info->dlpi_addr + ph.p_vaddr;
+                    if ( ph.p_type==PT_LOAD && anchor>=from && anchor<from+ph.p_memsz ) {
+                        found = true;
+                    }
+                }
+                if ( !found ) return 0;
+                exe.base = info->dlpi_addr;
+                for ( int i=0; i!=info->dlpi_phnum; ++i ) {
+                    auto & ph = info->dlpi_phdr[i];
+                    if ( ph.p_type==PT_LOAD ) {
+                        exe.segments.emplace_back(info->dlpi_addr+ph.p_vaddr, info->dlpi_addr+ph.p_vaddr+ph.p_memsz);
+                        uint64_t layout[3] = { ph.p_vaddr, ph.p_memsz, ph.p_filesz };
+                        hashBytes(exe.stamp, layout, sizeof(layout));
+                    } else if ( ph.p_type==PT_NOTE ) {
+                        // build id, when there is one
+                        hashBytes(exe.stamp, (void *)(info->dlpi_addr+ph.p_vaddr), ph.p_memsz);
+                    }
+                }
+                return 1;
+            }, nullptr);
+        }
+        return exe;
+    }
+
+    // all the memory of the process, which can be referenced. anything else is not a pointer
+    static vector<pair<uintptr_t,uintptr_t>> getMappedMemory() {
+        vector<pair<uintptr_t,uintptr_t>> mapped;
+        if ( FILE * f = fopen("/proc/self/maps","r") ) {
+            char line[1024];
+            while ( fgets(line, sizeof(line), f) ) {
+                unsigned long long from, to;
+                if ( sscanf(line, "%llx-%llx", &from, &to)==2 ) {
+                    mapped.emplace_back(uintptr_t(from), uintptr_t(to));
+                }
+            }
+            fclose(f);
+        }
+        return mapped;
+    }
+
+    static bool inRanges ( const vector<pair<uintptr_t,uintptr_t>> & ranges, uintptr_t ptr ) {
+        for ( auto & r : ranges ) {
+            if ( ptr>=r.first && ptr<r.second ) return true;
+        }
+        return false;
+    }
+
+    static vector<ImageRegion> getImageRegions ( Context & context ) {
+        vector<ImageRegion> regions;
+        uint32_t arena = 0;
+        auto addRegion = [&]( char * data, uint32_t size ) {
+            if ( size ) regions.push_back({data, size, arena});
+        };
+        context.code->forEachChunk(addRegion);
+        arena = 1;
+        context.debugInfo->forEachChunk(addRegion);
+        return regions;
+    }
+
+    // region index and offset of the pointer. pointer to the end of the region belongs to it as well
+    static bool findInRegions ( const vector<ImageRegion> & regions, uintptr_t ptr, uint32_t & region, uint32_t & offset ) {
+        for ( uint32_t i=0; i!=uint32_t(regions.size()); ++i ) {
+            auto & r = regions[i];
+            if ( ptr>=uintptr_t(r.data) && ptr<=uintptr_t(r.data)+r.size ) {
+                region = i;
+                offset = uint32_t(ptr - uintptr_t(r.data));
+                return true;
+            }
+        }
+        return false;
+    }
+
+    struct ImageFileCollector : SimVisitor {
+        map<FileInfo *,uint32_t> files;
+        virtual void preVisit ( SimNode * node ) override {
+            if ( auto fi = node->debugInfo.fileInfo ) {
+                files.insert(make_pair(fi, uint32_t(files.size())));
+            }
+        }
+        void collect ( SimNode * node ) {
+            if ( node ) node->visit(*this);
+        }
+    };
+
+    struct ImageWriter {
+        vector<uint8_t> & data;
+        ImageWriter ( vector<uint8_t> & d ) : data(d) {}
+        void write ( const void * bytes, size_t size ) {
+            auto b = (const uint8_t *) bytes;
+            data.insert(data.end(), b, b + size);
+        }
+        template <typename TT>
+        void write ( const TT & value ) {
+            write(&value, sizeof(TT));
+        }
+        void writeString ( const string & str ) {
+            write(uint32_t(str.length()));
+            write(str.c_str(), str.length());
+        }
+    };
+
+    struct ImageReader {
+        const vector<uint8_t> & data;
+        size_t offset = 0;
+        bool failed = false;
+        ImageReader ( const vector<uint8_t> & d ) : data(d) {}
+        const uint8_t * read ( size_t size ) {
+            if ( failed || offset + size > data.size() ) {
+                failed = true;
+                return nullptr;
+            }
+            auto res = data.data() + offset;
+            offset += size;
+            return res;
+        }
+        template <typename TT>
+        TT read () {
+            TT value;
+            if ( auto bytes = read(sizeof(TT)) ) {
+                memcpy(&value, bytes, sizeof(TT));
+            } else {
+                memset(&value, 0, sizeof(TT));
+            }
+            return value;
+        }
+        string readString () {
+            auto len = read<uint32_t>();
+            auto bytes = read(len);
+            return bytes ? string((const char *)bytes, len) : string();
+        }
+    };
+
+    struct ImageBuilder {
+        vector<ImageRegion>                 regionsA, regionsB;
+        vector<pair<uintptr_t,uintptr_t>>   mapped;
+        map<uintptr_t,pair<ImageRef,uint32_t>> known;
+        const ImageExecutable &             exe = getImageExecutable();
+        string                              error;
+        // classifies the pointer-sized word at the same location of both simulations
+        bool classify ( uint64_t wa, uint64_t wb, ImageRef & kind, uint32_t & target, uint64_t & value ) {
+            kind = ImageRef::data;
+            target = 0;
+            value = wa;
+            if ( wa != wb ) {
+                // only pointers into arenas can differ
+                uint32_t ra, oa, rb, ob;
+                if ( findInRegions(regionsA, uintptr_t(wa), ra, oa)
+                        && findInRegions(regionsB, uintptr_t(wb), rb, ob) && ra==rb && oa==ob ) {
+                    kind = ImageRef::arena;
+                    target = ra;
+                    value = oa;
+                    return true;
+                }
+                error = "simulation is not deterministic";
+                return false;
+            }
+            if ( !wa || !inRanges(mapped, uintptr_t(wa)) ) {
+                return true;
+            }
+            auto it = known.find(uintptr_t(wa));
+            if ( it != known.end() ) {
+                kind = it->second.first;
+                target = it->second.second;
+                value = 0;
+                return true;
+            }
+            if ( inRanges(exe.segments, uintptr_t(wa)) ) {
+                kind = ImageRef::executable;
+                value = wa - exe.base;
+                return true;
+            }
+            error = "unknown pointer";
+            return false;
+        }
+    };
+
+    bool ContextImage::build ( Context & a, Context & b, const Symbols & symbols, TextWriter & logs ) {
+        data.clear();
+        ImageBuilder ib;
+        if ( ib.exe.segments.empty() ) {
+            logs << "context image: can't locate executable\n";
+            return false;
+        }
+        ib.regionsA = getImageRegions(a);
+        ib.regionsB = getImageRegions(b);
+        if ( ib.regionsA.size()!=ib.regionsB.size() ) {
+            logs << "context image: simulation is not deterministic, region count mismatch\n";
+            return false;
+        }
+        for ( size_t i=0; i!=ib.regionsA.size(); ++i ) {
+            if ( ib.regionsA[i].size!=ib.regionsB[i].size || ib.regionsA[i].arena!=ib.regionsB[i].arena ) {
+                logs << "context image: simulation is not deterministic, region size mismatch\n";
+                return false;
+            }
+        }
+        ib.mapped = getMappedMemory();
+        // known objects
+        ImageFileCollector files;
+        for ( int i=0; i!=a.totalFunctions; ++i ) files.collect(a.functions[i].code);
+        for ( int i=0; i!=a.totalVariables; ++i ) files.collect(a.globalVariables[i].init);
+        files.collect(a.aotInitScript);
+        vector<FileInfo *> fileList(files.files.size());
+        for ( auto & it : files.files ) {
+            fileList[it.second] = it.first;
+            ib.known[uintptr_t(it.first)] = make_pair(ImageRef::file, it.second);
+        }
+        for ( uint32_t i=0; i!=uint32_t(symbols.modules.size()); ++i ) {
+            ib.known[uintptr_t(symbols.modules[i])] = make_pair(ImageRef::module, i);
+        }
+        for ( uint32_t i=0; i!=uint32_t(symbols.annotations.size()); ++i ) {
+            ib.known[uintptr_t(symbols.annotations[i])] = make_pair(ImageRef::annotation, i);
+        }
+        // regions
+        vector<vector<uint8_t>> bytes(ib.regionsA.size());
+        vector<ImageRelocation> relocations;
+        for ( uint32_t ri=0; ri!=uint32_t(ib.regionsA.size()); ++ri ) {
+            auto & ra = ib.regionsA[ri];
+            auto & rb = ib.regionsB[ri];
+            bytes[ri].assign((uint8_t *)ra.data, (uint8_t *)ra.data + ra.size);
+            for ( uint32_t ofs=0; ofs+sizeof(uint64_t)<=ra.size; ofs+=sizeof(uint64_t) ) {
+                uint64_t wa, wb;
+                memcpy(&wa, ra.data + ofs, sizeof(uint64_t));
+                memcpy(&wb, rb.data + ofs, sizeof(uint64_t));
+                ImageRef kind; uint32_t target; uint64_t value;
+                if ( !ib.classify(wa, wb, kind, target, value) ) {
+                    logs << "context image: " << ib.error << " at region " << ri << " offset " << ofs << "\n";
+                    return false;
+                }
+                if ( kind!=ImageRef::data ) {
+                    relocations.push_back({ri, ofs, kind, target});
+                    memcpy(bytes[ri].data() + ofs, &value, sizeof(uint64_t));
+                }
+            }
+        }
+        // context tables
+        vector<pair<uint32_t,uint64_t>> refs;
+        vector<ImageRef> refKinds;
+        auto addRef = [&]( const void * pa, const void * pb ) -> bool {
+            ImageRef kind; uint32_t target; uint64_t value;
+            if ( !ib.classify(uint64_t(pa), uint64_t(pb), kind, target, value) ) return false;
+            if ( kind!=ImageRef::data && kind!=ImageRef::arena ) return false;
+            if ( kind==ImageRef::data && value ) return false;
+            refKinds.push_back(kind);
+            refs.push_back(make_pair(target, value));
+            return true;
+        };
+        if ( !addRef(a.globalVariables, b.globalVariables) || !addRef(a.functions, b.functions)
+                || !addRef(a.aotInitScript, b.aotInitScript) || !addRef(a.tabMnLookup, b.tabMnLookup)
+                || !addRef(a.tabAdLookup, b.tabAdLookup) ) {
+            logs << "context image: context tables are not in the code\n";
+            return false;
+        }
+        for ( auto & it : a.debugInfo->lookup ) {
+            auto itB = b.debugInfo->lookup.find(it.first);
+            if ( itB==b.debugInfo->lookup.end() || !addRef(it.second, itB->second) ) {
+                logs << "context image: type info lookup mismatch\n";
+                return false;
+            }
+        }
+        // and write it all
+        ImageWriter iw(data);
+        iw.write(image_magic);
+        iw.write(image_version);
+        iw.write(ib.exe.stamp);
+        iw.write(uint32_t(ib.regionsA.size()));
+        for ( uint32_t ri=0; ri!=uint32_t(ib.regionsA.size()); ++ri ) {
+            iw.write(ib.regionsA[ri].arena);
+            iw.write(ib.regionsA[ri].size);
+            iw.write(bytes[ri].data(), bytes[ri].size());
+        }
+        iw.write(uint32_t(relocations.size()));
+        iw.write(relocations.data(), relocations.size()*sizeof(ImageRelocation));
+        iw.write(uint32_t(fileList.size()));
+        for ( auto fi : fileList ) iw.writeString(fi->name);
+        iw.write(uint32_t(symbols.modules.size()));
+        for ( auto pm : symbols.modules ) iw.writeString(pm->name);
+        iw.write(uint32_t(symbols.annotations.size()));
+        for ( auto ann : symbols.annotations ) {
+            iw.writeString(ann->module ? ann->module->name : string());
+            iw.writeString(ann->name);
+        }
+        for ( size_t i=0; i!=5; ++i ) {
+            iw.write(refKinds[i]);
+            iw.write(refs[i].first);
+            iw.write(refs[i].second);
+        }
+        iw.write(a.globalsSize);
+        iw.write(a.globalInitStackSize);
+        iw.write(a.totalVariables);
+        iw.write(a.totalFunctions);
+        iw.write(a.tabMnMask);
+        iw.write(a.tabMnRot);
+        iw.write(a.tabAdMask);
+        iw.write(a.tabAdRot);
+        iw.write(uint32_t(a.debugInfo->lookup.size()));
+        size_t li = 5;
+        for ( auto & it : a.debugInfo->lookup ) {
+            iw.write(it.first);
+            iw.write(refKinds[li]);
+            iw.write(refs[li].first);
+            iw.write(refs[li].second);
+            li ++;
+        }
+        return true;
+    }
+
+    // code allocator of the instantiated context owns the file infos, which nodes point to
+    class ImageNodeAllocator : public NodeAllocator {
+    public:
+        vector<FileInfoPtr> files;
+    };
+
+    bool ContextImage::instantiate ( Context & context, TextWriter & logs ) const {
+        const auto & exe = getImageExecutable();
+        ImageReader ir(data);
+        if ( ir.read<uint64_t>()!=image_magic || ir.read<uint32_t>()!=image_version ) {
+            logs << "context image: not an image\n";
+            return false;
+        }
+        if ( exe.segments.empty() || ir.read<uint64_t>()!=exe.stamp ) {
+            logs << "context image: produced by a different executable\n";
+            return false;
+        }
+        auto code = make_shared<ImageNodeAllocator>();
+        auto debugInfo = make_shared<DebugInfoAllocator>();
+        uint32_t numRegions = ir.read<uint32_t>();
+        vector<char *> regions;
+        vector<uint32_t> regionSizes;
+        for ( uint32_t ri=0; ri!=numRegions && !ir.failed; ++ri ) {
+            uint32_t arena = ir.read<uint32_t>();
+            uint32_t size = ir.read<uint32_t>();
+            auto bytes = ir.read(size);
+            if ( !bytes ) break;
+            char * region = arena ? debugInfo->allocate(size) : code->allocate(size);
+            memcpy(region, bytes, size);
+            regions.push_back(region);
+            regionSizes.push_back(size);
+        }
+        vector<ImageRelocation> relocations(ir.read<uint32_t>());
+        if ( auto bytes = ir.read(relocations.size()*sizeof(ImageRelocation)) ) {
+            memcpy(relocations.data(), bytes, relocations.size()*sizeof(ImageRelocation));
+        }
+        vector<FileInfo *> files(ir.read<uint32_t>());
+        for ( auto & fi : files ) {
+            auto info = make_unique<FileInfo>();
+            info->name = ir.readString();
+            fi = info.get();
+            code->files.push_back(move(info));
+        }
+        // modules and annotations are only resolved, when something points to them
+        vector<string> moduleNames(ir.read<uint32_t>());
+        for ( auto & name : moduleNames ) {
+            name = ir.readString();
+        }
+        vector<pair<string,string>> annotationNames(ir.read<uint32_t>());
+        for ( auto & name : annotationNames ) {
+            name.first = ir.readString();
+            name.second = ir.readString();
+        }
+        if ( ir.failed ) {
+            logs << "context image: truncated\n";
+            return false;
+        }
+        string missing;
+        auto resolve = [&]( ImageRef kind, uint32_t target, uint64_t value ) -> uint64_t {
+            switch ( kind ) {
+                case ImageRef::data:
+                    return value;
+                case ImageRef::arena:
+                    if ( target<regions.size() ) return uint64_t(regions[target]) + value;
+                    break;
+                case ImageRef::executable:
+                    return uint64_t(exe.base) + value;
+                case ImageRef::file:
+                    if ( target<files.size() ) return uint64_t(files[target]);
+                    break;
+                case ImageRef::module:
+                    if ( target<moduleNames.size() ) {
+                        if ( auto pm = Module::require(moduleNames[target]) ) return uint64_t(pm);
+                        missing = "module " + moduleNames[target];
+                        return 0;
+                    }
+                    break;
+                case ImageRef::annotation:
+                    if ( target<annotationNames.size() ) {
+                        auto & name = annotationNames[target];
+                        if ( auto pm = Module::require(name.first) ) {
+                            if ( auto ann = pm->findAnnotation(name.second) ) return uint64_t(ann.get());
+                        }
+                        missing = "annotation " + name.first + "::" + name.second;
+                        return 0;
+                    }
+                    break;
+            }
+            missing = "invalid reference";
+            return 0;
+        };
+        for ( auto & rel : relocations ) {
+            if ( rel.region>=regions.size() || rel.offset+sizeof(uint64_t)>regionSizes[rel.region] ) {
+                logs << "context image: invalid relocation\n";
+                return false;
+            }
+            uint64_t value;
+            char * at = regions[rel.region] + rel.offset;
+            memcpy(&value, at, sizeof(uint64_t));
+            value = resolve(rel.kind, rel.target, value);
+            memcpy(at, &value, sizeof(uint64_t));
+        }
+        auto readRef = [&]() -> void * {
+            auto kind = ir.read<ImageRef>();
+            auto target = ir.read<uint32_t>();
+            auto value = ir.read<uint64_t>();
+            return (void *) resolve(kind, target, value);
+        };
+        auto globalVariables = (GlobalVariable *) readRef();
+        auto functions = (SimFunction *) readRef();
+        auto aotInitScript = (SimNode *) readRef();
+        auto tabMnLookup = (uint32_t *) readRef();
+        auto tabAdLookup = (uint64_t *) readRef();
+        context.globalsSize = ir.read<uint32_t>();
+        context.globalInitStackSize = ir.read<uint32_t>();
+        context.totalVariables = ir.read<int>();
+        context.totalFunctions = ir.read<int>();
+        context.tabMnMask = ir.read<uint32_t>();
+        context.tabMnRot = ir.read<uint32_t>();
+        context.tabAdMask = ir.read<uint32_t>();
+        context.tabAdRot = ir.read<uint32_t>();
+        uint32_t numLookup = ir.read<uint32_t>();
+        for ( uint32_t i=0; i!=numLookup && !ir.failed; ++i ) {
+            auto hash = ir.read<uint32_t>();
+            debugInfo->lookup[hash] = (TypeInfo *) readRef();
+        }
+        if ( ir.failed || !missing.empty() ) {
+            logs << "context image: " << (ir.failed ? string("truncated") : "missing " + missing) << "\n";
+            return false;
+        }
+        context.code = code;
+        context.debugInfo = debugInfo;
+        context.thisProgram = nullptr;
+        context.thisHelper = nullptr;
+        context.globalVariables = globalVariables;
+        context.functions = functions;
+        context.aotInitScript = aotInitScript;
+        context.tabMnLookup = tabMnLookup;
+        context.tabAdLookup = tabAdLookup;
+        if ( context.globals ) {
+            das_aligned_free16(context.globals);
+        }
+        context.globals = (char *) das_aligned_alloc16(context.globalsSize);
+        context.restart();
+        context.runInitScript();
+        context.restart();
+        return true;
+    }
+
+#else
+
+    bool ContextImage::build ( Context &, Context &, const Symbols &, TextWriter & logs ) {
+        logs << "context image: not supported on this platform\n";
+        return false;
+    }
+
+    bool ContextImage::instantiate ( Context &, TextWriter & logs ) const {
+        logs << "context image: not supported on this platform\n";
+        return false;
+    }
+
+#endif
+
+    bool ContextImage::save ( const string & fileName ) const {
+        FILE * f = fopen(fileName.c_str(), "wb");
+        if ( !f ) return false;
+        bool ok = fwrite(data.data(), 1, data.size(), f)==data.size();
+        fclose(f);
+        return ok;
+    }
+
+    bool ContextImage::load ( const string & fileName ) {
+        data.clear();
+        FILE * f = fopen(fileName.c_str(), "rb");
+        if ( !f ) return false;
+        fseek(f, 0, SEEK_END);
+        long size = ftell(f);
+        fseek(f, 0, SEEK_SET);
+        bool ok = size >= 0;
+        if ( ok ) {
+            data.resize(size_t(size));
+            ok = fread(data.data(), 1, data.size(), f)==data.size();
+        }
+        fclose(f);
+        if ( !ok ) data.clear();
+        return ok;
+    }
+}
+
@@ -119,6 +119,13 @@ namespace das {
         V_END();
     }
 
+    SimNode * SimNode_StringBuilderScalar::visit ( SimVisitor & vis ) {
+        V_BEGIN();
+        V_OP(StringBuilderScalar);
+        V_CALL();
+        V_END();
+    }
+
     SimNode * SimNode_Debug::visit ( SimVisitor & vis ) {
         V_BEGIN();
         V_OP(Debug);
@@ -686,6 +693,49 @@ namespace das {
         V_END();
     }
 
+    SimNode * SimNode_ArraySlice::visit ( SimVisitor & vis ) {
+        V_BEGIN();
+        V_OP(ArraySlice);
+        V_SUB(l);
+        V_SUB(r);
+        V_ARG(stride);
+        V_END();
+    }
+
+    SimNode * SimNode_FixedArraySlice::visit ( SimVisitor & vis ) {
+        V_BEGIN();
+        V_OP(FixedArraySlice);
+        V_SUB(l);
+        V_SUB(r);
+        V_ARG(size);
+        V_ARG(stride);
+        V_END();
+    }
+
+    SimNode * SimNode_SliceSlice::visit ( SimVisitor & vis ) {
+        V_BEGIN();
+        V_OP(SliceSlice);
+        V_SUB(l);
+        V_SUB(r);
+        V_END();
+    }
+
+    SimNode * SimNode_SliceAt::visit ( SimVisitor & vis ) {
+        V_BEGIN();
+        V_OP(SliceAt);
+        V_SUB(l);
+        V_SUB(r);
+        V_ARG(offset);
+        V_END();
+    }
+
+    SimNode * SimNode_SliceIterator::visit ( SimVisitor & vis ) {
+        V_BEGIN();
+        V_OP(SliceIterator);
+        V_SUB(source);
+        V_END();
+    }
+
     SimNode * SimNode_DeleteArray::visit ( SimVisitor & vis ) {
         V_BEGIN();
         V_OP(DeleteArray);
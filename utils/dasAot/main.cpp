@@ -1,9 +1,17 @@
 #include "daScript/daScript.h"
 #include "daScript/simulate/fs_file_info.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#include <thread>
 
 using namespace das;
 
 static bool quiet = false;
+static bool wholeProject = false;   // script modules are generated with the program, and called directly
+static bool report = false;         // lists functions, which stay interpreted, and why
+static string profileFile;          // function profile. functions, which are not hot in it, stay interpreted
+static int hotFunctions = 0;        // with the profile, how many of the hottest functions get AOT. 0 is all which were called
+static map<Function *,string> coldFunctions;
 
 TextPrinter tout;
 
@@ -17,10 +25,394 @@ bool saveToFile ( const string & fname, const string & str ) {
         return false;
     }
     fwrite ( str.c_str(), str.length(), 1, f );
+    fclose ( f );
+    return true;
+}
+
+// files which did not change are not touched, so that C++ build does not recompile them
+bool saveToFileIfChanged ( const string & fname, const string & str ) {
+    if ( FILE * f = fopen ( fname.c_str(), "rb" ) ) {
+        fseek(f, 0, SEEK_END);
+        long size = ftell(f);
+        fseek(f, 0, SEEK_SET);
+        bool same = false;
+        if ( size==long(str.length()) ) {
+            string data(size_t(size), 0);
+            same = fread(&data[0], 1, data.length(), f)==data.length() && data==str;
+        }
+        fclose(f);
+        if ( same ) {
+            if ( !quiet )  {
+                tout << fname << " is up to date\n";
+            }
+            return true;
+        }
+    }
+    return saveToFile(fname, str);
+}
+
+void writePragmaPush ( TextWriter & tw ) {
+    tw << "#if defined(_MSC_VER)\n";
+    tw << "#pragma warning(push)\n";
+    tw << "#pragma warning(disable:4100)   // unreferenced formal parameter\n";
+    tw << "#pragma warning(disable:4189)   // local variable is initialized but not referenced\n";
+    tw << "#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data\n";
+    tw << "#pragma warning(disable:4114)   // same qualifier more than once\n";
+    tw << "#elif defined(__GNUC__) && !defined(__clang__)\n";
+    tw << "#pragma GCC diagnostic push\n";
+    tw << "#pragma GCC diagnostic ignored \"-Wunused-parameter\"\n";
+    tw << "#pragma GCC diagnostic ignored \"-Wunused-variable\"\n";
+    tw << "#pragma GCC diagnostic ignored \"-Wunused-function\"\n";
+    tw << "#pragma GCC diagnostic ignored \"-Wwrite-strings\"\n";
+    tw << "#pragma GCC diagnostic ignored \"-Wreturn-local-addr\"\n";
+    tw << "#pragma GCC diagnostic ignored \"-Wignored-qualifiers\"\n";
+    tw << "#pragma GCC diagnostic ignored \"-Wsign-compare\"\n";
+    tw << "#elif defined(__clang__)\n";
+    tw << "#pragma clang diagnostic push\n";
+    tw << "#pragma clang diagnostic ignored \"-Wunused-parameter\"\n";
+    tw << "#pragma clang diagnostic ignored \"-Wwritable-strings\"\n";
+    tw << "#pragma clang diagnostic ignored \"-Wunused-variable\"\n";
+    tw << "#pragma clang diagnostic ignored \"-Wunsequenced\"\n";
+    tw << "#pragma clang diagnostic ignored \"-Wunused-function\"\n";
+    tw << "#endif\n";
+    tw << "\n";
+}
+
+void writePragmaPop ( TextWriter & tw ) {
+    tw << "#if defined(_MSC_VER)\n";
+    tw << "#pragma warning(pop)\n";
+    tw << "#elif defined(__GNUC__) && !defined(__clang__)\n";
+    tw << "#pragma GCC diagnostic pop\n";
+    tw << "#elif defined(__clang__)\n";
+    tw << "#pragma clang diagnostic pop\n";
+    tw << "#endif\n";
+}
+
+// returns true if AOT is disabled by one of the modules
+bool writeIncludes ( TextWriter & tw, const ProgramPtr & program ) {
+    bool noAot = false;
+    tw << "#include \"daScript/misc/platform.h\"\n\n";
+    tw << "#include \"daScript/simulate/simulate.h\"\n";
+    tw << "#include \"daScript/simulate/aot.h\"\n";
+    tw << "#include \"daScript/simulate/aot_library.h\"\n";
+    tw << "\n";
+    // lets comment on required modules
+    program->library.foreach([&](Module * mod){
+        if ( mod->name=="" ) {
+            // nothing, its main program module. i.e ::
+        } else {
+            if ( mod->name=="$" ) {
+                tw << " // require builtin\n";
+            } else {
+                tw << " // require " << mod->name << "\n";
+            }
+            if ( wholeProject && !mod->builtIn ) {
+                tw << "  // generated with the program\n";
+            } else if ( mod->aotRequire(tw)==ModuleAotType::no_aot ) {
+                tw << "  // AOT disabled due to this module\n";
+                noAot = true;
+            }
+        }
+        return true;
+    },"*");
+    tw << "\n";
+    return noAot;
+}
+
+void writeReport ( const ProgramPtr & program, const AotCppPreparedPtr & prepared, bool noAot ) {
+    if ( !report ) {
+        return;
+    }
+    if ( noAot ) {
+        tout << "AOT disabled, whole program is interpreted\n";
+    } else {
+        program->aotCppReport(prepared, tout);
+    }
+}
+
+// functions, which are not among the hottest in the profile, are marked as noAot
+bool applyProfile ( const ProgramPtr & program ) {
+    string text;
+    if ( FILE * f = fopen(profileFile.c_str(), "rb") ) {
+        char buf[4096];
+        size_t len;
+        while ( (len = fread(buf, 1, sizeof(buf), f))!=0 ) {
+            text.append(buf, len);
+        }
+        fclose(f);
+    } else {
+        tout << "can't open profile " << profileFile << "\n";
+        return false;
+    }
+    vector<FunctionProfile> profile;
+    if ( !readFunctionProfile(text, profile) ) {
+        tout << "invalid profile " << profileFile << "\n";
+        return false;
+    }
+    sort(profile.begin(), profile.end(), [](const FunctionProfile & a, const FunctionProfile & b){
+        return a.usec!=b.usec ? a.usec>b.usec : a.calls>b.calls;
+    });
+    if ( hotFunctions>0 && int(profile.size())>hotFunctions ) {
+        profile.resize(hotFunctions);
+    }
+    set<string> hot;
+    for ( auto & fp : profile ) {
+        if ( fp.calls ) {
+            hot.insert(fp.mangledName);
+        }
+    }
+    program->library.foreach([&](Module * pm) -> bool {
+        if ( pm!=program->thisModule.get() && !(wholeProject && !pm->builtIn) ) {
+            return true;
+        }
+        for ( auto & it : pm->functions ) {
+            auto pfun = it.second.get();
+            if ( pfun->builtIn || pfun->index<0 || !pfun->used || pfun->noAot ) {
+                continue;
+            }
+            if ( hot.find(pfun->getMangledName())==hot.end() ) {
+                pfun->noAot = true;
+                coldFunctions[pfun] = "not hot in the profile";
+            }
+        }
+        return true;
+    }, "*");
+    if ( !quiet ) {
+        tout << int(coldFunctions.size()) << " function(s) are not hot in the profile\n";
+    }
     return true;
 }
 
-bool compile ( const string & fn, const string & cppFn ) {
+AotCppPreparedPtr prepareAot ( const ProgramPtr & program, Context & ctx, bool noAot ) {
+    auto prepared = program->aotCppPrepare(ctx, wholeProject);
+    for ( auto & it : coldFunctions ) {
+        prepared->noAotReasons[it.first] = it.second;
+    }
+    writeReport(program, prepared, noAot);
+    return prepared;
+}
+
+string disabledAot ( const string & text ) {
+    TextWriter noTw;
+    noTw << "// AOT disabled due to module requirements\n";
+    noTw << "#if 0\n\n";
+    noTw << text;
+    noTw << "\n#endif\n";
+    return noTw.str();
+}
+
+void writeAotList ( TextWriter & tw, const ProgramPtr & program, Context & ctx, const AotCppPreparedPtr & prepared ) {
+    tw << "struct AotList_impl : AotListBase {\n";
+    tw << "\tvirtual void registerAotFunctions ( AotLibrary & aotLib ) override {\n";
+    program->registerAotCpp(tw, ctx, false, prepared);
+    tw << "\t};\n";
+    tw << "};\n";
+}
+
+uint64_t hashString ( const string & str ) {
+    uint64_t hash = 14695981039346656037ull;
+    for ( auto ch : str ) hash = (hash ^ uint8_t(ch)) * 1099511628211ull;
+    return hash;
+}
+
+struct AotShard {
+    string              fileName;
+    vector<Function *>  functions;
+    uint64_t            semHash = 0;        // incremental only, semantic hash of the function and the ones it calls
+    bool                upToDate = false;   // incremental only, file is there and nothing changed
+    TextWriter          body;
+};
+
+// manifest of the incremental AOT. first line is the hash of the header, then one line per generated file
+//  header <hash>
+//  <semantic hash of the file> <file name> <mangled function name>
+struct AotManifest {
+    uint64_t                    headerHash = 0;
+    map<uint64_t,string>        files;
+    vector<string>              lines;
+    bool load ( const string & fname ) {
+        FILE * f = fopen(fname.c_str(), "r");
+        if ( !f ) return false;
+        char line[4096];
+        while ( fgets(line, sizeof(line), f) ) {
+            char file[4096];
+            unsigned long long hash = 0;
+            if ( sscanf(line, "header %llx", &hash)==1 ) {
+                headerHash = hash;
+            } else if ( sscanf(line, "%llx %4095s", &hash, file)==2 ) {
+                files[hash] = file;
+            }
+        }
+        fclose(f);
+        return true;
+    }
+};
+
+bool fileExists ( const string & fname ) {
+    if ( FILE * f = fopen(fname.c_str(), "r") ) {
+        fclose(f);
+        return true;
+    }
+    return false;
+}
+
+// the main file (cppFn) has the init script and the registration, cppFn.h has types and function declarations.
+// with N shards function bodies are split between the main file and cppFn_1.cpp ... cppFn_N-1.cpp
+//  each function always goes to the same shard, so that editing one function only changes one file.
+// incremental AOT puts each function into cppFn_<semantic hash>.cpp, and keeps the manifest in cppFn.manifest
+//  the header only has types then, and each file declares the functions it calls
+//  files of functions, which semantic hash did not change, are not generated again. files of the functions which are gone are removed
+bool compileShards ( const ProgramPtr & program, Context & ctx, bool noAot, const string & fn, const string & cppFn, int shards, int threads, bool incremental ) {
+    string prefix = cppFn;
+    if ( prefix.size()>4 && prefix.substr(prefix.size()-4)==".cpp" ) {
+        prefix = prefix.substr(0, prefix.size()-4);
+    }
+    string headerFn = prefix + ".h";
+    string manifestFn = prefix + ".manifest";
+    auto slash = headerFn.find_last_of("\\/");
+    string headerName = slash==string::npos ? headerFn : headerFn.substr(slash+1);
+    auto prepared = prepareAot(program, ctx, noAot);
+    // function names include semantic hash. prototypes in the header would change with any function
+    prepared->prototypes = !incremental;
+    // unique namespace for each script. functions are visible from other shards
+    TextWriter nsName;
+    nsName << "_aot_" << HEX << hashString(fn) << DEC;
+    // header
+    TextWriter header;
+    header << "#pragma once\n\n";
+    writeIncludes(header, program);
+    writePragmaPush(header);
+    header << "namespace das {\n";
+    header << "namespace " << nsName.str() << " {\n";
+    program->aotCppHeader(prepared, header);
+    header << "void __init_script ( Context * __context__ );\n";
+    header << "}\n";
+    header << "}\n";
+    writePragmaPop(header);
+    string headerText = noAot ? disabledAot(header.str()) : header.str();
+    // split functions
+    vector<unique_ptr<AotShard>> shardList;
+    AotManifest manifest;
+    if ( incremental ) {
+        shardList.emplace_back(unique_ptr<AotShard>(new AotShard()));
+        map<uint64_t,AotShard *> byHash;
+        for ( auto pfn : prepared->functions ) {
+            // generated code also depends on the names of the functions it calls
+            uint64_t key = pfn->hash;
+            for ( auto cfn : prepared->calls[pfn] ) {
+                key = (key ^ cfn->hash) * 1099511628211ull;
+            }
+            auto & shard = byHash[key];
+            if ( !shard ) {
+                shardList.emplace_back(unique_ptr<AotShard>(new AotShard()));
+                shard = shardList.back().get();
+                shard->semHash = key;
+                TextWriter shardFn;
+                shardFn << prefix << "_" << HEX << key << DEC << ".cpp";
+                shard->fileName = shardFn.str();
+            }
+            shard->functions.push_back(pfn);
+        }
+        // everything is generated again, when the header changes
+        bool sameHeader = manifest.load(manifestFn) && manifest.headerHash==hashString(headerText);
+        for ( auto & shard : shardList ) {
+            if ( sameHeader && shard->semHash ) {
+                auto it = manifest.files.find(shard->semHash);
+                shard->upToDate = it!=manifest.files.end() && it->second==shard->fileName && fileExists(shard->fileName);
+            }
+        }
+    } else {
+        for ( int si=0; si!=shards; ++si ) {
+            shardList.emplace_back(unique_ptr<AotShard>(new AotShard()));
+            if ( si ) shardList.back()->fileName = prefix + "_" + to_string(si) + ".cpp";
+        }
+        for ( auto pfn : prepared->functions ) {
+            auto mangledName = pfn->getMangledName();
+            uint32_t hash = hash_blockz32((uint8_t *)mangledName.c_str());
+            shardList[hash % uint32_t(shards)]->functions.push_back(pfn);
+        }
+    }
+    shardList[0]->fileName = cppFn;
+    // function bodies, in parallel
+    vector<AotShard *> work;
+    for ( auto & shard : shardList ) {
+        if ( !shard->upToDate ) work.push_back(shard.get());
+    }
+    int numThreads = max(1, min(threads, int(work.size())));
+    vector<thread> workers;
+    for ( int t=0; t!=numThreads; ++t ) {
+        workers.emplace_back([&,t]() {
+            for ( size_t si=t; si<work.size(); si+=numThreads ) {
+                program->aotCppFunctions(prepared, work[si]->functions, work[si]->body);
+            }
+        });
+    }
+    for ( auto & w : workers ) {
+        w.join();
+    }
+    // shards
+    bool ok = saveToFileIfChanged(headerFn, headerText);
+    for ( auto shard : work ) {
+        bool isMain = shard==shardList[0].get();
+        TextWriter tw;
+        tw << "#include \"" << headerName << "\"\n\n";
+        writePragmaPush(tw);
+        tw << "namespace das {\n";
+        tw << "namespace " << nsName.str() << " {\n";
+        tw << shard->body.str();
+        if ( isMain ) {
+            if ( incremental ) {
+                program->aotCppPrototypes(prepared, prepared->functions, tw);
+            }
+            program->aotCppInitScript(prepared, tw);
+        }
+        tw << "}\n";
+        if ( isMain ) {
+            tw << "namespace {\n";
+            tw << "using namespace " << nsName.str() << ";\n";
+            writeAotList(tw, program, ctx, prepared);
+            tw << "AotList_impl impl;\n";
+            tw << "}\n";
+        }
+        tw << "}\n";
+        writePragmaPop(tw);
+        ok = saveToFileIfChanged(shard->fileName, noAot ? disabledAot(tw.str()) : tw.str()) && ok;
+    }
+    if ( incremental ) {
+        int reused = int(shardList.size() - work.size());
+        // collect the garbage
+        for ( auto & it : manifest.files ) {
+            bool stale = true;
+            for ( auto & shard : shardList ) {
+                if ( shard->fileName==it.second ) {
+                    stale = false;
+                    break;
+                }
+            }
+            if ( stale ) {
+                if ( !quiet ) {
+                    tout << "removing " << it.second << "\n";
+                }
+                remove(it.second.c_str());
+            }
+        }
+        TextWriter mf;
+        mf << "header " << HEX << hashString(headerText) << DEC << "\n";
+        for ( auto & shard : shardList ) {
+            if ( !shard->semHash ) continue;
+            for ( auto pfn : shard->functions ) {
+                mf << HEX << shard->semHash << DEC << " " << shard->fileName << " " << pfn->getMangledName() << "\n";
+            }
+        }
+        ok = saveToFileIfChanged(manifestFn, mf.str()) && ok;
+        if ( !quiet ) {
+            tout << "generated " << int(work.size()) << " file(s), " << reused << " up to date\n";
+        }
+    }
+    return ok;
+}
+
+bool compile ( const string & fn, const string & cppFn, int shards, int threads, bool incremental ) {
     auto access = make_shared<FsFileAccess>();
     ModuleGroup dummyGroup;
     if ( auto program = compileDaScript(fn,access,tout,dummyGroup) ) {
@@ -39,86 +431,32 @@ bool compile ( const string & fn, const string & cppFn ) {
                 }
                 return false;
             }
+            if ( !profileFile.empty() && !applyProfile(program) ) {
+                return false;
+            }
             // AOT time
             TextWriter tw;
             bool noAot = program->options.getOption("noaot",false);
             // header
-            tw << "#include \"daScript/misc/platform.h\"\n\n";
-
-            tw << "#include \"daScript/simulate/simulate.h\"\n";
-            tw << "#include \"daScript/simulate/aot.h\"\n";
-            tw << "#include \"daScript/simulate/aot_library.h\"\n";
-            tw << "\n";
-            // lets comment on required modules
-            program->library.foreach([&](Module * mod){
-                if ( mod->name=="" ) {
-                    // nothing, its main program module. i.e ::
-                } else {
-                    if ( mod->name=="$" ) {
-                        tw << " // require builtin\n";
-                    } else {
-                        tw << " // require " << mod->name << "\n";
-                    }
-                    if ( mod->aotRequire(tw)==ModuleAotType::no_aot ) {
-                        tw << "  // AOT disabled due to this module\n";
-                        noAot = true;
-                    }
-                }
-                return true;
-            },"*");
-            tw << "\n";
-            tw << "#if defined(_MSC_VER)\n";
-            tw << "#pragma warning(push)\n";
-            tw << "#pragma warning(disable:4100)   // unreferenced formal parameter\n";
-            tw << "#pragma warning(disable:4189)   // local variable is initialized but not referenced\n";
-            tw << "#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data\n";
-            tw << "#pragma warning(disable:4114)   // same qualifier more than once\n";
-            tw << "#elif defined(__GNUC__) && !defined(__clang__)\n";
-            tw << "#pragma GCC diagnostic push\n";
-            tw << "#pragma GCC diagnostic ignored \"-Wunused-parameter\"\n";
-            tw << "#pragma GCC diagnostic ignored \"-Wunused-variable\"\n";
-            tw << "#pragma GCC diagnostic ignored \"-Wunused-function\"\n";
-			tw << "#pragma GCC diagnostic ignored \"-Wwrite-strings\"\n";
-			tw << "#pragma GCC diagnostic ignored \"-Wreturn-local-addr\"\n";
-			tw << "#pragma GCC diagnostic ignored \"-Wignored-qualifiers\"\n";
-			tw << "#pragma GCC diagnostic ignored \"-Wsign-compare\"\n";
-            tw << "#elif defined(__clang__)\n";
-            tw << "#pragma clang diagnostic push\n";
-            tw << "#pragma clang diagnostic ignored \"-Wunused-parameter\"\n";
-            tw << "#pragma clang diagnostic ignored \"-Wwritable-strings\"\n";
-            tw << "#pragma clang diagnostic ignored \"-Wunused-variable\"\n";
-            tw << "#pragma clang diagnostic ignored \"-Wunsequenced\"\n";
-            tw << "#pragma clang diagnostic ignored \"-Wunused-function\"\n";
-            tw << "#endif\n";
-            tw << "\n";
+            noAot = writeIncludes(tw, program) || noAot;
+            if ( shards>1 || incremental ) {
+                return compileShards(program, ctx, noAot, fn, cppFn, shards, threads, incremental);
+            }
+            writePragmaPush(tw);
             tw << "namespace das {\n";
             tw << "namespace {\n"; // anonymous
             // AOT actual
-            program->aotCpp(ctx, tw);
+            auto prepared = prepareAot(program, ctx, noAot);
+            program->aotCpp(prepared, tw);
             // list STUFF
-            tw << "struct AotList_impl : AotListBase {\n";
-            tw << "\tvirtual void registerAotFunctions ( AotLibrary & aotLib ) override {\n";
-            program->registerAotCpp(tw, ctx, false);
-            tw << "\t};\n";
-            tw << "};\n";
+            writeAotList(tw, program, ctx, prepared);
             tw << "AotList_impl impl;\n";
             tw << "}\n";
             tw << "}\n";
-            tw << "#if defined(_MSC_VER)\n";
-            tw << "#pragma warning(pop)\n";
-            tw << "#elif defined(__GNUC__) && !defined(__clang__)\n";
-            tw << "#pragma GCC diagnostic pop\n";
-            tw << "#elif defined(__clang__)\n";
-            tw << "#pragma clang diagnostic pop\n";
-            tw << "#endif\n";
+            writePragmaPop(tw);
             // and save
             if ( noAot ) {
-                TextWriter noTw;
-                noTw << "// AOT disabled due to module requirements\n";
-                noTw << "#if 0\n\n";
-                noTw << tw.str();
-                noTw << "\n#endif\n";
-                return saveToFile(cppFn, noTw.str());
+                return saveToFile(cppFn, disabledAot(tw.str()));
             } else {
                 return saveToFile(cppFn, tw.str());
             }
@@ -133,20 +471,37 @@ void require_project_specific_modules();//link time resolved dependencies
 
 int main(int argc, const char * argv[]) {
     if ( argc<3 ) {
-        tout << "dasAot <in_script.das> <out_script.das.cpp> [-q]\n";
+        tout << "dasAot <in_script.das> <out_script.das.cpp> [-q] [-project] [-report] [-profile file [-hot N]] [-shards N] [-incremental] [-j threads]\n";
         return -1;
     }
-    if ( argc>3 && strcmp(argv[3], "-q")==0 ) {
-        quiet = true;
+    int shards = 1;
+    bool incremental = false;
+    int threads = max(int(thread::hardware_concurrency()), 1);
+    for ( int ai=3; ai<argc; ++ai ) {
+        if ( strcmp(argv[ai], "-q")==0 ) {
+            quiet = true;
+        } else if ( strcmp(argv[ai], "-shards")==0 && ai+1<argc ) {
+            shards = max(atoi(argv[++ai]), 1);
+        } else if ( strcmp(argv[ai], "-project")==0 ) {
+            wholeProject = true;
+        } else if ( strcmp(argv[ai], "-report")==0 ) {
+            report = true;
+        } else if ( strcmp(argv[ai], "-profile")==0 && ai+1<argc ) {
+            profileFile = argv[++ai];
+        } else if ( strcmp(argv[ai], "-hot")==0 && ai+1<argc ) {
+            hotFunctions = max(atoi(argv[++ai]), 0);
+        } else if ( strcmp(argv[ai], "-incremental")==0 ) {
+            incremental = true;
+        } else if ( strcmp(argv[ai], "-j")==0 && ai+1<argc ) {
+            threads = max(atoi(argv[++ai]), 1);
+        }
     }
     NEED_MODULE(Module_BuiltIn);
     NEED_MODULE(Module_Math);
     NEED_MODULE(Module_Random);
     NEED_MODULE(Module_Rtti);
     require_project_specific_modules();
-    bool compiled = compile(argv[1], argv[2]);
+    bool compiled = compile(argv[1], argv[2], shards, threads, incremental);
     Module::Shutdown();
     return compiled ? 0 : -1;
 }
-
-